@@ -1,20 +1,53 @@
+#include <algorithm>
+#include <thread>
+
 #include "preparse.h"
 #include "appsettings.h"
+#include "backupstore.h"
+#include "batchprocessor.h"
+#include "directorywatcher.h"
+#include "outputstamp.h"
+#include "runworkspace.h"
+#include "filelock.h"
+#include "labellingserviceclient.h"
 #include "application.h"
 
 namespace Aux = Utilities::Other;
 
 Application::Application()
     : mParserType{ParserCreator::ParserTypes::UNKNOWN}
-    , mpInputStream{std::make_shared<std::ifstream>()}
-    , mpOutputStream{std::make_shared<std::ofstream>()}
-    , mpErrorStream{std::make_shared<std::ofstream>()}
+    , mpInputStream{std::make_shared<Core::DecompressingInputStream>()}
+    , mpOutputStream{std::make_shared<Core::CompressingOutputStream>()}
+    , mpErrorStream{std::make_shared<Core::LazyFileStream>()}
     , mIsInitialized{false}
     , mIsFileIOEnabled{false}
     , mIsCSVParsingRequired{true}
+    , mIsInteractive{true}
+    , mIsQuiet{false}
+    , mIsBatchMode{false}
+    , mIsWatchMode{false}
+    , mIsServiceMode{false}
+    , mIsLoadTestMode{false}
+    , mIsRestoreMode{false}
+    , mIsExamplesCopyRequired{false}
+    , mIsStartupTimeRequired{false}
+    , mIsBackupListRequired{false}
+    , mIsFullProcessingRequired{false}
+    , mIsOutputUpToDate{false}
+    , mIsValidationRequired{false}
+    , mIsErrorReportAggregated{false}
+    , mIsPartialOutputRequired{false}
+    , mIsPartialOutputWritten{false}
+    , mIsConflictCheckRequired{false}
+    , mWorkersCount{0u}
+    , mBatchRacksCount{0u}
+    , mBatchFailedRacksCount{0u}
+    , mServiceRequestsCount{0u}
+    , mLoadTestRequestsCount{scDefaultLoadTestRequestsCount}
+    , mValidatedRowsCount{0u}
+    , mMaxErrorsCount{0u}
     , mStatusCode{StatusCode::UNDEFINED}
 {
-    _init();
 }
 
 std::shared_ptr<Application> Application::getInstance()
@@ -27,16 +60,63 @@ std::shared_ptr<Application> Application::getInstance()
     return s_pApplication;
 }
 
-int Application::run()
+int Application::run(const std::vector<std::string_view>& arguments)
 {
-    if (mIsInitialized)
+    const auto c_StartTime{std::chrono::steady_clock::now()};
+
+    mIsInteractive = arguments.empty();
+
+    // the environment is only setup once the requested files are known (they might be provided as arguments)
+    if (const bool c_CanProceed{mIsInteractive || _handleArguments(arguments)}; c_CanProceed)
+    {
+        _init();
+    }
+
+    if (mIsStartupTimeRequired)
+    {
+        std::cerr << "Startup time: " << std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - c_StartTime).count() << " us\n";
+    }
+
+    if (mIsInitialized && mIsBatchMode)
+    {
+        _processBatch();
+    }
+    else if (mIsInitialized && mIsWatchMode)
+    {
+        _processWatch();
+    }
+    else if (mIsInitialized && mIsServiceMode)
+    {
+        _processServiceRequests();
+    }
+    else if (mIsInitialized && mIsLoadTestMode)
+    {
+        _processLoadTest();
+    }
+    else if (mIsInitialized && mIsRestoreMode)
+    {
+        _processRestore();
+    }
+    else if (mIsInitialized && mIsExamplesCopyRequired)
+    {
+        _copyExamplesDir();
+    }
+    else if (mIsInitialized)
     {
-        _displayGreetingAndVersion();
-        _displayMenu();
+        if (mIsInteractive)
+        {
+            _displayGreetingAndVersion();
+            _displayMenu();
+        }
 
-        const bool c_UserInputProvided{_handleUserInput()};
+        const bool c_UserInputProvided{!mIsInteractive || _handleUserInput()};
 
-        if (c_UserInputProvided)
+        // validating the input file is required even if the output file is up to date
+        if (c_UserInputProvided && !mIsValidationRequired && _checkOutputUpToDate())
+        {
+            mStatusCode = StatusCode::SUCCESS;
+        }
+        else if (c_UserInputProvided)
         {
             _enableFileInputOutput();
         }
@@ -57,6 +137,11 @@ int Application::run()
                 mStatusCode = StatusCode::SUCCESS;
             }
         }
+
+        if (mpRunWorkspace)
+        {
+            _publishRunFiles();
+        }
     }
 
     const int returnCode{_handleStatusCode()};
@@ -72,12 +157,96 @@ void Application::_parseInput()
 
         if (!parserCreator.isParserAlreadyCreated())
         {
-            const ParserPtr pParser{parserCreator.createParser(mParserType, mpInputStream, mpOutputStream, mpErrorStream)};
+            LabellingIndexPtr pLabellingIndex{nullptr};
+
+            // only the connection input rows changed since the previous run need to be labelled (when validating all rows are checked)
+            if (ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType && !mIsValidationRequired)
+            {
+                pLabellingIndex = std::make_shared<LabellingIndex>(LabellingIndex::getIndexFile(_getOutputFile()));
+
+                if (!mIsFullProcessingRequired)
+                {
+                    (void)pLabellingIndex->load();
+                }
+            }
+
+            ConnectionReportsPtr pConnectionReports{nullptr};
+
+            if (ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType && !mReportTypes.empty())
+            {
+                pConnectionReports = std::make_shared<ConnectionReports>(_getOutputFile());
+
+                for (const auto c_ReportType : mReportTypes)
+                {
+                    pConnectionReports->addReport(c_ReportType);
+                }
+            }
+
+            const ConnectionConflictDetectorPtr c_pConnectionConflictDetector{mIsConflictCheckRequired ? std::make_shared<ConnectionConflictDetector>() : nullptr};
+
+            // nothing gets written to the output stream when validating, yet the parser requires a valid one
+            Core::OutputStreamPtr pOutputStream{mpOutputStream};
+
+            if (mIsValidationRequired)
+            {
+                pOutputStream = std::make_shared<std::ostringstream>();
+            }
+
+            const ParserPtr pParser{parserCreator.createParser(mParserType, mpInputStream, pOutputStream, mpErrorStream, pLabellingIndex, pConnectionReports, c_pConnectionConflictDetector)};
 
             if (pParser)
             {
+                pParser->setValidationOnly(mIsValidationRequired);
+                pParser->setMaxErrorsCount(mMaxErrorsCount);
+                pParser->setErrorReportAggregated(mIsErrorReportAggregated);
+                pParser->setPartialOutputAllowed(mIsPartialOutputRequired);
+                pParser->setInputFile(_getInputFile());
+
+                // the connection input file (option 1) is edited further so it is always written as csv
+                if (ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType)
+                {
+                    pParser->setOutputFormat(Parser::getOutputFormat(_getOutputFile()));
+                }
+
+                if (!mLabelSpoolDirArgument.empty())
+                {
+                    pParser->setLabelSpool(mLabelSpoolDirArgument, _getOutputFile());
+                }
+
                 const bool c_ParsingErrorsOccurred{pParser->parse()};
-                mStatusCode = !c_ParsingErrorsOccurred ? StatusCode::SUCCESS : StatusCode::PARSING_ERROR;
+
+                if (mIsValidationRequired)
+                {
+                    mValidatedRowsCount = pParser->getInputRowsCount();
+                    mValidationErrorsCount = pParser->getParsingErrorsCount();
+                }
+
+                // a corrupt or truncated compressed input file cannot be (completely) read
+                if (mpInputStream->isCorrupt())
+                {
+                    mStatusCode = StatusCode::INPUT_FILE_NOT_OPENED;
+                }
+                // the error file is only created when the first error gets written to it
+                else if (!c_ParsingErrorsOccurred && pParser->isLabelSpoolingFailed())
+                {
+                    mStatusCode = StatusCode::LABELS_NOT_SPOOLED;
+                }
+                else if (!c_ParsingErrorsOccurred)
+                {
+                    mStatusCode = !pConnectionReports || !pConnectionReports->isWritingFailed() ? StatusCode::SUCCESS : StatusCode::REPORTS_NOT_WRITTEN;
+                }
+                else
+                {
+                    mStatusCode = !mpErrorStream->flush().bad() ? StatusCode::PARSING_ERROR : StatusCode::ERROR_FILE_NOT_OPENED;
+                    mIsPartialOutputWritten = StatusCode::PARSING_ERROR == mStatusCode && mIsPartialOutputRequired && !mIsValidationRequired;
+                }
+
+                // the index should only describe a successfully written output file (the stamp is saved once the output file is published)
+                // for a partial output it only contains the valid rows, so the next run (once the errors are fixed) only needs to label the fixed rows
+                if ((_isOutputValid() || mIsPartialOutputWritten) && !mpOutputStream->flush().fail() && pLabellingIndex)
+                {
+                    (void)pLabellingIndex->save();
+                }
             }
             else
             {
@@ -87,25 +256,393 @@ void Application::_parseInput()
     }
 }
 
-void Application::_init()
+void Application::_processBatch()
 {
-    if (!mIsInitialized)
+    BatchProcessor batchProcessor{mParserType, mOutputFileArgument, mWorkersCount};
+    batchProcessor.setFullProcessingRequired(mIsFullProcessingRequired);
+
+    // the output filename should be known when adding the racks
+    if ("xlsx" == mBatchFormatArgument)
+    {
+        batchProcessor.setOutputFormat(Parser::OutputFormat::XLSX);
+    }
+    else if ("jsonl" == mBatchFormatArgument)
+    {
+        batchProcessor.setOutputFormat(Parser::OutputFormat::JSONL);
+    }
+    else if ("bin" == mBatchFormatArgument)
+    {
+        batchProcessor.setOutputFormat(Parser::OutputFormat::BINARY);
+    }
+    else if ("zpl" == mBatchFormatArgument)
+    {
+        batchProcessor.setOutputFormat(Parser::OutputFormat::ZPL);
+    }
+    else if ("epl" == mBatchFormatArgument)
+    {
+        batchProcessor.setOutputFormat(Parser::OutputFormat::EPL);
+    }
+
+    batchProcessor.setLabelSpoolDir(mLabelSpoolDirArgument);
+    batchProcessor.setReportTypes(mReportTypes);
+    batchProcessor.setMaxErrorsCount(mMaxErrorsCount);
+    batchProcessor.setErrorReportAggregated(mIsErrorReportAggregated);
+    batchProcessor.setConflictCheckRequired(mIsConflictCheckRequired);
+
+    if ("async" == mBatchIOArgument)
+    {
+        batchProcessor.setIOMode(BatchProcessor::IOMode::ASYNC);
+    }
+    else if ("threads" == mBatchIOArgument)
+    {
+        batchProcessor.setIOMode(BatchProcessor::IOMode::ASYNC_THREAD_POOL);
+    }
+
+    // the input is either a directory containing the rack input files or a manifest file listing them
+    const bool c_RacksAdded{std::filesystem::is_directory(mInputFileArgument) ? batchProcessor.addRacksFromDirectory(mInputFileArgument)
+                                                                               : batchProcessor.addRacksFromManifest(mInputFileArgument)};
+
+    if (!c_RacksAdded)
+    {
+        mStatusCode = StatusCode::INPUT_FILE_NOT_OPENED;
+    }
+    else if (!mOutputFileArgument.empty() && !_setDirectory(mOutputFileArgument))
+    {
+        mStatusCode = StatusCode::OUTPUT_FILE_NOT_OPENED;
+    }
+    else
+    {
+        const bool c_AllRacksSucceeded{batchProcessor.process()};
+
+        mStatusCode = c_AllRacksSucceeded ? StatusCode::SUCCESS : StatusCode::BATCH_RACKS_FAILED;
+        mBatchRacksCount = batchProcessor.getRacksCount();
+        mBatchFailedRacksCount = batchProcessor.getFailedRacksCount();
+
+        if (!mSummaryFileArgument.empty())
+        {
+            if (std::ofstream summaryStream{mSummaryFileArgument}; summaryStream.is_open())
+            {
+                batchProcessor.writeSummary(summaryStream);
+            }
+            else
+            {
+                std::cerr << "Warning! The batch summary file cannot be opened for writing: " << mSummaryFileArgument.string() << "\n\n";
+            }
+        }
+        else if (!mIsQuiet)
+        {
+            batchProcessor.writeSummary(std::cout);
+            std::cout << "\n";
+        }
+    }
+}
+
+void Application::_processWatch()
+{
+    const Core::Path_t c_WatchedDir{!mInputFileArgument.empty() ? mInputFileArgument : mAppDataDir};
+    const std::string c_DefinitionsFilename{mConnectionDefinitionsFile.filename().string()};
+    const std::string c_InputFilename{mConnectionInputFile.filename().string()};
+
+    DirectoryWatcher directoryWatcher{c_WatchedDir, {c_DefinitionsFilename, c_InputFilename}};
+
+    if (directoryWatcher.isValid())
+    {
+        _enableStopRequests(true);
+
+        if (!mIsQuiet)
+        {
+            std::cout << "Watching directory " << c_WatchedDir.string() << (directoryWatcher.isNotificationBased() ? "" : " (polling)") << "\n";
+            std::cout << "The connection definitions/input files are processed each time they are saved. Press Ctrl+C to stop\n\n";
+        }
+
+        while (!s_IsStopRequested)
+        {
+            const std::vector<Core::Path_t> c_ChangedFiles{directoryWatcher.waitForChanges(s_IsStopRequested)};
+            std::vector<Core::Path_t> changedDefinitionsFiles;
+            std::vector<Core::Path_t> changedInputFiles;
+
+            for (const auto& c_File : c_ChangedFiles)
+            {
+                if (const std::string c_Filename{c_File.filename().string()};
+                    c_Filename.size() >= c_DefinitionsFilename.size() &&
+                    0 == c_Filename.compare(c_Filename.size() - c_DefinitionsFilename.size(), c_DefinitionsFilename.size(), c_DefinitionsFilename))
+                {
+                    changedDefinitionsFiles.push_back(c_File);
+                }
+                else
+                {
+                    changedInputFiles.push_back(c_File);
+                }
+            }
+
+            // a connection input file that has just been (re)generated from the definitions is a template so it should not be labelled
+            const std::vector<Core::Path_t> c_GeneratedInputFiles{_processWatchedRacks(ParserCreator::ParserTypes::CONNECTION_DEFINITION, changedDefinitionsFiles, directoryWatcher)};
+
+            changedInputFiles.erase(std::remove_if(changedInputFiles.begin(), changedInputFiles.end(), [&c_GeneratedInputFiles](const Core::Path_t& file) {
+                return c_GeneratedInputFiles.cend() != std::find(c_GeneratedInputFiles.cbegin(), c_GeneratedInputFiles.cend(), file);
+            }), changedInputFiles.end());
+
+            (void)_processWatchedRacks(ParserCreator::ParserTypes::CONNECTION_INPUT, changedInputFiles, directoryWatcher);
+        }
+
+        _enableStopRequests(false);
+
+        mStatusCode = StatusCode::SUCCESS;
+    }
+    else
+    {
+        mStatusCode = StatusCode::INPUT_FILE_NOT_OPENED;
+    }
+}
+
+/* The connection input files are user edited so they are backed up before being overwritten by option 1 (the labelling tables are regenerated without backup)
+   A file saved while being edited might not be valid yet, so the previous output file of a failed rack is kept as is (the error file tells what to fix)
+   The written output files are acknowledged by the watcher so they don't trigger further processing
+*/
+std::vector<Core::Path_t> Application::_processWatchedRacks(const ParserCreator::ParserTypes parserType, const std::vector<Core::Path_t>& inputFiles, DirectoryWatcher& directoryWatcher)
+{
+    std::vector<Core::Path_t> outputFiles;
+
+    if (!inputFiles.empty())
     {
-        const bool c_EnvironmentSuccessfullySetup{_setApplicationEnvironment()};
+        BatchProcessor batchProcessor{parserType, {}, 0u};
+        batchProcessor.setPreviousOutputKeptOnFailure(true);
+
+        if (ParserCreator::ParserTypes::CONNECTION_DEFINITION == parserType)
+        {
+            batchProcessor.setOutputBackupDir(mInputBackupDir);
+        }
+
+        for (const auto& c_InputFile : inputFiles)
+        {
+            (void)batchProcessor.addRack(c_InputFile);
+        }
+
+        (void)batchProcessor.process();
 
-        if (c_EnvironmentSuccessfullySetup && mpErrorStream)
+        for (const auto& c_RackResult : batchProcessor.getRackResults())
         {
-            mpErrorStream->open(mParsingErrorsFile);
+            directoryWatcher.acknowledgeFile(c_RackResult.mOutputFile);
 
-            if (mpErrorStream->is_open())
+            if (BatchProcessor::RackStatus::UP_TO_DATE == c_RackResult.mStatus)
             {
-                mIsInitialized = true;
+                outputFiles.push_back(c_RackResult.mOutputFile);
+
+                if (!mIsQuiet)
+                {
+                    std::cout << Core::getDateTimeString(std::chrono::system_clock::now()) << " " << c_RackResult.mInputFile.filename().string() << " unchanged, "
+                              << c_RackResult.mOutputFile.filename().string() << " is up to date\n";
+                }
+            }
+            else if (BatchProcessor::RackStatus::SUCCESS == c_RackResult.mStatus)
+            {
+                outputFiles.push_back(c_RackResult.mOutputFile);
+
+                if (!mIsQuiet)
+                {
+                    std::cout << Core::getDateTimeString(std::chrono::system_clock::now()) << " " << c_RackResult.mInputFile.filename().string() << " processed, output written to "
+                              << c_RackResult.mOutputFile.filename().string() << " (" << c_RackResult.mDuration.count() << " ms)\n";
+                }
             }
             else
             {
-                mStatusCode = StatusCode::ERROR_FILE_NOT_OPENED;
+                std::cerr << Core::getDateTimeString(std::chrono::system_clock::now()) << " " << c_RackResult.mInputFile.filename().string() << " failed: "
+                          << BatchProcessor::getRackStatusAsString(c_RackResult.mStatus)
+                          << (BatchProcessor::RackStatus::PARSING_ERROR == c_RackResult.mStatus ? ", see " + c_RackResult.mErrorFile.filename().string() : "") << "\n";
+            }
+        }
+    }
+
+    return outputFiles;
+}
+
+void Application::_processServiceRequests()
+{
+    LabellingService labellingService{_getServiceSocketFile(), mWorkersCount};
+
+    if (labellingService.start())
+    {
+        _enableStopRequests(true);
+
+        if (!mIsQuiet)
+        {
+            std::cout << "Serving requests on socket " << _getServiceSocketFile().string() << " (" << labellingService.getWorkersCount() << " workers). Press Ctrl+C to stop\n";
+        }
+
+        labellingService.run(s_IsStopRequested);
+
+        _enableStopRequests(false);
+
+        mServiceRequestsCount = labellingService.getHandledRequestsCount();
+        mStatusCode = StatusCode::SUCCESS;
+    }
+    else
+    {
+        mStatusCode = StatusCode::SERVICE_NOT_AVAILABLE;
+    }
+}
+
+void Application::_processLoadTest()
+{
+    Core::DecompressingInputStream inputStream;
+    std::ostringstream inputData;
+
+    inputStream.open(mInputFileArgument);
+
+    if (inputStream.isOpen())
+    {
+        inputData << inputStream.rdbuf();
+    }
+
+    // the service gets the decompressed input (a corrupt compressed file is handled like a missing one)
+    if (inputStream.isOpen() && !inputStream.isCorrupt())
+    {
+        const LabellingServiceClient c_Client{_getServiceSocketFile()};
+
+        // a first request checks that the service is reachable (and warms it up)
+        if (LabellingServiceClient::Response_t response; c_Client.sendRequest(mParserType, inputData.str(), response))
+        {
+            const size_t c_ClientsCount{mWorkersCount > 0u ? mWorkersCount : std::max(1u, std::thread::hardware_concurrency())};
+            const LabellingServiceClient::LoadTestResult_t c_LoadTestResult{c_Client.runLoadTest(mParserType, inputData.str(), mLoadTestRequestsCount, c_ClientsCount)};
+
+            if (!mIsQuiet)
+            {
+                std::cout << "Response status: " << LabellingService::getRequestStatusAsString(response.mStatus) << ", concurrent clients: " << c_ClientsCount << "\n";
+                LabellingServiceClient::writeLoadTestResult(c_LoadTestResult, std::cout);
+                std::cout << "\n";
+            }
+
+            mServiceRequestsCount = c_LoadTestResult.mRequestsCount;
+            mStatusCode = 0u == c_LoadTestResult.mFailedRequestsCount ? StatusCode::SUCCESS : StatusCode::SERVICE_NOT_AVAILABLE;
+        }
+        else
+        {
+            mStatusCode = StatusCode::SERVICE_NOT_AVAILABLE;
+        }
+    }
+    else
+    {
+        mStatusCode = StatusCode::INPUT_FILE_NOT_OPENED;
+    }
+}
+
+/* The restored version is written next to the destination file first so the destination is only replaced (and backed up) if restoring succeeded
+*/
+void Application::_processRestore()
+{
+    const BackupStore::Settings_t c_BackupSettings{BackupStore::readSettings(AppSettings::getInstance()->getBackupSettingsFile())};
+    BackupStore inputBackupStore{mInputBackupDir, c_BackupSettings};
+    BackupStore outputBackupStore{mOutputBackupDir, c_BackupSettings};
+
+    if (mIsBackupListRequired)
+    {
+        std::vector<std::pair<BackupStore::Version_t, Core::Path_t>> versions;
+
+        for (auto* const pBackupStore : {&inputBackupStore, &outputBackupStore})
+        {
+            const Core::Path_t c_BackupDir{pBackupStore == &inputBackupStore ? mInputBackupDir : mOutputBackupDir};
+
+            for (auto& version : pBackupStore->getVersions())
+            {
+                versions.emplace_back(std::move(version), c_BackupDir);
+            }
+        }
+
+        std::stable_sort(versions.begin(), versions.end(), [](const auto& first, const auto& second) {return BackupStore::isEarlierTimestamp(first.first.mTimestamp, second.first.mTimestamp);});
+
+        std::cout << "Timestamp,Filename,Size (bytes),Backup directory\n";
+
+        for (const auto& [c_Version, c_BackupDir] : versions)
+        {
+            std::cout << c_Version.mTimestamp << "," << c_Version.mFilename << "," << c_Version.mSize << "," << c_BackupDir.string() << "\n";
+        }
+
+        mStatusCode = StatusCode::SUCCESS;
+    }
+    else
+    {
+        // each file is backed up to one of the two stores, if found in both the latest version is restored
+        BackupStore* pBackupStore{nullptr};
+        std::string restoredTimestamp;
+        size_t requestedVersionsCount{0u};
+
+        for (auto* const pCandidateBackupStore : {&inputBackupStore, &outputBackupStore})
+        {
+            for (const auto& c_Version : pCandidateBackupStore->getVersions())
+            {
+                if (mRestoreFilenameArgument == c_Version.mFilename && (mRestoreVersionArgument.empty() || mRestoreVersionArgument == c_Version.mTimestamp) &&
+                    (restoredTimestamp.empty() || !BackupStore::isEarlierTimestamp(c_Version.mTimestamp, restoredTimestamp)))
+                {
+                    pBackupStore = pCandidateBackupStore;
+                    restoredTimestamp = c_Version.mTimestamp;
+                    ++requestedVersionsCount;
+                }
             }
         }
+
+        // a requested version that cannot be identified (e.g. same timestamp in both stores) is not restored instead of picking one of the candidates
+        if (!mRestoreVersionArgument.empty() && requestedVersionsCount > 1u)
+        {
+            std::cerr << "Version " << mRestoreVersionArgument << " of " << mRestoreFilenameArgument << " is ambiguous (found in multiple backup directories), no version is restored\n";
+            pBackupStore = nullptr;
+        }
+
+        const Core::Path_t c_DestinationFile{!mOutputFileArgument.empty() ? mOutputFileArgument : mAppDataDir / mRestoreFilenameArgument};
+        const Core::Path_t c_RestoredFile{Core::getTemporaryFile(c_DestinationFile)};
+
+        // concurrent runs publishing the same file should wait until it has been replaced
+        const Core::FileLock c_DestinationFileLock{RunWorkspace{AppSettings::getInstance()->getWorkspaceDir()}.getLockFile(c_DestinationFile)};
+
+        bool success{pBackupStore && pBackupStore->restoreFile(mRestoreFilenameArgument, restoredTimestamp, c_RestoredFile)};
+        std::error_code errorCode;
+
+        // same as for the other operations: a data file is backed up before being overwritten, an output file provided as argument is not
+        if (success && mOutputFileArgument.empty() && std::filesystem::exists(c_DestinationFile, errorCode))
+        {
+            success = pBackupStore->moveFile(c_DestinationFile);
+        }
+
+        if (success)
+        {
+            std::filesystem::rename(c_RestoredFile, c_DestinationFile, errorCode);
+            success = !errorCode;
+        }
+
+        if (success && !mIsQuiet)
+        {
+            std::cout << "Version " << restoredTimestamp << " of " << mRestoreFilenameArgument << " restored to: " << c_DestinationFile.string() << "\n\n";
+        }
+
+        if (!success)
+        {
+            (void)std::filesystem::remove(c_RestoredFile, errorCode);
+        }
+
+        mStatusCode = success ? StatusCode::SUCCESS : StatusCode::BACKUP_NOT_RESTORED;
+    }
+}
+
+void Application::_enableStopRequests(const bool enable)
+{
+    if (enable)
+    {
+        s_IsStopRequested = 0;
+    }
+
+    std::signal(SIGINT, enable ? _requestStop : SIG_DFL);
+    std::signal(SIGTERM, enable ? _requestStop : SIG_DFL);
+}
+
+void Application::_requestStop(int)
+{
+    s_IsStopRequested = 1;
+}
+
+void Application::_init()
+{
+    if (!mIsInitialized)
+    {
+        mIsInitialized = _setApplicationEnvironment();
     }
 }
 
@@ -121,7 +658,6 @@ bool Application::_setApplicationEnvironment()
 
         if (c_DirsSuccessfullySetup)
         {
-            _copyExamplesDir();
             _retrieveFilePaths();
 
             success = true;
@@ -133,9 +669,9 @@ bool Application::_setApplicationEnvironment()
     }
 
     // it is always a good idea to provide the user with a good starting point, namely a connection definitions file ready to be filled-in
-    if (success && !std::filesystem::exists(mConnectionDefinitionsFile))
+    if (success && _isConnectionDefinitionsFileRequired() && !std::filesystem::exists(mConnectionDefinitionsFile))
     {
-        Core::OutputStreamPtr pEmptyFileStream{std::make_shared<std::ofstream>(mConnectionDefinitionsFile)};
+        Core::OutputFileStreamPtr pEmptyFileStream{std::make_shared<std::ofstream>(mConnectionDefinitionsFile)};
 
         if (pEmptyFileStream->is_open())
         {
@@ -155,7 +691,7 @@ void Application::_retrieveFilePaths()
     mConnectionDefinitionsFile = AppSettings::getInstance()->getConnectionDefinitionsFile();
     mConnectionInputFile = AppSettings::getInstance()->getConnectionInputFile();
     mLabellingOutputFile = AppSettings::getInstance()->getLabellingOutputFile();
-    mParsingErrorsFile = AppSettings::getInstance()->getParsingErrorsFile();
+    mParsingErrorsFile = !mParsingErrorsFileArgument.empty() ? mParsingErrorsFileArgument : AppSettings::getInstance()->getParsingErrorsFile();
 }
 
 void Application::_retrieveDirPaths()
@@ -167,6 +703,7 @@ void Application::_retrieveDirPaths()
 
 bool Application::_setDirectories()
 {
+    const bool c_AreBackupDirsRequired{_areBackupDirsRequired()};
     bool success{_setDirectory(mAppDataDir)};
 
     if (!success)
@@ -174,7 +711,7 @@ bool Application::_setDirectories()
         mStatusCode = StatusCode::APP_DATA_DIR_NOT_SETUP;
     }
 
-    if (success)
+    if (success && c_AreBackupDirsRequired)
     {
         success = _setDirectory(mInputBackupDir);
 
@@ -184,7 +721,7 @@ bool Application::_setDirectories()
         }
     }
 
-    if (success)
+    if (success && c_AreBackupDirsRequired)
     {
         success = _setDirectory(mOutputBackupDir);
 
@@ -227,30 +764,65 @@ bool Application::_setDirectory(const Core::Path_t& dirPath)
     return success;
 }
 
+/* The example files already copied are kept (they might have been edited by user), only the missing ones are copied
+*/
 void Application::_copyExamplesDir()
 {
     const Core::Path_t c_AppExamplesDir{AppSettings::getInstance()->getAppExamplesDir()};
     const Core::Path_t c_AppDataExamplesDir{AppSettings::getInstance()->getAppDataExamplesDir()};
 
-    if (std::filesystem::exists(c_AppExamplesDir) && std::filesystem::is_directory(c_AppExamplesDir) && !std::filesystem::exists(c_AppDataExamplesDir))
+    std::error_code errorCode;
+
+    if (!c_AppExamplesDir.empty() && std::filesystem::is_directory(c_AppExamplesDir, errorCode))
+    {
+        std::filesystem::copy(c_AppExamplesDir, c_AppDataExamplesDir, std::filesystem::copy_options::recursive | std::filesystem::copy_options::skip_existing, errorCode);
+        mStatusCode = !errorCode ? StatusCode::SUCCESS : StatusCode::EXAMPLES_NOT_COPIED;
+    }
+    else
+    {
+        mStatusCode = StatusCode::EXAMPLES_NOT_COPIED;
+    }
+}
+
+/* The input file is hashed before being parsed so the saved stamp never describes input content that was not used for writing the output
+*/
+bool Application::_checkOutputUpToDate()
+{
+    mIsOutputUpToDate = false;
+
+    // option 3 always rewrites the connection definitions file
+    if (mIsCSVParsingRequired)
     {
-        std::filesystem::copy(c_AppExamplesDir, c_AppDataExamplesDir, std::filesystem::copy_options::recursive);
+        mpOutputStamp = std::make_shared<OutputStamp>(mParserType, _getInputFile(), _getOutputFile());
+        // requesting the labels to be spooled means they should be printed (again), while requesting reports or the duplicates check means they should be (re)written or run
+        mIsOutputUpToDate = mpOutputStamp->load() && !mIsFullProcessingRequired && mLabelSpoolDirArgument.empty() && mReportTypes.empty() && !mIsConflictCheckRequired &&
+                            mpOutputStamp->isOutputUpToDate();
     }
+
+    return mIsOutputUpToDate;
 }
 
+/* The output and error files are written to the run directory and only published when the run ends, so concurrent runs don't overwrite each other's files while writing them
+*/
 void Application::_enableFileInputOutput()
 {
     if (mIsInitialized && !mIsFileIOEnabled)
     {
-        // move existing output file to the appropriate backup folder to ensure it doesn't get overwritten
-        _moveOutputFileToBackupDir();
+        mpRunWorkspace = std::make_shared<RunWorkspace>(AppSettings::getInstance()->getWorkspaceDir());
 
+        const bool c_IsRunDirCreated{mpRunWorkspace->create()};
         bool isOutputEnabled{false};
 
-        if (mpOutputStream)
+        if (c_IsRunDirCreated && mpOutputStream && mpErrorStream)
         {
-            mpOutputStream->open(_getOutputFile());
-            isOutputEnabled = mpOutputStream->is_open();
+            // when validating only the error file might get written
+            if (!mIsValidationRequired)
+            {
+                mpOutputStream->open(mpRunWorkspace->getRunFile(_getOutputFile()));
+            }
+
+            mpErrorStream->setFile(mpRunWorkspace->getRunFile(mParsingErrorsFile));
+            isOutputEnabled = mIsValidationRequired || mpOutputStream->isOpen();
         }
 
         // for option 3 output enabling is sufficient (no input is required)
@@ -258,10 +830,15 @@ void Application::_enableFileInputOutput()
         {
             mIsFileIOEnabled = !mIsCSVParsingRequired;
         }
-        else
+        else if (c_IsRunDirCreated)
         {
             mStatusCode = StatusCode::OUTPUT_FILE_NOT_OPENED;
         }
+        else
+        {
+            mStatusCode = StatusCode::WORKSPACE_DIR_NOT_SETUP;
+            mpRunWorkspace.reset();
+        }
 
         // for options 1 and 2 input should be enabled as well
         if (isOutputEnabled && mIsCSVParsingRequired)
@@ -271,7 +848,7 @@ void Application::_enableFileInputOutput()
             if (mpInputStream)
             {
                 mpInputStream->open(_getInputFile());
-                isInputEnabled = mpInputStream->is_open();
+                isInputEnabled = mpInputStream->isOpen();
             }
 
             mIsFileIOEnabled = isInputEnabled;
@@ -284,32 +861,72 @@ void Application::_enableFileInputOutput()
     }
 }
 
-void Application::_moveOutputFileToBackupDir()
+/* The published files are locked while being replaced so the backup and replacement steps of concurrent runs don't interleave (the run publishing last wins)
+   As for writing the files in place, the previous output file does not survive a run: it is moved to the backup directory (data files) or overwritten/removed (file provided as argument)
+   A validation run leaves the output file untouched, only the error file being published (if parsing errors occurred)
+   A partial output (valid rows labelled despite parsing errors) is published together with the error file
+   A failure to spool the labels or to write the reports does not affect the output file, which is published (and stamped) as for a successful run
+*/
+void Application::_publishRunFiles()
 {
     const Core::Path_t c_OutputFile{_getOutputFile()};
+    const Core::FileLock c_OutputFileLock{mpRunWorkspace->getLockFile(c_OutputFile)};
 
-    if (!c_OutputFile.empty() && std::filesystem::exists(c_OutputFile))
-    {
-        const Core::Path_t c_BackupDir{c_OutputFile == mLabellingOutputFile ? mOutputBackupDir : mInputBackupDir};
-
-        if (!c_BackupDir.empty() && std::filesystem::exists(c_BackupDir) && std::filesystem::is_directory(c_BackupDir))
-        {
-            Core::Path_t movedOutputFile{c_BackupDir};
+    mpOutputStream->close();
+    mpErrorStream->close();
 
-            // prepend timestamp (current date/time) to output file name in order to differentiate it from other files stored in the backup dir
-            movedOutputFile /= Core::getDateTimeString(std::chrono::system_clock::now());
-            movedOutputFile += "_";
-            movedOutputFile += c_OutputFile.filename();
+    if (!mIsValidationRequired)
+    {
+        _moveOutputFileToBackupDir();
+    }
 
-            // on Windows if the file is open an exception occurs when attempting to move it, this needs to be caught
-            try
-            {
-                std::filesystem::rename(c_OutputFile, movedOutputFile);
-            }
-            catch (const std::filesystem::filesystem_error& err)
+    if (_isOutputValid() && !mIsValidationRequired && (mpOutputStream->fail() || !mpRunWorkspace->publish(c_OutputFile)))
+    {
+        mStatusCode = StatusCode::OUTPUT_FILE_NOT_OPENED;
+    }
+    else if (_isOutputValid() && mpOutputStamp)
+    {
+        (void)mpOutputStamp->save();
+    }
+    else if (StatusCode::PARSING_ERROR == mStatusCode && !mpRunWorkspace->publish(mParsingErrorsFile))
+    {
+        mStatusCode = StatusCode::ERROR_FILE_NOT_OPENED;
+    }
+    else if (StatusCode::PARSING_ERROR == mStatusCode && mIsPartialOutputWritten)
+    {
+        // the error file is already published so the errors are reported even if the partial output is not
+        mIsPartialOutputWritten = !mpOutputStream->fail() && mpRunWorkspace->publish(c_OutputFile);
+    }
+
+    mIsPartialOutputWritten = mIsPartialOutputWritten && StatusCode::PARSING_ERROR == mStatusCode;
+
+    if (!_isOutputValid() && !mIsPartialOutputWritten && !mIsValidationRequired)
+    {
+        std::error_code errorCode;
+        (void)std::filesystem::remove(c_OutputFile, errorCode);
+    }
+
+    // the run directory is no longer required
+    mpRunWorkspace.reset();
+}
+
+void Application::_moveOutputFileToBackupDir()
+{
+    const Core::Path_t c_OutputFile{_getOutputFile()};
+
+    // only the data files from the application data directory are backed up, an output file provided as argument is overwritten
+    if (!c_OutputFile.empty() && mOutputFileArgument.empty() && std::filesystem::exists(c_OutputFile))
+    {
+        const Core::Path_t c_BackupDir{c_OutputFile == mLabellingOutputFile ? mOutputBackupDir : mInputBackupDir};
+
+        if (!c_BackupDir.empty() && std::filesystem::exists(c_BackupDir) && std::filesystem::is_directory(c_BackupDir))
+        {
+            BackupStore backupStore{c_BackupDir, BackupStore::readSettings(AppSettings::getInstance()->getBackupSettingsFile())};
+
+            if (!backupStore.moveFile(c_OutputFile))
             {
                 std::cerr << "An error occurred when attempting to move the existing output file to the backup directory\n";
-                std::cerr << "More details: \n" << err.what() << "\nPath1:" << err.path1() << "\nPath2:" << err.path2() << "\nError code: " << err.code() << "\n";
+                std::cerr << "Output file: " << c_OutputFile.string() << "\nBackup directory: " << c_BackupDir.string() << "\n";
             }
         }
         else
@@ -357,6 +974,223 @@ bool Application::_handleUserInput()
     return validInputProvided;
 }
 
+bool Application::_handleArguments(const std::vector<std::string_view>& arguments)
+{
+    const size_t c_ArgumentsCount{arguments.size()};
+
+    // batch and load test modes: the operation to be performed follows the mode keyword
+    mIsBatchMode = c_ArgumentsCount > 0u && "batch" == arguments[0];
+    mIsLoadTestMode = c_ArgumentsCount > 0u && "loadtest" == arguments[0];
+
+    const size_t c_CommandIndex{mIsBatchMode || mIsLoadTestMode ? 1u : 0u};
+    bool areArgumentsValid{c_CommandIndex < c_ArgumentsCount};
+
+    if (areArgumentsValid)
+    {
+        if (const std::string_view c_Command{arguments[c_CommandIndex]}; "define" == c_Command)
+        {
+            mParserType = ParserCreator::ParserTypes::CONNECTION_DEFINITION;
+        }
+        else if ("label" == c_Command)
+        {
+            mParserType = ParserCreator::ParserTypes::CONNECTION_INPUT;
+        }
+        else if ("reset" == c_Command && 0u == c_CommandIndex)
+        {
+            mIsCSVParsingRequired = false;
+        }
+        else if ("watch" == c_Command && 0u == c_CommandIndex)
+        {
+            mIsWatchMode = true;
+        }
+        else if ("serve" == c_Command && 0u == c_CommandIndex)
+        {
+            mIsServiceMode = true;
+        }
+        else if ("restore" == c_Command && 0u == c_CommandIndex)
+        {
+            mIsRestoreMode = true;
+        }
+        else if ("examples" == c_Command && 0u == c_CommandIndex)
+        {
+            mIsExamplesCopyRequired = true;
+        }
+        else if (("help" == c_Command || "--help" == c_Command || "-h" == c_Command) && 0u == c_CommandIndex)
+        {
+            mStatusCode = StatusCode::HELP_REQUESTED;
+        }
+        else
+        {
+            areArgumentsValid = false;
+        }
+    }
+
+    for (size_t argumentIndex{c_CommandIndex + 1}; areArgumentsValid && StatusCode::HELP_REQUESTED != mStatusCode && argumentIndex < c_ArgumentsCount; ++argumentIndex)
+    {
+        const std::string_view c_Option{arguments[argumentIndex]};
+        const bool c_IsValueProvided{argumentIndex + 1 < c_ArgumentsCount && !arguments[argumentIndex + 1].empty()};
+        Core::Path_t* pFileArgument{nullptr};
+
+        if ("--quiet" == c_Option)
+        {
+            mIsQuiet = true;
+        }
+        else if ("--startup-time" == c_Option)
+        {
+            mIsStartupTimeRequired = true;
+        }
+        else if ("--full" == c_Option && ParserCreator::ParserTypes::UNKNOWN != mParserType && !mIsLoadTestMode)
+        {
+            mIsFullProcessingRequired = true;
+        }
+        else if ("--in" == c_Option && !mIsServiceMode && !mIsRestoreMode && !mIsExamplesCopyRequired)
+        {
+            pFileArgument = &mInputFileArgument;
+        }
+        else if ("--out" == c_Option && !mIsWatchMode && !mIsServiceMode && !mIsLoadTestMode && !mIsExamplesCopyRequired)
+        {
+            pFileArgument = &mOutputFileArgument;
+        }
+        else if ("--errors" == c_Option && !_isMultiRackMode() && !mIsRestoreMode && !mIsExamplesCopyRequired)
+        {
+            pFileArgument = &mParsingErrorsFileArgument;
+        }
+        else if ("--validate" == c_Option && ParserCreator::ParserTypes::UNKNOWN != mParserType && !_isMultiRackMode())
+        {
+            mIsValidationRequired = true;
+        }
+        else if ("--summary" == c_Option && (mIsBatchMode || (ParserCreator::ParserTypes::UNKNOWN != mParserType && !mIsLoadTestMode)))
+        {
+            pFileArgument = &mSummaryFileArgument;
+        }
+        else if ("--socket" == c_Option && (mIsServiceMode || mIsLoadTestMode))
+        {
+            pFileArgument = &mServiceSocketFileArgument;
+        }
+        else if ("--jobs" == c_Option && (mIsBatchMode || mIsServiceMode || mIsLoadTestMode) && c_IsValueProvided &&
+                 Core::isDigitString(arguments[argumentIndex + 1]) && arguments[argumentIndex + 1].size() <= scMaxJobsCountDigits)
+        {
+            mWorkersCount = std::stoul(std::string{arguments[++argumentIndex]});
+            areArgumentsValid = mWorkersCount > 0u;
+        }
+        else if ("--format" == c_Option && mIsBatchMode && ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType && c_IsValueProvided)
+        {
+            mBatchFormatArgument = arguments[++argumentIndex];
+            areArgumentsValid = "csv" == mBatchFormatArgument || "xlsx" == mBatchFormatArgument || "jsonl" == mBatchFormatArgument || "bin" == mBatchFormatArgument ||
+                                "zpl" == mBatchFormatArgument || "epl" == mBatchFormatArgument;
+        }
+        else if ("--spool" == c_Option && ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType && !mIsWatchMode && !mIsServiceMode && !mIsLoadTestMode)
+        {
+            pFileArgument = &mLabelSpoolDirArgument;
+        }
+        else if ("--report" == c_Option && ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType && !mIsWatchMode && !mIsServiceMode && !mIsLoadTestMode && c_IsValueProvided)
+        {
+            ConnectionReports::ReportType reportType;
+            areArgumentsValid = ConnectionReports::getReportType(arguments[++argumentIndex], reportType);
+
+            if (areArgumentsValid)
+            {
+                mReportTypes.push_back(reportType);
+            }
+        }
+        else if ("--max-errors" == c_Option && ParserCreator::ParserTypes::UNKNOWN != mParserType && !mIsLoadTestMode && c_IsValueProvided &&
+                 Core::isDigitString(arguments[argumentIndex + 1]) && arguments[argumentIndex + 1].size() <= scMaxErrorsCountDigits)
+        {
+            mMaxErrorsCount = std::stoul(std::string{arguments[++argumentIndex]});
+            areArgumentsValid = mMaxErrorsCount > 0u;
+        }
+        else if ("--fail-fast" == c_Option && ParserCreator::ParserTypes::UNKNOWN != mParserType && !mIsLoadTestMode)
+        {
+            mMaxErrorsCount = 1u;
+        }
+        else if ("--aggregate-errors" == c_Option && ParserCreator::ParserTypes::UNKNOWN != mParserType && !mIsLoadTestMode)
+        {
+            mIsErrorReportAggregated = true;
+        }
+        else if ("--check-duplicates" == c_Option && ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType && !mIsWatchMode && !mIsServiceMode && !mIsLoadTestMode)
+        {
+            mIsConflictCheckRequired = true;
+        }
+        else if ("--partial" == c_Option && ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType && !_isMultiRackMode())
+        {
+            mIsPartialOutputRequired = true;
+        }
+        else if ("--io" == c_Option && mIsBatchMode && c_IsValueProvided)
+        {
+            mBatchIOArgument = arguments[++argumentIndex];
+            areArgumentsValid = "blocking" == mBatchIOArgument || "async" == mBatchIOArgument || "threads" == mBatchIOArgument;
+        }
+        else if ("--list" == c_Option && mIsRestoreMode)
+        {
+            mIsBackupListRequired = true;
+        }
+        else if ("--version" == c_Option && mIsRestoreMode && c_IsValueProvided)
+        {
+            mRestoreVersionArgument = arguments[++argumentIndex];
+        }
+        else if (mIsRestoreMode && mRestoreFilenameArgument.empty() && 0u != c_Option.rfind("--", 0) && Core::Path_t{c_Option}.filename() == Core::Path_t{c_Option})
+        {
+            mRestoreFilenameArgument = c_Option; // the backed up file is identified by its name (no path)
+        }
+        else if ("--requests" == c_Option && mIsLoadTestMode && c_IsValueProvided &&
+                 Core::isDigitString(arguments[argumentIndex + 1]) && arguments[argumentIndex + 1].size() <= scMaxRequestsCountDigits)
+        {
+            mLoadTestRequestsCount = std::stoul(std::string{arguments[++argumentIndex]});
+            areArgumentsValid = mLoadTestRequestsCount > 0u;
+        }
+        else
+        {
+            areArgumentsValid = false;
+        }
+
+        if (pFileArgument)
+        {
+            // each file option should be followed by a (non-empty) path
+            if (c_IsValueProvided)
+            {
+                *pFileArgument = arguments[++argumentIndex];
+            }
+            else
+            {
+                areArgumentsValid = false;
+            }
+        }
+    }
+
+    // resetting the connection definitions file requires no input, while the batch mode requires the input directory or manifest and the load test the request input file
+    if (areArgumentsValid && ((!mIsCSVParsingRequired && !mInputFileArgument.empty()) || ((mIsBatchMode || mIsLoadTestMode) && mInputFileArgument.empty())))
+    {
+        areArgumentsValid = false;
+    }
+
+    // validating writes no output (the summary file is only used by the batch and validation modes)
+    if (areArgumentsValid && (mIsValidationRequired ? !mOutputFileArgument.empty() || !mLabelSpoolDirArgument.empty() || !mReportTypes.empty()
+                                                    : !mIsBatchMode && !mSummaryFileArgument.empty()))
+    {
+        areArgumentsValid = false;
+    }
+
+    // a partial output should contain all valid rows, so parsing should not stop at the maximum number of errors
+    if (areArgumentsValid && mIsPartialOutputRequired && (mIsValidationRequired || mMaxErrorsCount > 0u))
+    {
+        areArgumentsValid = false;
+    }
+
+    // restoring requires the name of the backed up file, listing the backups requires nothing else
+    if (areArgumentsValid && mIsRestoreMode && (mIsBackupListRequired ? !mRestoreFilenameArgument.empty() || !mRestoreVersionArgument.empty() || !mOutputFileArgument.empty()
+                                                                      : mRestoreFilenameArgument.empty()))
+    {
+        areArgumentsValid = false;
+    }
+
+    if (!areArgumentsValid)
+    {
+        mStatusCode = StatusCode::INVALID_ARGUMENTS;
+    }
+
+    return areArgumentsValid && StatusCode::HELP_REQUESTED != mStatusCode;
+}
+
 int Application::_handleStatusCode()
 {
     switch(mStatusCode)
@@ -365,7 +1199,38 @@ int Application::_handleStatusCode()
         ASSERT(false, "Undefined application status");
         break;
     case StatusCode::SUCCESS:
-        _displaySuccessMessage(ParserCreator::ParserTypes::CONNECTION_DEFINITION == mParserType);
+        if (!mIsQuiet && mIsBatchMode)
+        {
+            _displayBatchResultMessage();
+        }
+        else if (!mIsQuiet && mIsWatchMode)
+        {
+            std::cout << "\nWatching stopped. Thank you for using LabelCalculator!\n\n";
+        }
+        else if (!mIsQuiet && mIsServiceMode)
+        {
+            std::cout << "\nService stopped (" << mServiceRequestsCount << " requests handled). Thank you for using LabelCalculator!\n\n";
+        }
+        else if (mIsLoadTestMode || mIsRestoreMode)
+        {
+            // load test results, backup list or restored file already displayed
+        }
+        else if (!mIsQuiet && mIsExamplesCopyRequired)
+        {
+            std::cout << "The example files are available in directory: " << AppSettings::getInstance()->getAppDataExamplesDir().string() << "\n\n";
+        }
+        else if (mIsValidationRequired)
+        {
+            _displayValidationSummary();
+        }
+        else if (!mIsQuiet && mIsOutputUpToDate)
+        {
+            _displayUpToDateMessage();
+        }
+        else if (!mIsQuiet)
+        {
+            _displaySuccessMessage(ParserCreator::ParserTypes::CONNECTION_DEFINITION == mParserType);
+        }
         break;
     case StatusCode::INVALID_SETTINGS:
         _displayInvalidSettingsMessage();
@@ -373,6 +1238,7 @@ int Application::_handleStatusCode()
     case StatusCode::APP_DATA_DIR_NOT_SETUP:
     case StatusCode::INPUT_BACKUP_DIR_NOT_SETUP:
     case StatusCode::OUTPUT_BACKUP_DIR_NOT_SETUP:
+    case StatusCode::WORKSPACE_DIR_NOT_SETUP:
         _displayDirectoryNotSetupMessage();
         break;
     case StatusCode::INPUT_FILE_NOT_OPENED:
@@ -384,66 +1250,78 @@ int Application::_handleStatusCode()
         _displayParserNotCreatedMessage();
         break;
     case StatusCode::PARSING_ERROR:
+        if (mIsValidationRequired)
+        {
+            _displayValidationSummary();
+        }
+
         _displayParsingErrorMessage();
         break;
     case StatusCode::ABORTED_BY_USER:
         _displayAbortMessage();
         break;
+    case StatusCode::INVALID_ARGUMENTS:
+        _displayInvalidArgumentsMessage();
+        break;
+    case StatusCode::HELP_REQUESTED:
+        _displayUsage(std::cout);
+        break;
+    case StatusCode::BATCH_RACKS_FAILED:
+        _displayBatchResultMessage();
+        break;
+    case StatusCode::SERVICE_NOT_AVAILABLE:
+        _displayServiceNotAvailableMessage();
+        break;
+    case StatusCode::BACKUP_NOT_RESTORED:
+        _displayBackupNotRestoredMessage();
+        break;
+    case StatusCode::EXAMPLES_NOT_COPIED:
+        _displayExamplesNotCopiedMessage();
+        break;
+    case StatusCode::LABELS_NOT_SPOOLED:
+        _displayLabelsNotSpooledMessage();
+        break;
+    case StatusCode::REPORTS_NOT_WRITTEN:
+        _displayReportsNotWrittenMessage();
+        break;
     }
 
     _removeUnnecessaryFiles();
 
-    // user abort is not considered an error so the success code is returned
-    const int returnCode{StatusCode::ABORTED_BY_USER == mStatusCode ? 0 : static_cast<int>(mStatusCode)};
+    // user abort and help request are not considered errors so the success code is returned
+    const int returnCode{StatusCode::ABORTED_BY_USER == mStatusCode || StatusCode::HELP_REQUESTED == mStatusCode ? 0 : static_cast<int>(mStatusCode)};
 
     return returnCode;
 }
 
 void Application::_removeUnnecessaryFiles()
 {
-    std::vector<Core::Path_t> filesToRemove;
-    filesToRemove.reserve(2u); // maximum number of files to remove is 2: error file and output file
-
-    // the error file should only exist for parsing errors (other errors are displayed in terminal)
-    if (StatusCode::PARSING_ERROR != mStatusCode)
+    // the error file should only exist for parsing errors (other errors are displayed in terminal); in batch/watch mode each rack handles its own files
+    // the output file of a failed run has already been removed when publishing the run files
+    if (!_isMultiRackMode() && StatusCode::PARSING_ERROR != mStatusCode && !mParsingErrorsFile.empty())
     {
-        if(mpErrorStream)
-        {
-            mpErrorStream->close();
-        }
-
-        filesToRemove.push_back(mParsingErrorsFile);
-    }
-
-    // there should be no output file when parsing errors occured or the input file could not be opened for reading
-    if (StatusCode::PARSING_ERROR == mStatusCode || StatusCode::INPUT_FILE_NOT_OPENED == mStatusCode)
-    {
-        if (mpOutputStream)
-        {
-            mpOutputStream->close();
-        }
-
-        filesToRemove.push_back(_getOutputFile());
+        std::error_code errorCode;
+        (void)std::filesystem::remove(mParsingErrorsFile, errorCode);
     }
+}
 
-    for (const auto& path : filesToRemove)
+void Application::_clearScreen() const
+{
+    if (mIsInteractive)
     {
-        if (!path.empty())
-        {
-            std::filesystem::remove(path);
-        }
+        system(scClearScreenCommand.data());
     }
 }
 
-void Application::_displayInvalidSettingsMessage()
+void Application::_displayInvalidSettingsMessage() const
 {
-    system(scClearScreenCommand.data());
+    _clearScreen();
     std::cout << "Invalid settings detected. Please check your system settings and try again\n\n";
 }
 
-void Application::_displayParserNotCreatedMessage()
+void Application::_displayParserNotCreatedMessage() const
 {
-    system(scClearScreenCommand.data());
+    _clearScreen();
     std::cout << "Error in initializing parsing functionality. Application aborted\n\n";
 }
 
@@ -456,25 +1334,178 @@ void Application::_displayMenu()
     std::cout << "Press ENTER to exit the application\n\n";
 }
 
-void Application::_displayGreetingAndVersion()
+void Application::_displayGreetingAndVersion() const
 {
-    system(scClearScreenCommand.data());
+    _clearScreen();
     std::cout << "LabelCalculator v1.1\n\n";
     std::cout << "Hello, " << AppSettings::getInstance()->getUsername() << "!\n\n";
 }
 
-void Application::_displayInvalidInputMessage()
+void Application::_displayInvalidInputMessage() const
 {
-    system(scClearScreenCommand.data());
+    _clearScreen();
     std::cout << "Invalid input. Please try again\n\n";
 }
 
-void Application::_displayAbortMessage()
+void Application::_displayAbortMessage() const
 {
-    system(scClearScreenCommand.data());
+    _clearScreen();
     std::cout << "Application terminated by user\n\n";
 }
 
+void Application::_displayInvalidArgumentsMessage() const
+{
+    std::cerr << "Invalid command line arguments\n\n";
+    _displayUsage(std::cerr);
+}
+
+void Application::_displayUsage(std::ostream& outStream)
+{
+    outStream << "Usage:\n\n";
+    outStream << "LabelCalculator: run interactively (menu)\n";
+    outStream << "LabelCalculator define [--in FILE] [--out FILE] [--errors FILE] [--max-errors N|--fail-fast] [--aggregate-errors] [--full] [--quiet]: same as option 1 (connection definitions to connection input)\n";
+    outStream << "LabelCalculator label [--in FILE] [--out FILE] [--errors FILE] [--spool DIR] [--report bom|portmap|power] [--max-errors N|--fail-fast] [--aggregate-errors] [--check-duplicates] [--full] [--quiet]: same as option 2 (connection input to labelling table)\n";
+    outStream << "LabelCalculator label --partial [--in FILE] [--out FILE] [--errors FILE] [--spool DIR] [--report bom|portmap|power] [--aggregate-errors] [--check-duplicates] [--full] [--quiet]: "
+                 "same as option 2, yet the valid rows are labelled even if parsing errors occur\n";
+    outStream << "LabelCalculator define|label --validate [--in FILE] [--errors FILE] [--summary FILE] [--max-errors N|--fail-fast] [--aggregate-errors] [--check-duplicates] [--quiet]: only check the input file of option 1 or 2 and display the error summary (no output file is written)\n";
+    outStream << "LabelCalculator reset [--out FILE] [--errors FILE] [--quiet]: same as option 3 (empty connection definitions file)\n";
+    outStream << "LabelCalculator batch define|label --in DIR|MANIFEST [--out DIR] [--jobs N] [--summary FILE] [--io blocking|async|threads] [--format csv|xlsx|jsonl|bin|zpl|epl] [--spool DIR] [--report bom|portmap|power] [--max-errors N|--fail-fast] [--aggregate-errors] [--check-duplicates] [--full] [--quiet]: run option 1 or 2 on multiple racks in parallel\n";
+    outStream << "LabelCalculator watch [--in DIR] [--quiet]: process the connection definitions/input files from the directory (default: application data directory) each time they are saved\n";
+    outStream << "LabelCalculator serve [--socket FILE] [--jobs N] [--quiet]: run options 1 and 2 on requests received on a local socket until stopped (default socket: application data directory)\n";
+    outStream << "LabelCalculator loadtest define|label --in FILE [--socket FILE] [--jobs N] [--requests N] [--quiet]: send the input file repeatedly to the service from N concurrent clients\n";
+    outStream << "LabelCalculator restore --list | restore FILENAME [--version TIMESTAMP] [--out FILE] [--quiet]: list the backups or restore a backed up data file (default: latest version)\n";
+    outStream << "LabelCalculator examples [--quiet]: copy the example files into the application data directory (the already copied files are kept)\n";
+    outStream << "LabelCalculator help: display this message\n\n";
+    outStream << "The files that are not provided are the default ones from the application data directory\n";
+    outStream << "Batch/watch mode: each rack input file (e.g. rack01_connectioninput.csv) gets its own output and error files (e.g. rack01_labellingtable.csv, rack01_error.txt)\n";
+    outStream << "Compressed input/output files (gzip: .gz, zstd: .zst) are decompressed/compressed on the fly, e.g. rack01_connectioninput.csv.gz gets rack01_labellingtable.csv.gz in batch mode\n";
+    outStream << "Output formats: the labelling table is written as xlsx (spreadsheet), jsonl (JSON Lines), bin (binary records), zpl or epl (label printer) if its file has this extension (e.g. label --out labellingtable.jsonl) or, for batch label, if requested by --format\n";
+    outStream << "--spool: the labels are also written as label printer jobs (ZPL, or EPL for epl output) split into chunk files within the directory, e.g. labellingtable_0001.zpl (the output is produced even if up to date)\n";
+    outStream << "--report: the labelling table is also summarized as cable bill of materials (bom), port map of each device (portmap) or power connections sheet (power) in the same run, "
+                 "e.g. labellingtable_bom.csv next to the output file (can be repeated, the reports are written concurrently; all connection input rows are labelled)\n";
+    outStream << "--io: batch file I/O, either blocking (default: each worker reads and writes the files of its racks), asynchronous (io_uring if available, otherwise thread pool) or asynchronous by thread pool\n";
+    outStream << "--validate: the input file is read and checked (errors logged to the error file) but no output is built, written or backed up; the summary (rows, errors per error code) "
+                 "is written to the --summary file if provided, the exit code being 0 for a valid input file\n";
+    outStream << "--max-errors: parsing stops once N errors are found, the error file noting that any further errors have been suppressed (--fail-fast: stop at the first error)\n";
+    outStream << "--aggregate-errors: the error file groups the errors by error code and column, listing for each group the number of errors, the row ranges (e.g. rows 2-40512) and the first errors\n";
+    outStream << "--check-duplicates: (label only) the device ports connected on more than one row and the labels calculated for more than one device port are reported as errors, "
+                 "referring to the row of the first occurrence (all connection input rows are labelled)\n";
+    outStream << "--partial: if the connection input file contains errors, the labelling table is still written (together with the error file), each invalid row being marked "
+                 "with the row number instead of its descriptions and labels; the exit code still reports the parsing errors\n";
+    outStream << "--full: process the input file even if unchanged since the previous run and label all connection input rows (by default only the changed rows are labelled again)\n";
+    outStream << "--quiet: only errors are displayed\n";
+    outStream << "--startup-time: display the time spent before the requested operation starts (argument handling and environment setup)\n";
+    outStream << "Environment variable LABELCALCULATOR_WORKSPACE: directory where each run writes its files before publishing them (default: .workspace folder of the application data directory)\n\n";
+}
+
+void Application::_displayBatchResultMessage() const
+{
+    if (StatusCode::SUCCESS == mStatusCode)
+    {
+        std::cout << "All racks processed successfully (" << mBatchRacksCount << " racks)\n\n";
+    }
+    else
+    {
+        std::cerr << "Error! " << mBatchFailedRacksCount << " out of " << mBatchRacksCount << " racks could not be processed.\n\n";
+        std::cerr << "Please check the batch summary and the error files of the failed racks\n\n";
+    }
+}
+
+void Application::_displayServiceNotAvailableMessage() const
+{
+    if (mIsServiceMode)
+    {
+        std::cerr << "Error! The labelling service cannot be started.\n\n";
+        std::cerr << "Socket file: " << _getServiceSocketFile().string() << "\n\n";
+        std::cerr << "Possible reasons:\n";
+        std::cerr << "- another service might already be running on this socket\n";
+        std::cerr << "- the socket path might be too long or the user might not have the required permissions to create it\n\n";
+    }
+    else
+    {
+        std::cerr << "Error! The labelling service is not available or " << (mServiceRequestsCount > 0u ? "some requests failed" : "it could not be reached") << ".\n\n";
+        std::cerr << "Socket file: " << _getServiceSocketFile().string() << "\n\n";
+    }
+}
+
+void Application::_displayBackupNotRestoredMessage() const
+{
+    std::cerr << "Error! The backup of " << mRestoreFilenameArgument << (mRestoreVersionArgument.empty() ? "" : " (version " + mRestoreVersionArgument + ")") << " cannot be restored.\n\n";
+    std::cerr << "Possible reasons:\n";
+    std::cerr << "- no such version exists (run: LabelCalculator restore --list)\n";
+    std::cerr << "- the backup store is damaged or the destination file cannot be written\n\n";
+}
+
+void Application::_displayExamplesNotCopiedMessage() const
+{
+    std::cerr << "Error! The example files cannot be copied to directory: " << AppSettings::getInstance()->getAppDataExamplesDir().string() << "\n\n";
+    std::cerr << "Possible reasons:\n";
+    std::cerr << "- no examples directory found within the Documentation directory located next to the application executable\n";
+    std::cerr << "- the user might not have the required permissions to write the files\n\n";
+}
+
+void Application::_displayLabelsNotSpooledMessage() const
+{
+    _clearScreen();
+    std::cerr << "Error! The labels cannot be written to the spool directory: " << mLabelSpoolDirArgument.string() << "\n\n";
+    std::cerr << "Possible reasons:\n";
+    std::cerr << "- the directory might not exist\n";
+    std::cerr << "- the user might not have the required permissions to write files into it\n\n";
+    std::cerr << "The output file has been written though: " << _getOutputFile().string() << "\n\n";
+}
+
+void Application::_displayReportsNotWrittenMessage() const
+{
+    _clearScreen();
+    std::cerr << "Error! The reports cannot be written next to the output file: " << _getOutputFile().string() << "\n\n";
+    std::cerr << "Possible reasons:\n";
+    std::cerr << "- the user might not have the required permissions to write files into the output directory\n";
+    std::cerr << "- the disk might be full\n\n";
+    std::cerr << "The output file has been written though\n\n";
+}
+
+/* One "key: value" line per item so the summary can be processed by scripts
+*/
+void Application::_displayValidationSummary() const
+{
+    if (!mSummaryFileArgument.empty())
+    {
+        if (std::ofstream summaryStream{mSummaryFileArgument}; summaryStream.is_open())
+        {
+            _writeValidationSummary(summaryStream);
+        }
+        else
+        {
+            std::cerr << "Warning! The validation summary file cannot be opened for writing: " << mSummaryFileArgument.string() << "\n\n";
+        }
+    }
+    else if (!mIsQuiet)
+    {
+        _writeValidationSummary(std::cout);
+        std::cout << "\n";
+    }
+}
+
+void Application::_writeValidationSummary(std::ostream& outStream) const
+{
+    size_t errorsCount{0u};
+
+    for (const auto& [c_ErrorCode, c_Count] : mValidationErrorsCount)
+    {
+        errorsCount += c_Count;
+    }
+
+    outStream << "Input file: " << _getInputFile().string() << "\n";
+    outStream << "Result: " << (StatusCode::SUCCESS == mStatusCode ? "valid" : "invalid") << "\n";
+    outStream << "Rows: " << mValidatedRowsCount << "\n";
+    outStream << "Errors: " << errorsCount << "\n";
+
+    for (const auto& [c_ErrorCode, c_Count] : mValidationErrorsCount)
+    {
+        outStream << "Error code " << c_ErrorCode << " (" << ErrorHandler::getErrorName(c_ErrorCode) << "): " << c_Count << "\n";
+    }
+}
+
 void Application::_displayDirectoryNotSetupMessage() const
 {
     Core::Path_t dirPath;
@@ -494,11 +1525,15 @@ void Application::_displayDirectoryNotSetupMessage() const
         dirPath = mOutputBackupDir;
         dirType = "output backup";
         break;
+    case StatusCode::WORKSPACE_DIR_NOT_SETUP:
+        dirPath = AppSettings::getInstance()->getWorkspaceDir();
+        dirType = "workspace";
+        break;
     default:
         ASSERT(false, "Undefined application status at directory setup");
     }
 
-    system(scClearScreenCommand.data());
+    _clearScreen();
     std::cerr << "Error! The " << dirType << " directory cannot be setup.\n";
     std::cerr << "Path: " << dirPath.string() << "\n\n";
 }
@@ -522,7 +1557,7 @@ void Application::_displayFileOpeningErrorMessage() const
 
     const std::string c_Operation{StatusCode::INPUT_FILE_NOT_OPENED == mStatusCode ? "reading" : "writing"};
 
-    system(scClearScreenCommand.data());
+    _clearScreen();
     std::cerr << "Error! File cannot be opened for " << c_Operation << ".\n\n";
     std::cerr << "File path: "<< file.string() << "\n\n";
     std::cerr << "Possible reasons:\n";
@@ -530,16 +1565,35 @@ void Application::_displayFileOpeningErrorMessage() const
 #ifdef _WIN32
     std::cerr << "- the file might already be open in another process\n";
 #endif
-    std::cerr << "- the user might not have the required permissions to open it\n\n";
+    std::cerr << "- the user might not have the required permissions to open it\n";
+
+    if (Core::CompressionFormat::NONE != Core::getCompressionFormat(file))
+    {
+        std::cerr << "- the compression format (" << file.extension().string() << ") might not be supported by this build\n";
+
+        if (StatusCode::INPUT_FILE_NOT_OPENED == mStatusCode)
+        {
+            std::cerr << "- the compressed content might be corrupt or truncated\n";
+        }
+    }
+
+    std::cerr << "\n";
 }
 
 void Application::_displayParsingErrorMessage() const
 {
-    system(scClearScreenCommand.data());
+    _clearScreen();
 
     std::cerr << "One or more errors occured!\n\n";
     std::cerr << "Please check the error report in the error file: \n\n";
     std::cerr << mParsingErrorsFile.string() << "\n\n";
+
+    if (mIsPartialOutputWritten)
+    {
+        std::cerr << "The valid rows have been labelled anyway, the invalid ones being marked in the output file: \n\n";
+        std::cerr << _getOutputFile().string() << "\n\n";
+    }
+
     std::cerr << "Please correct the input file and then try again\n\n";
     std::cerr << "Input file: \n\n" << _getInputFile().string() << "\n\n";
     std::cerr << "Thank you for using LabelCalculator!\n\n";
@@ -547,7 +1601,7 @@ void Application::_displayParsingErrorMessage() const
 
 void Application::_displaySuccessMessage(bool additionalOutputRequired) const
 {
-    system(scClearScreenCommand.data());
+    _clearScreen();
 
     std::cout << "The program ended succesfully. \n\n";
     std::cout << "Please view the output file: \n\n";
@@ -561,11 +1615,59 @@ void Application::_displaySuccessMessage(bool additionalOutputRequired) const
     std::cout << "Thank you for using LabelCalculator!\n\n";
 }
 
+void Application::_displayUpToDateMessage() const
+{
+    _clearScreen();
+
+    std::cout << "The output file is up to date (the input file and settings did not change since it was written): \n\n";
+    std::cout << _getOutputFile().string() << "\n\n";
+
+    if (!mIsInteractive)
+    {
+        std::cout << "Use the --full option for processing the input file anyway\n\n";
+    }
+
+    std::cout << "Thank you for using LabelCalculator!\n\n";
+}
+
+bool Application::_isMultiRackMode() const
+{
+    return mIsBatchMode || mIsWatchMode || mIsServiceMode || mIsLoadTestMode;
+}
+
+bool Application::_isOutputValid() const
+{
+    return StatusCode::SUCCESS == mStatusCode || StatusCode::LABELS_NOT_SPOOLED == mStatusCode || StatusCode::REPORTS_NOT_WRITTEN == mStatusCode;
+}
+
+bool Application::_areBackupDirsRequired() const
+{
+    const bool c_IsDataFileOverwritten{!_isMultiRackMode() && !mIsRestoreMode && !mIsExamplesCopyRequired && !mIsValidationRequired && mOutputFileArgument.empty()};
+
+    return c_IsDataFileOverwritten || mIsWatchMode || mIsRestoreMode;
+}
+
+bool Application::_isConnectionDefinitionsFileRequired() const
+{
+    const bool c_IsSingleRunRequired{!_isMultiRackMode() && !mIsRestoreMode && !mIsExamplesCopyRequired};
+
+    return mIsInteractive || (c_IsSingleRunRequired && ParserCreator::ParserTypes::CONNECTION_DEFINITION == mParserType && mInputFileArgument.empty());
+}
+
+Core::Path_t Application::_getServiceSocketFile() const
+{
+    return !mServiceSocketFileArgument.empty() ? mServiceSocketFileArgument : mAppDataDir / LabellingService::scDefaultSocketFilename;
+}
+
 Core::Path_t Application::_getInputFile() const
 {
     Core::Path_t inputFile;
 
-    if (ParserCreator::ParserTypes::CONNECTION_DEFINITION == mParserType)
+    if (!mInputFileArgument.empty())
+    {
+        inputFile = mInputFileArgument;
+    }
+    else if (ParserCreator::ParserTypes::CONNECTION_DEFINITION == mParserType)
     {
         inputFile = mConnectionDefinitionsFile;
     }
@@ -585,7 +1687,11 @@ Core::Path_t Application::_getOutputFile() const
 {
     Core::Path_t outputFile;
 
-    if (ParserCreator::ParserTypes::CONNECTION_DEFINITION == mParserType)
+    if (!mOutputFileArgument.empty())
+    {
+        outputFile = mOutputFileArgument;
+    }
+    else if (ParserCreator::ParserTypes::CONNECTION_DEFINITION == mParserType)
     {
         outputFile = mConnectionInputFile;
     }
@@ -606,3 +1712,4 @@ Core::Path_t Application::_getOutputFile() const
 }
 
 std::shared_ptr<Application> Application::s_pApplication = nullptr;
+volatile std::sig_atomic_t Application::s_IsStopRequested = 0;
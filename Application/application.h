@@ -1,14 +1,39 @@
 #ifndef APPLICATION_H
 #define APPLICATION_H
 
+#include <map>
+#include <vector>
+#include <string_view>
+#include <csignal>
+
+#include "lazyfilestream.h"
+#include "compressedfilestream.h"
 #include "parsercreator.h"
 
+class DirectoryWatcher;
+class OutputStamp;
+class RunWorkspace;
+
 class Application
 {
 
 public:
     static std::shared_ptr<Application> getInstance();
-    int run();
+
+    /* Runs the application once and returns the status code
+       If no arguments are provided the interactive menu is displayed, otherwise the requested command is executed without any user interaction (headless mode):
+       define|label|reset [--in FILE] [--out FILE] [--errors FILE] [--max-errors N|--fail-fast] [--aggregate-errors] [--check-duplicates] [--full] [--quiet]
+       label --partial [--in FILE] [--out FILE] [--errors FILE] [--aggregate-errors] [--check-duplicates] [--full] [--quiet]
+       define|label --validate [--in FILE] [--errors FILE] [--summary FILE] [--max-errors N|--fail-fast] [--aggregate-errors] [--check-duplicates] [--quiet]
+       batch define|label --in DIR|MANIFEST [--out DIR] [--jobs N] [--summary FILE] [--io blocking|async|threads] [--max-errors N|--fail-fast] [--aggregate-errors] [--check-duplicates] [--full] [--quiet]
+       watch [--in DIR] [--quiet]
+       serve [--socket FILE] [--jobs N] [--quiet]
+       loadtest define|label --in FILE [--socket FILE] [--jobs N] [--requests N] [--quiet]
+       restore --list | restore FILENAME [--version TIMESTAMP] [--out FILE] [--quiet]
+       examples [--quiet]
+       Any command also accepts --startup-time for displaying the time spent until the operation starts
+    */
+    int run(const std::vector<std::string_view>& arguments = {});
 
 private:
     // underlying type int for compatibility with the main() return type
@@ -25,7 +50,16 @@ private:
         ERROR_FILE_NOT_OPENED,
         PARSER_NOT_CREATED,
         PARSING_ERROR,
-        ABORTED_BY_USER
+        ABORTED_BY_USER,
+        INVALID_ARGUMENTS,
+        HELP_REQUESTED,
+        BATCH_RACKS_FAILED,
+        SERVICE_NOT_AVAILABLE,
+        BACKUP_NOT_RESTORED,
+        EXAMPLES_NOT_COPIED,
+        WORKSPACE_DIR_NOT_SETUP,
+        LABELS_NOT_SPOOLED,
+        REPORTS_NOT_WRITTEN
     };
 
     /* Private constructor (singleton)
@@ -36,6 +70,37 @@ private:
     */
     void _parseInput();
 
+    /* This function runs the requested parsing operation on all racks from the input directory/manifest (batch mode) and writes the summary report
+    */
+    void _processBatch();
+
+    /* This function watches the data directory (or the directory provided as argument) until stopped by user (Ctrl+C)
+       Each time a connection definitions/input file changes the corresponding operation (option 1/2) is run on it (only for the racks whose files changed)
+    */
+    void _processWatch();
+
+    /* Runs the operation on the changed files of the watched directory and returns the successfully written output files
+    */
+    std::vector<Core::Path_t> _processWatchedRacks(const ParserCreator::ParserTypes parserType, const std::vector<Core::Path_t>& inputFiles, DirectoryWatcher& directoryWatcher);
+
+    /* This function runs the labelling service until stopped by user (Ctrl+C or SIGTERM)
+    */
+    void _processServiceRequests();
+
+    /* This function sends the input file repeatedly to the running labelling service and displays the throughput and latency
+    */
+    void _processLoadTest();
+
+    /* This function lists the versions stored in the input and output backup directories or restores one of them
+       Unless another output file is provided, the restored file replaces the data file with the same name (which is backed up first)
+    */
+    void _processRestore();
+
+    /* Installs (or removes) the signal handlers used for stopping the watch and service modes
+    */
+    static void _enableStopRequests(const bool enable);
+    static void _requestStop(int);
+
     /* This function initializes the application no matter which option is chosen (define connections, process connection input from user)
     */
     void _init();
@@ -54,6 +119,7 @@ private:
     void _retrieveDirPaths();
 
     /* This function creates the required directories or confirms their existence if they are already available
+       The backup directories are only setup for the operations that might read or write backups
     */
     bool _setDirectories();
 
@@ -61,14 +127,23 @@ private:
     */
     static bool _setDirectory(const Core::Path_t& dirPath);
 
-    /* This function copies the example files directory from application folder into application data directory
+    /* This function copies the example files directory from application folder into application data directory (only on request, not at each startup)
     */
-    static void _copyExamplesDir();
+    void _copyExamplesDir();
 
-    /* This function opens the input and output files for each of the options
+    /* This function hashes the input file and checks whether the output file written by a previous run is still up to date (options 1 and 2)
+       If so, no parsing, writing or backup is required
+    */
+    bool _checkOutputUpToDate();
+
+    /* This function creates the run directory and opens the input and output files for each of the options
     */
     void _enableFileInputOutput();
 
+    /* This function moves the output file (or the error file if parsing errors occurred) from the run directory to its final location
+    */
+    void _publishRunFiles();
+
     /* This function moves the output file to corresponding backup dir
        Any data csv file can be an output file depending on operation chosen by user
     */
@@ -78,6 +153,11 @@ private:
     */
     bool _handleUserInput();
 
+    /* This function takes over the command line arguments (headless mode) and sets the parser type and the requested file paths
+       Returns false if the application should not proceed further (invalid arguments or help requested), the status code being set accordingly
+    */
+    bool _handleArguments(const std::vector<std::string_view>& arguments);
+
     /* This function displays a message for each resulting status code.
        It also determines the return code of the application.
        The goal of this method is to avoid spreading output messages among functions and to consolidate them instead.
@@ -89,23 +169,49 @@ private:
     void _removeUnnecessaryFiles();
 
     /* Output methods */
-    static void _displayInvalidSettingsMessage();
-    static void _displayParserNotCreatedMessage();
+    void _clearScreen() const;
+    void _displayInvalidSettingsMessage() const;
+    void _displayParserNotCreatedMessage() const;
+    void _displayGreetingAndVersion() const;
+    void _displayInvalidInputMessage() const;
+    void _displayAbortMessage() const;
+    void _displayInvalidArgumentsMessage() const;
+    void _displayBatchResultMessage() const;
+    void _displayServiceNotAvailableMessage() const;
+    void _displayBackupNotRestoredMessage() const;
+    void _displayExamplesNotCopiedMessage() const;
+    void _displayLabelsNotSpooledMessage() const;
+    void _displayReportsNotWrittenMessage() const;
+    void _displayValidationSummary() const;
+    void _writeValidationSummary(std::ostream& outStream) const;
     static void _displayMenu();
-    static void _displayGreetingAndVersion();
-    static void _displayInvalidInputMessage();
-    static void _displayAbortMessage();
+    static void _displayUsage(std::ostream& outStream);
     void _displayDirectoryNotSetupMessage() const;
     void _displayFileOpeningErrorMessage() const;
     void _displayParsingErrorMessage() const;
     void _displaySuccessMessage(bool additionalOutputRequired) const;
+    void _displayUpToDateMessage() const;
+
+    /* Batch, watch and service modes process multiple racks, each one having its own files or buffers (the default error file is not used) */
+    bool _isMultiRackMode() const;
+
+    /* The output file is complete, the run either succeeded or only failed to spool the labels or to write the reports (which doesn't affect the output) */
+    bool _isOutputValid() const;
+
+    /* The backup directories are required by the interactive mode, by the single file operations writing to the data files, by the watch mode and for restoring backups */
+    bool _areBackupDirsRequired() const;
+
+    /* The empty connection definitions file is only created for the operations that might read it: the interactive mode (option 1 not chosen yet) and option 1 without input file argument */
+    bool _isConnectionDefinitionsFileRequired() const;
 
     /* Getters */
     Core::Path_t _getInputFile() const;
     Core::Path_t _getOutputFile() const;
+    Core::Path_t _getServiceSocketFile() const;
 
     /* Attributes */
     static std::shared_ptr<Application> s_pApplication;
+    static volatile std::sig_atomic_t s_IsStopRequested;
 
 #if defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
 static constexpr std::string_view scClearScreenCommand{"clear"};
@@ -124,13 +230,68 @@ static constexpr std::string_view scClearScreenCommand{"cls"};
     Core::Path_t mLabellingOutputFile;
     Core::Path_t mParsingErrorsFile;
 
-    const Core::InputStreamPtr mpInputStream;
-    const Core::OutputStreamPtr mpOutputStream;
-    const Core::ErrorStreamPtr mpErrorStream;
+    // file paths provided as command line arguments (headless mode), these replace the default data files from the application data directory
+    Core::Path_t mInputFileArgument;
+    Core::Path_t mOutputFileArgument;
+    Core::Path_t mParsingErrorsFileArgument;
+    Core::Path_t mSummaryFileArgument;
+    Core::Path_t mServiceSocketFileArgument;
+    Core::Path_t mLabelSpoolDirArgument;
+    std::string mRestoreFilenameArgument;
+    std::string mRestoreVersionArgument;
+    std::string mBatchIOArgument;
+    std::string mBatchFormatArgument;
+
+    // reports requested for the labelling table (--report), in the order of the arguments
+    std::vector<ConnectionReports::ReportType> mReportTypes;
+
+    static constexpr size_t scMaxJobsCountDigits{4u};
+    static constexpr size_t scMaxRequestsCountDigits{7u};
+    static constexpr size_t scMaxErrorsCountDigits{7u};
+    static constexpr size_t scDefaultLoadTestRequestsCount{1000u};
+
+    // compressed (.gz, .zst) input and output files are decompressed/compressed on the fly
+    const Core::DecompressingInputStreamPtr mpInputStream;
+    const Core::CompressingOutputStreamPtr mpOutputStream;
+    const Core::LazyFileStreamPtr mpErrorStream;     // the error file is only created if errors occur
+
+    // records the input the output file has been written from (options 1 and 2)
+    std::shared_ptr<OutputStamp> mpOutputStamp;
+
+    // private directory where the output and error files are written before being published
+    std::shared_ptr<RunWorkspace> mpRunWorkspace;
 
     bool mIsInitialized;
     bool mIsFileIOEnabled;
     bool mIsCSVParsingRequired;
+    bool mIsInteractive;    // false in headless mode: no menu, no screen clearing (and hence no shell invocations)
+    bool mIsQuiet;          // headless mode only: the success messages are no longer displayed (errors still are)
+    bool mIsBatchMode;      // headless mode only: the input/output arguments are directories (or input manifest), each rack is processed separately
+    bool mIsWatchMode;      // headless mode only: the input argument is the watched directory
+    bool mIsServiceMode;    // headless mode only: the requests are received on a local socket
+    bool mIsLoadTestMode;   // headless mode only: the input file is sent repeatedly to the service
+    bool mIsRestoreMode;    // headless mode only: a backed up file is restored (or the backups are listed)
+    bool mIsExamplesCopyRequired;   // headless mode only: the example files are copied into the application data directory
+    bool mIsStartupTimeRequired;    // headless mode only
+    bool mIsBackupListRequired;
+    bool mIsFullProcessingRequired;    // headless mode only: the input is processed even if unchanged, for option 2 the labelling index of the previous run is ignored too
+    bool mIsOutputUpToDate;            // options 1 and 2: input and settings unchanged since the output file was written, nothing to do
+    bool mIsValidationRequired;        // headless mode only (options 1 and 2): the input file is only checked, no output file is written, backed up or stamped
+    bool mIsErrorReportAggregated;     // headless mode only (options 1 and 2): the parsing errors are grouped by error code and column in the error file
+    bool mIsPartialOutputRequired;     // headless mode only (option 2): the valid rows are labelled even if parsing errors occurred
+    bool mIsPartialOutputWritten;      // parsing errors occurred, yet the labelling table has been written (the invalid rows being marked)
+    bool mIsConflictCheckRequired;     // headless mode only (option 2): the device ports used on more than one row and the duplicate labels are reported as parsing errors
+
+    size_t mWorkersCount;           // batch/service: worker threads, load test: concurrent clients (0: hardware concurrency)
+    size_t mBatchRacksCount;
+    size_t mBatchFailedRacksCount;
+    size_t mServiceRequestsCount;   // handled by service or sent by load test
+    size_t mLoadTestRequestsCount;
+    size_t mValidatedRowsCount;
+    size_t mMaxErrorsCount;         // options 1 and 2: parsing stops once this number of errors is reached (0: no limit)
+
+    // parsing errors of the validated input file, per error code
+    std::map<Core::Error_t, size_t> mValidationErrorsCount;
 
     StatusCode mStatusCode;
 };
@@ -0,0 +1,26 @@
+#include "iouringfileio.h"
+#include "threadpoolfileio.h"
+
+std::unique_ptr<AsyncFileIO> AsyncFileIO::create(const size_t threadsCount, const bool isIoUringPreferred)
+{
+    std::unique_ptr<AsyncFileIO> pFileIO;
+
+#ifdef IO_URING_AVAILABLE
+    if (isIoUringPreferred)
+    {
+        if (std::unique_ptr<IoUringFileIO> pIoUringFileIO{std::make_unique<IoUringFileIO>()}; pIoUringFileIO->isSetup())
+        {
+            pFileIO = std::move(pIoUringFileIO);
+        }
+    }
+#else
+    (void)isIoUringPreferred;
+#endif
+
+    if (!pFileIO)
+    {
+        pFileIO = std::make_unique<ThreadPoolFileIO>(threadsCount);
+    }
+
+    return pFileIO;
+}
@@ -0,0 +1,40 @@
+#ifndef ASYNCFILEIO_H
+#define ASYNCFILEIO_H
+
+#include <future>
+#include <optional>
+
+#include "coreutils.h"
+
+namespace Core = Utilities::Core;
+
+/* Asynchronous whole-file reading and writing, used by the batch mode for overlapping the file operations of the racks with their parsing
+   The requests are queued and handled in the background, their results being provided as futures. Two backends are available:
+   - io_uring (Linux): the open/read/write/close/rename operations of all queued requests are submitted and completed in batches by a single I/O thread
+   - thread pool (all platforms, also used if io_uring is not available): each request is handled by a worker thread with blocking calls
+*/
+class AsyncFileIO
+{
+public:
+    using FileContent_t = std::optional<std::string>;
+
+    virtual ~AsyncFileIO() = default;
+
+    /* Returns the io_uring backend if preferred and supported by the kernel, otherwise a thread pool with the given number of threads
+    */
+    static std::unique_ptr<AsyncFileIO> create(const size_t threadsCount, const bool isIoUringPreferred = true);
+
+    /* The whole content is provided once read, no value if the file cannot be read
+    */
+    virtual std::future<FileContent_t> readFile(const Core::Path_t& file) = 0;
+
+    /* The content is written to a temporary file which then replaces the given file (so the file is either the previous or the complete new one)
+       For compressed files (.gz, .zst) the content is compressed by the backend thread(s) before being written
+       Provides false if the file cannot be written (in which case the existing file is not changed)
+    */
+    virtual std::future<bool> writeFile(const Core::Path_t& file, std::string content) = 0;
+
+    virtual std::string_view getBackendName() const = 0;
+};
+
+#endif // ASYNCFILEIO_H
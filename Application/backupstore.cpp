@@ -0,0 +1,720 @@
+#include <algorithm>
+#include <charconv>
+#include <set>
+#include <unordered_set>
+#include <cctype>
+
+#ifdef ZLIB_AVAILABLE
+#include <zlib.h>
+#endif
+
+#include "applicationdata.h"
+#include "filelock.h"
+#include "backupstore.h"
+
+BackupStore::BackupStore(const Core::Path_t& backupDir, const Settings_t& settings)
+    : mBackupDir{backupDir}
+    , mIndexFile{backupDir / scIndexFilename}
+    , mLockFile{backupDir / scLockFilename}
+    , mSettings{settings}
+{
+}
+
+bool BackupStore::moveFile(const Core::Path_t& file)
+{
+    std::lock_guard<std::mutex> lock{mStoreMutex};
+    const Core::FileLock c_StoreLock{mLockFile};
+
+    bool success{false};
+    std::string content;
+
+    if (std::ifstream fileStream{file, std::ios::binary}; fileStream.is_open())
+    {
+        content.assign(std::istreambuf_iterator<char>{fileStream}, std::istreambuf_iterator<char>{});
+        success = !fileStream.bad() && _load();
+    }
+
+    if (success)
+    {
+        const std::string c_Filename{file.filename().string()};
+        Version_t version{_getUniqueTimestamp(c_Filename, Core::getDateTimeString(std::chrono::system_clock::now())), c_Filename, content.size(), Core::getHash64(content), {}};
+
+        const auto c_LatestVersionIt{std::find_if(mVersions.crbegin(), mVersions.crend(), [&version](const Version_t& element) {return version.mFilename == element.mFilename;})};
+
+        // backing up the same content again would only add a duplicate version
+        if (const bool c_IsDuplicate{mVersions.crend() != c_LatestVersionIt && version.mSize == c_LatestVersionIt->mSize && version.mContentHash == c_LatestVersionIt->mContentHash};
+            !c_IsDuplicate)
+        {
+            for (const auto& c_Chunk : _splitIntoChunks(content))
+            {
+                const std::uint64_t c_ChunkHash{Core::getHash64(c_Chunk)};
+
+                success = success && _storeChunk(c_ChunkHash, c_Chunk);
+                version.mChunkHashes.push_back(c_ChunkHash);
+            }
+
+            success = success && _appendVersion(version);
+
+            if (success)
+            {
+                (void)_applyRetention(version.mFilename);
+            }
+        }
+    }
+
+    if (success)
+    {
+        std::error_code errorCode;
+        std::filesystem::remove(file, errorCode);
+        success = !errorCode;
+    }
+
+    return success;
+}
+
+std::vector<BackupStore::Version_t> BackupStore::getVersions()
+{
+    std::lock_guard<std::mutex> lock{mStoreMutex};
+    const Core::FileLock c_StoreLock{mLockFile};
+
+    (void)_load();
+
+    return mVersions;
+}
+
+bool BackupStore::restoreFile(const std::string_view filename, const std::string_view timestamp, const Core::Path_t& destinationFile)
+{
+    std::lock_guard<std::mutex> lock{mStoreMutex};
+    const Core::FileLock c_StoreLock{mLockFile};
+
+    bool success{false};
+    std::string content;
+
+    (void)_load();
+
+    const auto c_IsRequestedVersion{[filename, timestamp](const Version_t& element) {
+        return filename == element.mFilename && (timestamp.empty() || timestamp == element.mTimestamp);
+    }};
+
+    const auto c_VersionIt{std::find_if(mVersions.crbegin(), mVersions.crend(), c_IsRequestedVersion)};
+
+    // timestamps are unique per file once loaded, yet a version that cannot be identified should never be restored in place of another one
+    if (!timestamp.empty() && std::count_if(mVersions.cbegin(), mVersions.cend(), c_IsRequestedVersion) > 1)
+    {
+        std::cerr << "Warning! Multiple backup versions of " << filename << " have the timestamp " << timestamp << ", none of them is restored\n";
+    }
+    else if (mVersions.crend() != c_VersionIt)
+    {
+        std::string chunk;
+
+        content.reserve(static_cast<size_t>(c_VersionIt->mSize));
+        success = true;
+
+        for (const auto c_ChunkHash : c_VersionIt->mChunkHashes)
+        {
+            success = success && _readChunk(c_ChunkHash, chunk);
+            content += chunk;
+        }
+
+        // the rebuilt content is checked as a whole too (e.g. a chunk might be missing from the index row)
+        success = success && content.size() == c_VersionIt->mSize && Core::getHash64(content) == c_VersionIt->mContentHash;
+    }
+
+    if (success)
+    {
+        const Core::Path_t c_TemporaryFile{Core::getTemporaryFile(destinationFile)};
+
+        std::ofstream destinationStream{c_TemporaryFile, std::ios::binary};
+        destinationStream.write(content.data(), static_cast<std::streamsize>(content.size()));
+        destinationStream.close();
+
+        std::error_code errorCode;
+
+        if (success = !destinationStream.fail(); success)
+        {
+            std::filesystem::rename(c_TemporaryFile, destinationFile, errorCode);
+            success = !errorCode;
+        }
+
+        if (!success)
+        {
+            (void)std::filesystem::remove(c_TemporaryFile, errorCode);
+        }
+    }
+
+    return success;
+}
+
+BackupStore::Settings_t BackupStore::readSettings(const Core::Path_t& settingsFile)
+{
+    Settings_t settings{scDefaultMaxVersionsCount, 0u, true};
+
+    if (std::ifstream settingsStream{settingsFile}; settingsStream.is_open())
+    {
+        std::string currentRow;
+
+        getline(settingsStream, currentRow); // header is discarded
+
+        while (getline(settingsStream, currentRow))
+        {
+            if (!Core::areParseableCharactersContained(currentRow))
+            {
+                continue;
+            }
+
+            std::string settingName;
+            std::string settingValue;
+
+            const Core::Index_t c_CurrentPosition{Core::readDataField(currentRow, settingName, 0)};
+            (void)Core::readDataField(currentRow, settingValue, c_CurrentPosition);
+
+            Core::convertStringCase(settingValue, false);
+
+            const bool c_IsNumericValue{!settingValue.empty() && settingValue.size() <= 9u && Core::isDigitString(settingValue)};
+
+            if ("max_versions" == settingName && c_IsNumericValue)
+            {
+                settings.mMaxVersionsCount = std::stoul(settingValue);
+            }
+            else if ("max_age_days" == settingName && c_IsNumericValue)
+            {
+                settings.mMaxAgeDays = std::stoul(settingValue);
+            }
+            else if ("compression" == settingName && ("on" == settingValue || "off" == settingValue))
+            {
+                settings.mIsCompressionEnabled = "on" == settingValue;
+            }
+            else
+            {
+                std::cerr << "Warning! Invalid backup setting discarded: " << settingName << "\n";
+            }
+        }
+    }
+
+    return settings;
+}
+
+bool BackupStore::isCompressionSupported()
+{
+#ifdef ZLIB_AVAILABLE
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool BackupStore::isEarlierTimestamp(const std::string_view firstTimestamp, const std::string_view secondTimestamp)
+{
+    const int c_DateTimeComparison{firstTimestamp.substr(0, scTimestampLength).compare(secondTimestamp.substr(0, scTimestampLength))};
+
+    return c_DateTimeComparison < 0 || (0 == c_DateTimeComparison && _getSequenceNumber(firstTimestamp) < _getSequenceNumber(secondTimestamp));
+}
+
+/* The index is read again before each operation as other application instances might have changed it in the meantime
+   If there is no index yet, the backups made by previous application versions (timestamp prepended to filename) are imported
+*/
+bool BackupStore::_load()
+{
+    bool success{true};
+
+    mVersions.clear();
+
+    if (std::ifstream indexStream{mIndexFile}; indexStream.is_open())
+    {
+        std::string currentRow;
+
+        getline(indexStream, currentRow); // header is discarded
+
+        while (getline(indexStream, currentRow))
+        {
+            if (Version_t version; _parseVersion(currentRow, version))
+            {
+                mVersions.push_back(std::move(version));
+            }
+            else if (Core::areParseableCharactersContained(currentRow))
+            {
+                std::cerr << "Warning! Invalid backup index row discarded: " << mIndexFile.string() << "\n";
+            }
+        }
+
+        success = !indexStream.bad();
+    }
+    else
+    {
+        _importLegacyBackups();
+    }
+
+    // the index is rewritten so the changed timestamps remain the same for all subsequent operations
+    if (_makeTimestampsUnique())
+    {
+        (void)_saveIndex();
+    }
+
+    return success;
+}
+
+bool BackupStore::_appendVersion(const Version_t& version)
+{
+    std::error_code errorCode;
+    const bool c_IsNewIndex{!std::filesystem::exists(mIndexFile, errorCode)};
+
+    std::ofstream indexStream{mIndexFile, std::ios::app};
+
+    if (c_IsNewIndex)
+    {
+        indexStream << scIndexHeader << "\n";
+    }
+
+    indexStream << _getIndexRow(version) << "\n";
+    indexStream.close();
+
+    const bool c_Success{!indexStream.fail()};
+
+    if (c_Success)
+    {
+        mVersions.push_back(version);
+    }
+
+    return c_Success;
+}
+
+/* The newest versions are kept (the version that has just been added is always kept)
+   Chunks are only removed after the index has been updated so the remaining versions can always be restored
+*/
+bool BackupStore::_applyRetention(const std::string& filename)
+{
+    bool success{true};
+
+    // timestamps have a fixed length format so they can be compared as strings
+    const std::string c_OldestTimestamp{mSettings.mMaxAgeDays > 0u ? Core::getDateTimeString(std::chrono::system_clock::now() - std::chrono::hours{static_cast<std::chrono::hours::rep>(24u * mSettings.mMaxAgeDays)})
+                                                                   : std::string{}};
+
+    std::vector<Version_t> removedVersions;
+    size_t keptVersionsCount{0u};
+
+    for (auto versionIt{mVersions.end()}; versionIt != mVersions.begin();)
+    {
+        --versionIt;
+
+        if (filename != versionIt->mFilename)
+        {
+            continue;
+        }
+
+        const bool c_IsCountExceeded{mSettings.mMaxVersionsCount > 0u && keptVersionsCount >= mSettings.mMaxVersionsCount};
+        const bool c_IsAgeExceeded{!c_OldestTimestamp.empty() && versionIt->mTimestamp < c_OldestTimestamp};
+
+        if (keptVersionsCount > 0u && (c_IsCountExceeded || c_IsAgeExceeded))
+        {
+            removedVersions.push_back(std::move(*versionIt));
+            versionIt = mVersions.erase(versionIt);
+        }
+        else
+        {
+            ++keptVersionsCount;
+        }
+    }
+
+    if (!removedVersions.empty())
+    {
+        success = _saveIndex();
+    }
+
+    if (success && !removedVersions.empty())
+    {
+        std::unordered_set<std::uint64_t> usedChunkHashes;
+
+        for (const auto& c_Version : mVersions)
+        {
+            usedChunkHashes.insert(c_Version.mChunkHashes.cbegin(), c_Version.mChunkHashes.cend());
+        }
+
+        for (const auto& c_Version : removedVersions)
+        {
+            for (const auto c_ChunkHash : c_Version.mChunkHashes)
+            {
+                // a chunk might occur multiple times within the removed versions
+                if (usedChunkHashes.insert(c_ChunkHash).second)
+                {
+                    _removeChunk(c_ChunkHash);
+                }
+            }
+        }
+    }
+
+    return success;
+}
+
+/* The index is written to a temporary file first so an interrupted run doesn't leave a truncated index behind
+*/
+bool BackupStore::_saveIndex() const
+{
+    Core::Path_t temporaryIndexFile{mIndexFile};
+    temporaryIndexFile += ".tmp";
+
+    std::ofstream indexStream{temporaryIndexFile};
+
+    indexStream << scIndexHeader << "\n";
+
+    for (const auto& c_Version : mVersions)
+    {
+        indexStream << _getIndexRow(c_Version) << "\n";
+    }
+
+    indexStream.close();
+
+    bool success{!indexStream.fail()};
+    std::error_code errorCode;
+
+    if (success)
+    {
+        std::filesystem::rename(temporaryIndexFile, mIndexFile, errorCode);
+        success = !errorCode;
+    }
+
+    if (!success)
+    {
+        (void)std::filesystem::remove(temporaryIndexFile, errorCode);
+    }
+
+    return success;
+}
+
+bool BackupStore::_storeChunk(const std::uint64_t chunkHash, const std::string_view chunk) const
+{
+    const bool c_IsCompressed{mSettings.mIsCompressionEnabled && isCompressionSupported()};
+    const Core::Path_t c_ChunkFile{_getChunkFile(chunkHash, c_IsCompressed)};
+
+    std::error_code errorCode;
+    bool success{std::filesystem::exists(c_ChunkFile, errorCode) || std::filesystem::exists(_getChunkFile(chunkHash, !c_IsCompressed), errorCode)};
+
+    if (!success)
+    {
+        std::string_view chunkData{chunk};
+        bool isChunkDataAvailable{true};
+
+#ifdef ZLIB_AVAILABLE
+        std::string compressedChunk;
+
+        if (c_IsCompressed)
+        {
+            uLongf compressedSize{compressBound(static_cast<uLong>(chunk.size()))};
+            compressedChunk.resize(compressedSize);
+
+            isChunkDataAvailable = Z_OK == compress2(reinterpret_cast<Bytef*>(compressedChunk.data()), &compressedSize, reinterpret_cast<const Bytef*>(chunk.data()),
+                                                     static_cast<uLong>(chunk.size()), Z_BEST_SPEED);
+            compressedChunk.resize(isChunkDataAvailable ? compressedSize : 0u);
+            chunkData = compressedChunk;
+        }
+#endif
+
+        Core::Path_t temporaryChunkFile{c_ChunkFile};
+        temporaryChunkFile += ".tmp";
+
+        std::filesystem::create_directories(c_ChunkFile.parent_path(), errorCode);
+
+        std::ofstream chunkStream{temporaryChunkFile, std::ios::binary};
+        chunkStream.write(chunkData.data(), static_cast<std::streamsize>(chunkData.size()));
+        chunkStream.close();
+
+        if (success = isChunkDataAvailable && !chunkStream.fail(); success)
+        {
+            std::filesystem::rename(temporaryChunkFile, c_ChunkFile, errorCode);
+            success = !errorCode;
+        }
+
+        if (!success)
+        {
+            (void)std::filesystem::remove(temporaryChunkFile, errorCode);
+        }
+    }
+
+    return success;
+}
+
+/* The chunk content is checked against its hash, a corrupted chunk is reported as missing
+*/
+bool BackupStore::_readChunk(const std::uint64_t chunkHash, std::string& chunk) const
+{
+    bool success{false};
+
+    chunk.clear();
+
+    for (const bool c_IsCompressed : {true, false})
+    {
+        if (std::ifstream chunkStream{_getChunkFile(chunkHash, c_IsCompressed), std::ios::binary}; !success && chunkStream.is_open())
+        {
+            std::string chunkData{std::istreambuf_iterator<char>{chunkStream}, std::istreambuf_iterator<char>{}};
+
+            if (!c_IsCompressed)
+            {
+                chunk = std::move(chunkData);
+                success = true;
+            }
+#ifdef ZLIB_AVAILABLE
+            else
+            {
+                uLongf chunkSize{static_cast<uLongf>(scMaxChunkSize)};
+                chunk.resize(scMaxChunkSize);
+
+                success = Z_OK == uncompress(reinterpret_cast<Bytef*>(chunk.data()), &chunkSize, reinterpret_cast<const Bytef*>(chunkData.data()),
+                                             static_cast<uLong>(chunkData.size()));
+                chunk.resize(success ? chunkSize : 0u);
+            }
+#endif
+        }
+    }
+
+    if (success && Core::getHash64(chunk) != chunkHash)
+    {
+        success = false;
+    }
+
+    if (!success)
+    {
+        std::cerr << "Warning! Backup chunk missing or corrupted: " << _getChunkFile(chunkHash, false).string() << "\n";
+    }
+
+    return success;
+}
+
+void BackupStore::_removeChunk(const std::uint64_t chunkHash) const
+{
+    std::error_code errorCode;
+
+    for (const bool c_IsCompressed : {true, false})
+    {
+        (void)std::filesystem::remove(_getChunkFile(chunkHash, c_IsCompressed), errorCode);
+    }
+}
+
+/* Previous application versions moved each data file to the backup directory after prepending the timestamp to its name (e.g. 2024-05-01_143000_labellingtable.csv)
+   These files are added to the store (oldest first) and removed once the index is saved
+*/
+void BackupStore::_importLegacyBackups()
+{
+    std::vector<Core::Path_t> legacyBackupFiles;
+    std::error_code errorCode;
+
+    for (const auto& c_Entry : std::filesystem::directory_iterator{mBackupDir, errorCode})
+    {
+        const std::string c_Filename{c_Entry.path().filename().string()};
+
+        if (c_Entry.is_regular_file(errorCode) && c_Filename.size() > scTimestampLength + 1 && '_' == c_Filename[scTimestampLength] &&
+            std::all_of(c_Filename.cbegin(), c_Filename.cbegin() + scTimestampLength, [](const char c) {return std::isdigit(static_cast<unsigned char>(c)) || '-' == c || '_' == c;}))
+        {
+            legacyBackupFiles.push_back(c_Entry.path());
+        }
+    }
+
+    if (!legacyBackupFiles.empty())
+    {
+        bool success{true};
+        std::set<std::string> filenames;
+
+        std::sort(legacyBackupFiles.begin(), legacyBackupFiles.end());
+
+        for (const auto& c_File : legacyBackupFiles)
+        {
+            std::ifstream fileStream{c_File, std::ios::binary};
+            const std::string c_Content{std::istreambuf_iterator<char>{fileStream}, std::istreambuf_iterator<char>{}};
+            const std::string c_BackupFilename{c_File.filename().string()};
+
+            Version_t version{c_BackupFilename.substr(0, scTimestampLength), c_BackupFilename.substr(scTimestampLength + 1), c_Content.size(), Core::getHash64(c_Content), {}};
+
+            const auto c_LatestVersionIt{std::find_if(mVersions.crbegin(), mVersions.crend(), [&version](const Version_t& element) {return version.mFilename == element.mFilename;})};
+
+            success = success && fileStream.is_open() && !fileStream.bad();
+
+            if (success && (mVersions.crend() == c_LatestVersionIt || version.mContentHash != c_LatestVersionIt->mContentHash))
+            {
+                for (const auto& c_Chunk : _splitIntoChunks(c_Content))
+                {
+                    const std::uint64_t c_ChunkHash{Core::getHash64(c_Chunk)};
+
+                    success = success && _storeChunk(c_ChunkHash, c_Chunk);
+                    version.mChunkHashes.push_back(c_ChunkHash);
+                }
+
+                filenames.insert(version.mFilename);
+                mVersions.push_back(std::move(version));
+            }
+        }
+
+        success = success && _saveIndex();
+
+        for (const auto& c_Filename : filenames)
+        {
+            success = success && _applyRetention(c_Filename);
+        }
+
+        if (success)
+        {
+            for (const auto& c_File : legacyBackupFiles)
+            {
+                (void)std::filesystem::remove(c_File, errorCode);
+            }
+        }
+        else
+        {
+            std::cerr << "Warning! The existing backups could not be imported into the backup store: " << mBackupDir.string() << "\n";
+        }
+    }
+}
+
+std::string BackupStore::_getUniqueTimestamp(const std::string& filename, const std::string& timestamp) const
+{
+    size_t maxSequenceNumber{0u};
+
+    for (const auto& c_Version : mVersions)
+    {
+        if (filename == c_Version.mFilename && 0 == c_Version.mTimestamp.compare(0, scTimestampLength, timestamp))
+        {
+            maxSequenceNumber = std::max(maxSequenceNumber, _getSequenceNumber(c_Version.mTimestamp));
+        }
+    }
+
+    return maxSequenceNumber > 0u ? timestamp + scSequenceNumberSeparator + std::to_string(maxSequenceNumber + 1) : timestamp;
+}
+
+bool BackupStore::_makeTimestampsUnique()
+{
+    bool areTimestampsChanged{false};
+    std::set<std::pair<std::string, std::string>> versionIDs;
+
+    for (auto& version : mVersions)
+    {
+        if (!versionIDs.emplace(version.mFilename, version.mTimestamp).second)
+        {
+            version.mTimestamp = _getUniqueTimestamp(version.mFilename, version.mTimestamp.substr(0, scTimestampLength));
+            versionIDs.emplace(version.mFilename, version.mTimestamp);
+            areTimestampsChanged = true;
+        }
+    }
+
+    return areTimestampsChanged;
+}
+
+Core::Path_t BackupStore::_getChunkFile(const std::uint64_t chunkHash, const bool isCompressed) const
+{
+    std::ostringstream chunkName;
+    chunkName << std::hex << std::setfill('0') << std::setw(scHashDigitsCount) << chunkHash;
+
+    const std::string c_ChunkName{chunkName.str()};
+
+    // chunks are spread among 256 subdirectories (first two hash digits) so directory listings remain fast
+    Core::Path_t chunkFile{mBackupDir / scChunksDirName / c_ChunkName.substr(0, 2) / c_ChunkName};
+
+    if (isCompressed)
+    {
+        chunkFile += scCompressedChunkExtension;
+    }
+
+    return chunkFile;
+}
+
+std::vector<std::string_view> BackupStore::_splitIntoChunks(const std::string_view content)
+{
+    std::vector<std::string_view> chunks;
+    size_t chunkBegin{0u};
+
+    for (size_t position{0u}; position < content.size();)
+    {
+        const size_t c_NewlinePosition{content.find('\n', position)};
+        const size_t c_RowEnd{std::min({std::string_view::npos == c_NewlinePosition ? content.size() : c_NewlinePosition + 1, chunkBegin + scMaxChunkSize})};
+        const std::string_view c_Row{content.substr(position, c_RowEnd - position)};
+
+        position = c_RowEnd;
+
+        const size_t c_ChunkSize{position - chunkBegin};
+
+        if (content.size() == position || scMaxChunkSize == c_ChunkSize || (c_ChunkSize >= scMinChunkSize && 0u == (Core::getHash64(c_Row) & scChunkBoundaryMask)))
+        {
+            chunks.push_back(content.substr(chunkBegin, c_ChunkSize));
+            chunkBegin = position;
+        }
+    }
+
+    return chunks;
+}
+
+/* Index row: timestamp (optionally followed by sequence number), filename, size, content hash, chunk hashes (separated by semicolon)
+   The filename is retrieved last (everything between timestamp and size) so it might contain commas
+*/
+bool BackupStore::_parseVersion(const std::string_view indexRow, Version_t& version)
+{
+    bool success{false};
+
+    const size_t c_ChunksBegin{indexRow.rfind(Data::c_CSVSeparator)};
+    const size_t c_ContentHashBegin{std::string_view::npos != c_ChunksBegin && c_ChunksBegin > 0 ? indexRow.rfind(Data::c_CSVSeparator, c_ChunksBegin - 1) : std::string_view::npos};
+    const size_t c_SizeBegin{std::string_view::npos != c_ContentHashBegin && c_ContentHashBegin > 0 ? indexRow.rfind(Data::c_CSVSeparator, c_ContentHashBegin - 1) : std::string_view::npos};
+
+    const size_t c_TimestampEnd{indexRow.find(Data::c_CSVSeparator)};
+
+    if (std::string_view::npos != c_SizeBegin && c_SizeBegin > c_TimestampEnd + 1 && _isValidTimestamp(indexRow.substr(0, c_TimestampEnd)) &&
+        c_ChunksBegin - c_ContentHashBegin == scHashDigitsCount + 1)
+    {
+        const char* const c_pRow{indexRow.data()};
+
+        version.mTimestamp = indexRow.substr(0, c_TimestampEnd);
+        version.mFilename = indexRow.substr(c_TimestampEnd + 1, c_SizeBegin - c_TimestampEnd - 1);
+        version.mChunkHashes.clear();
+
+        success = std::errc{} == std::from_chars(c_pRow + c_SizeBegin + 1, c_pRow + c_ContentHashBegin, version.mSize).ec &&
+                  std::errc{} == std::from_chars(c_pRow + c_ContentHashBegin + 1, c_pRow + c_ChunksBegin, version.mContentHash, 16).ec;
+
+        for (size_t chunkHashBegin{c_ChunksBegin + 1}; success && chunkHashBegin < indexRow.size(); chunkHashBegin += scHashDigitsCount + 1)
+        {
+            std::uint64_t chunkHash{0u};
+
+            success = chunkHashBegin + scHashDigitsCount <= indexRow.size() &&
+                      std::errc{} == std::from_chars(c_pRow + chunkHashBegin, c_pRow + chunkHashBegin + scHashDigitsCount, chunkHash, 16).ec &&
+                      (chunkHashBegin + scHashDigitsCount == indexRow.size() || scChunksSeparator == indexRow[chunkHashBegin + scHashDigitsCount]);
+
+            version.mChunkHashes.push_back(chunkHash);
+        }
+    }
+
+    return success;
+}
+
+bool BackupStore::_isValidTimestamp(const std::string_view timestamp)
+{
+    const std::string_view c_SequenceNumber{timestamp.size() > scTimestampLength + 1 ? timestamp.substr(scTimestampLength + 1) : std::string_view{}};
+
+    return scTimestampLength == timestamp.size() ||
+           (!c_SequenceNumber.empty() && scSequenceNumberSeparator == timestamp[scTimestampLength] && Core::isDigitString(c_SequenceNumber));
+}
+
+// the first version within a second has no sequence number
+size_t BackupStore::_getSequenceNumber(const std::string_view timestamp)
+{
+    size_t sequenceNumber{1u};
+
+    if (timestamp.size() > scTimestampLength + 1 && scSequenceNumberSeparator == timestamp[scTimestampLength])
+    {
+        (void)std::from_chars(timestamp.data() + scTimestampLength + 1, timestamp.data() + timestamp.size(), sequenceNumber);
+    }
+
+    return sequenceNumber;
+}
+
+std::string BackupStore::_getIndexRow(const Version_t& version)
+{
+    std::ostringstream indexRow;
+
+    indexRow << version.mTimestamp << Data::c_CSVSeparator << version.mFilename << Data::c_CSVSeparator << version.mSize << Data::c_CSVSeparator;
+    indexRow << std::hex << std::setfill('0') << std::setw(scHashDigitsCount) << version.mContentHash << Data::c_CSVSeparator;
+
+    for (size_t chunkIndex{0u}; chunkIndex < version.mChunkHashes.size(); ++chunkIndex)
+    {
+        if (chunkIndex > 0u)
+        {
+            indexRow << scChunksSeparator;
+        }
+
+        indexRow << std::setw(scHashDigitsCount) << version.mChunkHashes[chunkIndex];
+    }
+
+    return indexRow.str();
+}
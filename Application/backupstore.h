@@ -0,0 +1,130 @@
+#ifndef BACKUPSTORE_H
+#define BACKUPSTORE_H
+
+#include <vector>
+#include <mutex>
+
+#include "coreutils.h"
+
+namespace Core = Utilities::Core;
+
+/* This class keeps the backed up versions of the data files within a backup directory (content addressed store)
+   Each file is split into chunks at row boundaries (the chunk boundaries depend on the row contents so they are not shifted by inserting/removing rows)
+   Every chunk is stored only once (optionally compressed) in the chunks subdirectory, named by its hash. An index file lists the versions (timestamp, filename, size, content hash, chunks)
+   The timestamp identifies the version among the versions of the same file (a sequence number is appended to it for versions backed up within the same second)
+   The versions that exceed the retention limits (per filename) are removed from the index together with the chunks no longer used by any version
+   Concurrent application instances can share the store, each operation locking it (the index might be rewritten even when only reading, e.g. when importing legacy backups)
+*/
+class BackupStore
+{
+public:
+    struct Settings_t
+    {
+        size_t mMaxVersionsCount;               // per filename (0: unlimited)
+        size_t mMaxAgeDays;                     // 0: unlimited
+        bool mIsCompressionEnabled;             // ignored if compression is not supported
+    };
+
+    struct Version_t
+    {
+        std::string mTimestamp;                 // identifies the version of the file: same format as Core::getDateTimeString(), e.g. 2024-05-01_143000, followed by a sequence number
+                                                // if the file has been backed up multiple times within the same second (e.g. 2024-05-01_143000.2)
+        std::string mFilename;
+        std::uintmax_t mSize;
+        std::uint64_t mContentHash;
+        std::vector<std::uint64_t> mChunkHashes;
+    };
+
+    BackupStore(const Core::Path_t& backupDir, const Settings_t& settings);
+
+    BackupStore(const BackupStore&) = delete;
+    BackupStore& operator=(const BackupStore&) = delete;
+
+    /* Stores the file content as new version and then removes the file (unless storing failed)
+       No version is added if the content is identical to the latest version of the same file
+    */
+    bool moveFile(const Core::Path_t& file);
+
+    /* Returns the stored versions, oldest first
+    */
+    std::vector<Version_t> getVersions();
+
+    /* Writes the requested version of the file (latest one if the timestamp is empty) to the destination file
+       Returns false if no such version exists, if the timestamp is ambiguous (multiple versions) or the content cannot be rebuilt
+    */
+    bool restoreFile(const std::string_view filename, const std::string_view timestamp, const Core::Path_t& destinationFile);
+
+    /* Reads the optional backup settings file. Each row (except the header) contains a setting name and its value:
+       max_versions (default: 100), max_age_days (default: 0 - unlimited), compression (on/off, default: on)
+       Invalid rows are discarded with a warning (default value kept)
+    */
+    static Settings_t readSettings(const Core::Path_t& settingsFile);
+
+    /* Compression is available if the application has been built with zlib
+    */
+    static bool isCompressionSupported();
+
+    /* Version timestamps are ordered by date/time and then by sequence number (plain string comparison would e.g. place 143000.10 before 143000.9)
+    */
+    static bool isEarlierTimestamp(const std::string_view firstTimestamp, const std::string_view secondTimestamp);
+
+private:
+    bool _load();
+    bool _appendVersion(const Version_t& version);
+    bool _applyRetention(const std::string& filename);
+    bool _saveIndex() const;
+    bool _storeChunk(const std::uint64_t chunkHash, const std::string_view chunk) const;
+    bool _readChunk(const std::uint64_t chunkHash, std::string& chunk) const;
+    void _removeChunk(const std::uint64_t chunkHash) const;
+    void _importLegacyBackups();
+
+    /* Appends the next sequence number to the timestamp if the file already has versions backed up within the same second
+    */
+    std::string _getUniqueTimestamp(const std::string& filename, const std::string& timestamp) const;
+
+    /* Versions with the same filename and timestamp might have been added by previous application versions, the later ones get a sequence number
+       Returns true if any timestamp has been changed
+    */
+    bool _makeTimestampsUnique();
+
+    Core::Path_t _getChunkFile(const std::uint64_t chunkHash, const bool isCompressed) const;
+
+    /* Splits the content into chunks at row boundaries (a row ends a chunk if its hash matches the boundary mask, the chunk sizes being kept between the minimum and maximum)
+    */
+    static std::vector<std::string_view> _splitIntoChunks(const std::string_view content);
+
+    static bool _parseVersion(const std::string_view indexRow, Version_t& version);
+    static bool _isValidTimestamp(const std::string_view timestamp);
+    static size_t _getSequenceNumber(const std::string_view timestamp);
+    static std::string _getIndexRow(const Version_t& version);
+
+    static constexpr std::string_view scIndexFilename{"backupindex.csv"};
+    static constexpr std::string_view scIndexHeader{"Timestamp,Filename,Size,Content hash,Chunks"};
+    static constexpr std::string_view scLockFilename{"backupstore.lock"};
+    static constexpr std::string_view scChunksDirName{"chunks"};
+    static constexpr std::string_view scCompressedChunkExtension{".z"};
+    static constexpr char scChunksSeparator{';'};
+
+    static constexpr size_t scHashDigitsCount{16u};
+    static constexpr size_t scTimestampLength{17u};             // YYYY-MM-DD_HHMMSS (without sequence number)
+    static constexpr char scSequenceNumberSeparator{'.'};
+
+    // about 32 rows per chunk on average (a labelling table row is typically 100-200 bytes long)
+    static constexpr std::uint64_t scChunkBoundaryMask{0x1Fu};
+    static constexpr size_t scMinChunkSize{2u * 1024u};
+    static constexpr size_t scMaxChunkSize{64u * 1024u};
+
+    static constexpr size_t scDefaultMaxVersionsCount{100u};
+
+    const Core::Path_t mBackupDir;
+    const Core::Path_t mIndexFile;
+    const Core::Path_t mLockFile;
+    const Settings_t mSettings;
+
+    // the store might be used by multiple batch workers at once (threads) and by multiple application instances (processes, synchronized by locking the lock file)
+    std::mutex mStoreMutex;
+
+    std::vector<Version_t> mVersions;
+};
+
+#endif // BACKUPSTORE_H
@@ -0,0 +1,836 @@
+#include <algorithm>
+#include <deque>
+#include <thread>
+
+#include "appsettings.h"
+#include "labelformats.h"
+#include "devicecatalog.h"
+#include "lazyfilestream.h"
+#include "compression.h"
+#include "batchprocessor.h"
+
+BatchProcessor::BatchProcessor(const ParserCreator::ParserTypes parserType, const Core::Path_t& outputDir, const size_t workersCount)
+    : mParserType{parserType}
+    , mOutputDir{outputDir}
+    , mWorkersCount{workersCount > 0u ? workersCount : std::max(1u, std::thread::hardware_concurrency())}
+    , mIsPreviousOutputKept{false}
+    , mIsFullProcessingRequired{false}
+    , mMaxErrorsCount{0u}
+    , mIsErrorReportAggregated{false}
+    , mIsConflictCheckRequired{false}
+    , mNextRackIndex{0u}
+    , mIOMode{IOMode::BLOCKING}
+    , mReadAheadRacksCount{0u}
+    , mTotalDuration{0}
+{
+    const std::shared_ptr<AppSettings> c_pAppSettings{AppSettings::getInstance()};
+
+    if (ParserCreator::ParserTypes::CONNECTION_DEFINITION == mParserType)
+    {
+        mInputFilename = c_pAppSettings->getConnectionDefinitionsFile().filename().string();
+        mOutputFilename = c_pAppSettings->getConnectionInputFile().filename().string();
+    }
+    else if (ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType)
+    {
+        mInputFilename = c_pAppSettings->getConnectionInputFile().filename().string();
+        mOutputFilename = c_pAppSettings->getLabellingOutputFile().filename().string();
+    }
+    else
+    {
+        ASSERT(false, "Invalid parser type requested for batch processing");
+    }
+
+    mErrorFilename = c_pAppSettings->getParsingErrorsFile().filename().string();
+}
+
+void BatchProcessor::setOutputFormat(const Parser::OutputFormat outputFormat)
+{
+    mOutputFilename = Core::Path_t{mOutputFilename}.replace_extension(Parser::getFileExtension(outputFormat)).string();
+}
+
+bool BatchProcessor::addRacksFromDirectory(const Core::Path_t& inputDir)
+{
+    bool success{false};
+    std::error_code errorCode;
+
+    if (std::filesystem::is_directory(inputDir, errorCode))
+    {
+        for (const auto& c_DirEntry : std::filesystem::directory_iterator{inputDir, errorCode})
+        {
+            if (const std::string c_Filename{_getUncompressedFilename(c_DirEntry.path())};
+                c_DirEntry.is_regular_file(errorCode) &&
+                c_Filename.size() >= mInputFilename.size() &&
+                0 == c_Filename.compare(c_Filename.size() - mInputFilename.size(), mInputFilename.size(), mInputFilename))
+            {
+                (void)addRack(c_DirEntry.path());
+            }
+        }
+
+        success = !errorCode;
+    }
+
+    return success;
+}
+
+bool BatchProcessor::addRacksFromManifest(const Core::Path_t& manifestFile)
+{
+    bool success{false};
+
+    if (std::ifstream manifestStream{manifestFile}; manifestStream.is_open())
+    {
+        const Core::Path_t c_ManifestDir{manifestFile.parent_path()};
+        std::string currentRow;
+
+        success = true;
+
+        while (getline(manifestStream, currentRow))
+        {
+            // trailing whitespace (e.g. carriage return) is discarded
+            while (!currentRow.empty() && std::isspace(static_cast<unsigned char>(currentRow.back())))
+            {
+                currentRow.pop_back();
+            }
+
+            if (!currentRow.empty())
+            {
+                const Core::Path_t c_InputFile{currentRow};
+                (void)addRack(c_InputFile.is_relative() ? c_ManifestDir / c_InputFile : c_InputFile);
+            }
+        }
+    }
+
+    return success;
+}
+
+/* The input filename is expected to end with the default input filename, the prefix identifying the rack (e.g. rack01_connectioninput.csv)
+   The output and error files of the rack get the same prefix. Any other input file uses its stem as prefix (e.g. rack01.csv: rack01_labellingtable.csv)
+   A compressed input file gets an output file with the same compression extension (e.g. rack01_connectioninput.csv.gz: rack01_labellingtable.csv.gz) unless written as spreadsheet (already compressed) or printer commands
+*/
+bool BatchProcessor::addRack(const Core::Path_t& inputFile)
+{
+    bool success{false};
+
+    const std::string c_InputFilename{_getUncompressedFilename(inputFile)};
+    const Parser::OutputFormat c_OutputFormat{Parser::getOutputFormat(mOutputFilename)};
+    const bool c_IsCompressibleOutput{Parser::OutputFormat::CSV == c_OutputFormat || Parser::OutputFormat::JSONL == c_OutputFormat || Parser::OutputFormat::BINARY == c_OutputFormat};
+    const std::string c_CompressionExtension{c_IsCompressibleOutput ? inputFile.filename().string().substr(c_InputFilename.size()) : ""};
+    std::string prefix;
+
+    if (c_InputFilename.size() >= mInputFilename.size() &&
+        0 == c_InputFilename.compare(c_InputFilename.size() - mInputFilename.size(), mInputFilename.size(), mInputFilename))
+    {
+        prefix = c_InputFilename.substr(0, c_InputFilename.size() - mInputFilename.size());
+    }
+    else
+    {
+        prefix = Core::Path_t{c_InputFilename}.stem().string() + "_";
+    }
+
+    const Core::Path_t c_OutputDir{!mOutputDir.empty() ? mOutputDir : inputFile.parent_path()};
+
+    RackResult_t rackResult;
+
+    rackResult.mRackName = prefix.empty() || '_' != prefix.back() ? prefix : prefix.substr(0, prefix.size() - 1);
+    rackResult.mInputFile = inputFile;
+    rackResult.mOutputFile = c_OutputDir / (prefix + mOutputFilename + c_CompressionExtension);
+    rackResult.mErrorFile = c_OutputDir / (prefix + mErrorFilename);
+    rackResult.mStatus = RackStatus::NOT_PROCESSED;
+    rackResult.mDuration = std::chrono::milliseconds{0};
+
+    if (rackResult.mRackName.empty())
+    {
+        rackResult.mRackName = c_InputFilename;
+    }
+
+    std::error_code errorCode;
+    rackResult.mInputFileSize = std::filesystem::file_size(inputFile, errorCode);
+
+    if (errorCode)
+    {
+        rackResult.mInputFileSize = 0u; // the rack is still processed and reported (input file not opened)
+    }
+
+    // two racks writing to the same output file would overwrite each other's results
+    if (mOutputFiles.insert(rackResult.mOutputFile).second)
+    {
+        mRackResults.push_back(std::move(rackResult));
+        success = true;
+    }
+    else
+    {
+        std::cerr << "Warning! Rack discarded, output file already used by another rack: " << rackResult.mOutputFile.string() << "\n";
+    }
+
+    return success;
+}
+
+void BatchProcessor::setOutputBackupDir(const Core::Path_t& outputBackupDir)
+{
+    mpOutputBackupStore = std::make_shared<BackupStore>(outputBackupDir, BackupStore::readSettings(AppSettings::getInstance()->getBackupSettingsFile()));
+}
+
+void BatchProcessor::setPreviousOutputKeptOnFailure(const bool previousOutputKept)
+{
+    mIsPreviousOutputKept = previousOutputKept;
+}
+
+void BatchProcessor::setFullProcessingRequired(const bool fullProcessingRequired)
+{
+    mIsFullProcessingRequired = fullProcessingRequired;
+}
+
+void BatchProcessor::setLabelSpoolDir(const Core::Path_t& labelSpoolDir)
+{
+    mLabelSpoolDir = labelSpoolDir;
+}
+
+void BatchProcessor::setReportTypes(const std::vector<ConnectionReports::ReportType>& reportTypes)
+{
+    mReportTypes = reportTypes;
+}
+
+void BatchProcessor::setConflictCheckRequired(const bool conflictCheckRequired)
+{
+    mIsConflictCheckRequired = conflictCheckRequired;
+}
+
+void BatchProcessor::setMaxErrorsCount(const size_t maxErrorsCount)
+{
+    mMaxErrorsCount = maxErrorsCount;
+}
+
+void BatchProcessor::setErrorReportAggregated(const bool errorReportAggregated)
+{
+    mIsErrorReportAggregated = errorReportAggregated;
+}
+
+void BatchProcessor::setIOMode(const IOMode ioMode)
+{
+    mIOMode = ioMode;
+}
+
+bool BatchProcessor::process()
+{
+    const auto c_StartTime{std::chrono::steady_clock::now()};
+
+    // largest racks first so the slowest rack doesn't start last and dominate the total duration (input file name as tie breaker for a deterministic order)
+    std::sort(mRackResults.begin(), mRackResults.end(), [](const RackResult_t& first, const RackResult_t& second) {
+        return first.mInputFileSize != second.mInputFileSize ? first.mInputFileSize > second.mInputFileSize : first.mInputFile < second.mInputFile;
+    });
+
+    // the singletons are lazily created and their creation is not thread safe so this should be done before starting the workers (afterwards they are only read)
+    (void)AppSettings::getInstance();
+    (void)LabelFormats::getInstance();
+    (void)DeviceCatalog::getInstance();
+
+    mNextRackIndex = 0u;
+
+    const size_t c_WorkersCount{std::min(mWorkersCount, mRackResults.size())};
+    void (BatchProcessor::*const c_ProcessRacks)(){IOMode::BLOCKING != mIOMode ? &BatchProcessor::_processRacksAsync : &BatchProcessor::_processRacks};
+
+    if (IOMode::BLOCKING != mIOMode)
+    {
+        mpAsyncFileIO = AsyncFileIO::create(c_WorkersCount, IOMode::ASYNC == mIOMode);
+        mIOBackendName = mpAsyncFileIO->getBackendName();
+        mInputFileContents.clear();
+        mInputFileContents.resize(mRackResults.size());
+        mReadAheadRacksCount = 0u;
+    }
+    else
+    {
+        // compressing is the most expensive part of writing so the workers leave it to background threads
+        if (std::any_of(mRackResults.cbegin(), mRackResults.cend(), [](const RackResult_t& element) {return Core::CompressionFormat::NONE != Core::getCompressionFormat(element.mOutputFile);}))
+        {
+            mpAsyncFileIO = AsyncFileIO::create(c_WorkersCount, false);
+        }
+
+        mIOBackendName = "blocking";
+    }
+
+    std::vector<std::thread> workers;
+
+    if (c_WorkersCount > 1u)
+    {
+        workers.reserve(c_WorkersCount - 1);
+
+        for (size_t workerNumber{1u}; workerNumber < c_WorkersCount; ++workerNumber)
+        {
+            workers.emplace_back(c_ProcessRacks, this);
+        }
+    }
+
+    (this->*c_ProcessRacks)(); // the current thread acts as a worker too
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    // all requests are completed by now (each rack waits for its files being written)
+    mpAsyncFileIO.reset();
+    mInputFileContents.clear();
+
+    mTotalDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - c_StartTime);
+
+    return 0u == getFailedRacksCount();
+}
+
+void BatchProcessor::writeSummary(std::ostream& outStream) const
+{
+    outStream << "Rack,Input file,Output/error file,Status,Duration (ms)\n";
+
+    for (const auto& c_RackResult : mRackResults)
+    {
+        outStream << c_RackResult.mRackName << ","
+                  << c_RackResult.mInputFile.string() << ","
+                  << (isSuccessfulRackStatus(c_RackResult.mStatus) ? c_RackResult.mOutputFile.string() : c_RackResult.mErrorFile.string()) << ","
+                  << getRackStatusAsString(c_RackResult.mStatus) << ","
+                  << c_RackResult.mDuration.count() << "\n";
+    }
+
+    const size_t c_FailedRacksCount{getFailedRacksCount()};
+
+    outStream << "\nTotal racks," << mRackResults.size() << "\n";
+    outStream << "Succeeded," << mRackResults.size() - c_FailedRacksCount << "\n";
+    outStream << "Failed," << c_FailedRacksCount << "\n";
+    outStream << "Workers," << std::min(mWorkersCount, mRackResults.size()) << "\n";
+    outStream << "File I/O," << mIOBackendName << "\n";
+    outStream << "Total duration (ms)," << mTotalDuration.count() << "\n";
+    outStream << "Throughput (racks/s)," << (mTotalDuration.count() > 0 ? mRackResults.size() * 1000u / static_cast<size_t>(mTotalDuration.count()) : mRackResults.size() * 1000u) << "\n";
+}
+
+const std::vector<BatchProcessor::RackResult_t>& BatchProcessor::getRackResults() const
+{
+    return mRackResults;
+}
+
+size_t BatchProcessor::getRacksCount() const
+{
+    return mRackResults.size();
+}
+
+size_t BatchProcessor::getFailedRacksCount() const
+{
+    return static_cast<size_t>(std::count_if(mRackResults.cbegin(), mRackResults.cend(), [](const RackResult_t& element) {return !isSuccessfulRackStatus(element.mStatus);}));
+}
+
+std::string_view BatchProcessor::getRackStatusAsString(const RackStatus rackStatus)
+{
+    std::string_view rackStatusString;
+
+    switch(rackStatus)
+    {
+    case RackStatus::NOT_PROCESSED:
+        rackStatusString = "not processed";
+        break;
+    case RackStatus::SUCCESS:
+        rackStatusString = "success";
+        break;
+    case RackStatus::UP_TO_DATE:
+        rackStatusString = "up to date";
+        break;
+    case RackStatus::INPUT_FILE_NOT_OPENED:
+        rackStatusString = "input file not opened";
+        break;
+    case RackStatus::OUTPUT_FILE_NOT_OPENED:
+        rackStatusString = "output file not opened";
+        break;
+    case RackStatus::ERROR_FILE_NOT_OPENED:
+        rackStatusString = "error file not opened";
+        break;
+    case RackStatus::PARSER_NOT_CREATED:
+        rackStatusString = "parser not created";
+        break;
+    case RackStatus::PARSING_ERROR:
+        rackStatusString = "parsing errors";
+        break;
+    case RackStatus::LABELS_NOT_SPOOLED:
+        rackStatusString = "labels not spooled";
+        break;
+    case RackStatus::REPORTS_NOT_WRITTEN:
+        rackStatusString = "reports not written";
+        break;
+    }
+
+    return rackStatusString;
+}
+
+bool BatchProcessor::isSuccessfulRackStatus(const RackStatus rackStatus)
+{
+    return RackStatus::SUCCESS == rackStatus || RackStatus::UP_TO_DATE == rackStatus;
+}
+
+void BatchProcessor::_processRacks()
+{
+    std::deque<PendingRack_t> pendingRacks;
+
+    // the compressed output files of the previous racks are written in the background while the next racks are parsed
+    for (size_t rackIndex{mNextRackIndex++}; rackIndex < mRackResults.size(); rackIndex = mNextRackIndex++)
+    {
+        if (std::optional<PendingRack_t> pendingRack{_processRack(mRackResults[rackIndex])}; pendingRack.has_value())
+        {
+            pendingRacks.push_back(std::move(*pendingRack));
+        }
+
+        if (pendingRacks.size() > scPendingRacksCount)
+        {
+            _finishPendingRack(pendingRacks.front());
+            pendingRacks.pop_front();
+        }
+    }
+
+    for (auto& pendingRack : pendingRacks)
+    {
+        _finishPendingRack(pendingRack);
+    }
+}
+
+/* A rack with a compressed output file is parsed in memory (like for the asynchronous I/O) and returned as pending, its output file being compressed and written in the background
+*/
+std::optional<BatchProcessor::PendingRack_t> BatchProcessor::_processRack(RackResult_t& rackResult) const
+{
+    std::optional<PendingRack_t> pendingRack;
+
+    const auto c_StartTime{std::chrono::steady_clock::now()};
+
+    std::unique_ptr<OutputStamp> pOutputStamp{std::make_unique<OutputStamp>(mParserType, rackResult.mInputFile, rackResult.mOutputFile)};
+
+    // nothing to do (not even opening the files) if neither the input nor the output changed since the previous run
+    const bool c_IsOutputUpToDate{pOutputStamp->load() && !mIsFullProcessingRequired && mLabelSpoolDir.empty() && mReportTypes.empty() && !mIsConflictCheckRequired && pOutputStamp->isOutputUpToDate()};
+    const bool c_IsOutputCompressed{Core::CompressionFormat::NONE != Core::getCompressionFormat(rackResult.mOutputFile)};
+
+    const Core::DecompressingInputStreamPtr c_pInputStream{std::make_shared<Core::DecompressingInputStream>()};
+    Core::OutputFileStreamPtr pOutputStream{nullptr};
+    Core::LazyFileStreamPtr pErrorStream{nullptr};
+    LabellingIndexPtr pLabellingIndex{nullptr};
+
+    if (!c_IsOutputUpToDate)
+    {
+        c_pInputStream->open(rackResult.mInputFile);
+    }
+
+    // a previous output file to be kept on failure is only replaced once the new one is complete
+    const Core::Path_t c_WrittenOutputFile{mIsPreviousOutputKept ? Core::getTemporaryFile(rackResult.mOutputFile) : rackResult.mOutputFile};
+
+    // the input is opened first so no files are created (or backed up) for a rack that cannot be read
+    if (c_pInputStream->isOpen() && !c_IsOutputCompressed)
+    {
+        if (mpOutputBackupStore && !mIsPreviousOutputKept)
+        {
+            _moveOutputFileToBackupDir(rackResult.mOutputFile);
+        }
+
+        // binary as the output might be a spreadsheet (same line endings on all platforms as for the asynchronous I/O)
+        pOutputStream = std::make_shared<std::ofstream>(c_WrittenOutputFile, std::ios::binary);
+    }
+
+    // the error file is only created if parsing errors occur
+    if (pOutputStream && pOutputStream->is_open())
+    {
+        pErrorStream = std::make_shared<Core::LazyFileStream>();
+        pErrorStream->setFile(rackResult.mErrorFile);
+    }
+
+    if (c_IsOutputUpToDate)
+    {
+        rackResult.mStatus = RackStatus::UP_TO_DATE;
+
+        // the input has been restored after a failed run that kept the previous output file, so the error file of that run no longer applies
+        if (mIsPreviousOutputKept)
+        {
+            std::error_code errorCode;
+            (void)std::filesystem::remove(rackResult.mErrorFile, errorCode);
+        }
+    }
+    else if (!c_pInputStream->isOpen())
+    {
+        rackResult.mStatus = RackStatus::INPUT_FILE_NOT_OPENED;
+    }
+    else if (c_IsOutputCompressed)
+    {
+        pendingRack = PendingRack_t{&rackResult, c_StartTime, std::move(pOutputStamp), nullptr, {}, {}};
+        _parseRackInMemory(*pendingRack, c_pInputStream);
+    }
+    else if (!pOutputStream->is_open())
+    {
+        rackResult.mStatus = RackStatus::OUTPUT_FILE_NOT_OPENED;
+    }
+    else
+    {
+        ParserCreator parserCreator;
+
+        if (ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType)
+        {
+            pLabellingIndex = std::make_shared<LabellingIndex>(LabellingIndex::getIndexFile(rackResult.mOutputFile));
+
+            if (!mIsFullProcessingRequired)
+            {
+                (void)pLabellingIndex->load();
+            }
+        }
+
+        const ConnectionReportsPtr c_pConnectionReports{_createConnectionReports(rackResult.mOutputFile)};
+        const ConnectionConflictDetectorPtr c_pConnectionConflictDetector{mIsConflictCheckRequired ? std::make_shared<ConnectionConflictDetector>() : nullptr};
+
+        if (const ParserPtr c_pParser{parserCreator.createParser(mParserType, c_pInputStream, pOutputStream, pErrorStream, pLabellingIndex, c_pConnectionReports, c_pConnectionConflictDetector)}; c_pParser)
+        {
+            c_pParser->setOutputFormat(Parser::getOutputFormat(rackResult.mOutputFile));
+            c_pParser->setMaxErrorsCount(mMaxErrorsCount);
+            c_pParser->setErrorReportAggregated(mIsErrorReportAggregated);
+            c_pParser->setInputFile(rackResult.mInputFile);
+
+            if (!mLabelSpoolDir.empty())
+            {
+                c_pParser->setLabelSpool(mLabelSpoolDir, rackResult.mOutputFile);
+            }
+
+            const bool c_ParsingErrorsOccurred{c_pParser->parse()};
+
+            // a corrupt or truncated compressed input file cannot be (completely) read
+            if (c_pInputStream->isCorrupt())
+            {
+                rackResult.mStatus = RackStatus::INPUT_FILE_NOT_OPENED;
+            }
+            else if (!c_ParsingErrorsOccurred && c_pParser->isLabelSpoolingFailed())
+            {
+                rackResult.mStatus = RackStatus::LABELS_NOT_SPOOLED;
+            }
+            else if (!c_ParsingErrorsOccurred)
+            {
+                rackResult.mStatus = !c_pConnectionReports || !c_pConnectionReports->isWritingFailed() ? RackStatus::SUCCESS : RackStatus::REPORTS_NOT_WRITTEN;
+            }
+            else
+            {
+                rackResult.mStatus = !pErrorStream->flush().bad() ? RackStatus::PARSING_ERROR : RackStatus::ERROR_FILE_NOT_OPENED;
+            }
+        }
+        else
+        {
+            rackResult.mStatus = RackStatus::PARSER_NOT_CREATED;
+        }
+    }
+
+    c_pInputStream->close();
+
+    if (pOutputStream)
+    {
+        pOutputStream->close();
+    }
+
+    if (pErrorStream)
+    {
+        pErrorStream->close();
+    }
+
+    if (pOutputStream && mIsPreviousOutputKept)
+    {
+        if (_isOutputValid(rackResult.mStatus))
+        {
+            if (mpOutputBackupStore && !pOutputStream->fail())
+            {
+                _moveOutputFileToBackupDir(rackResult.mOutputFile);
+            }
+
+            if (pOutputStream->fail() || !Core::replaceFile(c_WrittenOutputFile, rackResult.mOutputFile))
+            {
+                rackResult.mStatus = RackStatus::OUTPUT_FILE_NOT_OPENED;
+            }
+        }
+
+        // not replacing the previous output file (failed rack)
+        std::error_code errorCode;
+        (void)std::filesystem::remove(c_WrittenOutputFile, errorCode);
+    }
+
+    // the index and stamp should only describe a successfully written output file
+    if (pOutputStream && _isOutputValid(rackResult.mStatus) && !pOutputStream->fail())
+    {
+        if (pLabellingIndex)
+        {
+            (void)pLabellingIndex->save();
+        }
+
+        (void)pOutputStamp->save();
+    }
+
+    // same cleanup as for a single run: the error file is only kept if parsing errors occurred, in which case there should be no output file (unless the previous one is kept)
+    std::error_code errorCode;
+
+    if (pErrorStream && RackStatus::PARSING_ERROR != rackResult.mStatus)
+    {
+        (void)std::filesystem::remove(rackResult.mErrorFile, errorCode);
+    }
+
+    if (pOutputStream && !mIsPreviousOutputKept && (RackStatus::PARSING_ERROR == rackResult.mStatus || RackStatus::ERROR_FILE_NOT_OPENED == rackResult.mStatus || RackStatus::INPUT_FILE_NOT_OPENED == rackResult.mStatus))
+    {
+        (void)std::filesystem::remove(rackResult.mOutputFile, errorCode);
+    }
+
+    // the duration of a pending rack is determined once its output file is written
+    if (!pendingRack.has_value())
+    {
+        rackResult.mDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - c_StartTime);
+    }
+
+    return pendingRack;
+}
+
+void BatchProcessor::_processRacksAsync()
+{
+    std::deque<PendingRack_t> pendingRacks;
+
+    // the files of the previous racks are written while the next ones are parsed
+    for (size_t rackIndex{mNextRackIndex++}; rackIndex < mRackResults.size(); rackIndex = mNextRackIndex++)
+    {
+        pendingRacks.push_back(_startRackAsync(rackIndex));
+
+        if (pendingRacks.size() > scPendingRacksCount)
+        {
+            _finishPendingRack(pendingRacks.front());
+            pendingRacks.pop_front();
+        }
+    }
+
+    for (auto& pendingRack : pendingRacks)
+    {
+        _finishPendingRack(pendingRack);
+    }
+}
+
+/* Same steps as for the blocking I/O, except that the output (or error) file is not written yet
+*/
+BatchProcessor::PendingRack_t BatchProcessor::_startRackAsync(const size_t rackIndex)
+{
+    RackResult_t& rackResult{mRackResults[rackIndex]};
+
+    PendingRack_t pendingRack{&rackResult, std::chrono::steady_clock::now(), nullptr, nullptr, {}, {}};
+
+    _readAhead(rackIndex);
+
+    AsyncFileIO::FileContent_t inputContent{mInputFileContents[rackIndex].get()};
+
+    if (inputContent.has_value())
+    {
+        pendingRack.mpOutputStamp = std::make_unique<OutputStamp>(mParserType, rackResult.mInputFile, rackResult.mOutputFile);
+        (void)pendingRack.mpOutputStamp->load(*inputContent);
+    }
+
+    if (!inputContent.has_value())
+    {
+        rackResult.mStatus = RackStatus::INPUT_FILE_NOT_OPENED;
+    }
+    else if (!mIsFullProcessingRequired && mLabelSpoolDir.empty() && mReportTypes.empty() && !mIsConflictCheckRequired && pendingRack.mpOutputStamp->isOutputUpToDate())
+    {
+        rackResult.mStatus = RackStatus::UP_TO_DATE;
+    }
+    else
+    {
+        // the (compressed) content is decompressed while being parsed
+        const Core::DecompressingInputStreamPtr c_pInputStream{std::make_shared<Core::DecompressingInputStream>()};
+        c_pInputStream->open(std::move(*inputContent), Core::getCompressionFormat(rackResult.mInputFile));
+
+        if (c_pInputStream->isOpen())
+        {
+            _parseRackInMemory(pendingRack, c_pInputStream);
+        }
+        else
+        {
+            rackResult.mStatus = RackStatus::INPUT_FILE_NOT_OPENED;
+        }
+    }
+
+    return pendingRack;
+}
+
+/* The output (or error) file is written (and compressed if required) by the I/O backend
+   An existing output file is moved to the backup store (or removed) before being replaced, while a stale error file is removed
+   If the rack fails, the existing output file is kept as is if required
+*/
+void BatchProcessor::_parseRackInMemory(PendingRack_t& pendingRack, const Core::DecompressingInputStreamPtr& pInputStream) const
+{
+    RackResult_t& rackResult{*pendingRack.mpRackResult};
+
+    const std::shared_ptr<std::ostringstream> c_pOutputStream{std::make_shared<std::ostringstream>()};
+    const std::shared_ptr<std::ostringstream> c_pErrorStream{std::make_shared<std::ostringstream>()};
+
+    ParserCreator parserCreator;
+
+    if (ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType)
+    {
+        pendingRack.mpLabellingIndex = std::make_shared<LabellingIndex>(LabellingIndex::getIndexFile(rackResult.mOutputFile));
+
+        if (!mIsFullProcessingRequired)
+        {
+            (void)pendingRack.mpLabellingIndex->load();
+        }
+    }
+
+    const ConnectionReportsPtr c_pConnectionReports{_createConnectionReports(rackResult.mOutputFile)};
+    const ConnectionConflictDetectorPtr c_pConnectionConflictDetector{mIsConflictCheckRequired ? std::make_shared<ConnectionConflictDetector>() : nullptr};
+
+    if (const ParserPtr c_pParser{parserCreator.createParser(mParserType, pInputStream, c_pOutputStream, c_pErrorStream, pendingRack.mpLabellingIndex, c_pConnectionReports, c_pConnectionConflictDetector)}; c_pParser)
+    {
+        c_pParser->setOutputFormat(Parser::getOutputFormat(rackResult.mOutputFile));
+        c_pParser->setMaxErrorsCount(mMaxErrorsCount);
+        c_pParser->setErrorReportAggregated(mIsErrorReportAggregated);
+        c_pParser->setInputFile(rackResult.mInputFile);
+
+        if (!mLabelSpoolDir.empty())
+        {
+            c_pParser->setLabelSpool(mLabelSpoolDir, rackResult.mOutputFile);
+        }
+
+        const bool c_ParsingErrorsOccurred{c_pParser->parse()};
+
+        // a corrupt or truncated compressed input file cannot be (completely) read
+        if (pInputStream->isCorrupt())
+        {
+            rackResult.mStatus = RackStatus::INPUT_FILE_NOT_OPENED;
+        }
+        else if (!c_ParsingErrorsOccurred && c_pParser->isLabelSpoolingFailed())
+        {
+            rackResult.mStatus = RackStatus::LABELS_NOT_SPOOLED;
+        }
+        else if (!c_ParsingErrorsOccurred)
+        {
+            rackResult.mStatus = !c_pConnectionReports || !c_pConnectionReports->isWritingFailed() ? RackStatus::SUCCESS : RackStatus::REPORTS_NOT_WRITTEN;
+        }
+        else
+        {
+            rackResult.mStatus = RackStatus::PARSING_ERROR;
+        }
+    }
+    else
+    {
+        rackResult.mStatus = RackStatus::PARSER_NOT_CREATED;
+    }
+
+    std::error_code errorCode;
+
+    // unless kept on failure, the previous output file does not survive a processed rack
+    const bool c_IsPreviousOutputDiscarded{!mIsPreviousOutputKept && RackStatus::PARSING_ERROR == rackResult.mStatus};
+
+    if (mpOutputBackupStore && (_isOutputValid(rackResult.mStatus) || c_IsPreviousOutputDiscarded))
+    {
+        _moveOutputFileToBackupDir(rackResult.mOutputFile);
+    }
+
+    if (_isOutputValid(rackResult.mStatus))
+    {
+        (void)std::filesystem::remove(rackResult.mErrorFile, errorCode);
+
+        // the content is kept for the stamp (a compressed output file is hashed once written)
+        if (Core::CompressionFormat::NONE == Core::getCompressionFormat(rackResult.mOutputFile))
+        {
+            pendingRack.mOutputContent = c_pOutputStream->str();
+        }
+
+        pendingRack.mFileWritten = mpAsyncFileIO->writeFile(rackResult.mOutputFile, c_pOutputStream->str());
+    }
+    else if (RackStatus::PARSING_ERROR == rackResult.mStatus)
+    {
+        if (c_IsPreviousOutputDiscarded)
+        {
+            (void)std::filesystem::remove(rackResult.mOutputFile, errorCode);
+        }
+
+        pendingRack.mFileWritten = mpAsyncFileIO->writeFile(rackResult.mErrorFile, c_pErrorStream->str());
+    }
+    else if (c_IsPreviousOutputDiscarded)
+    {
+        (void)std::filesystem::remove(rackResult.mOutputFile, errorCode);
+    }
+}
+
+/* The index and stamp should only describe a successfully written output file (same as for the blocking I/O)
+*/
+void BatchProcessor::_finishPendingRack(PendingRack_t& pendingRack) const
+{
+    RackResult_t& rackResult{*pendingRack.mpRackResult};
+
+    if (pendingRack.mFileWritten.valid())
+    {
+        const bool c_IsFileWritten{pendingRack.mFileWritten.get()};
+
+        if (!_isOutputValid(rackResult.mStatus))
+        {
+            rackResult.mStatus = c_IsFileWritten ? rackResult.mStatus : RackStatus::ERROR_FILE_NOT_OPENED;
+        }
+        else if (!c_IsFileWritten)
+        {
+            rackResult.mStatus = RackStatus::OUTPUT_FILE_NOT_OPENED;
+        }
+        else
+        {
+            if (pendingRack.mpLabellingIndex)
+            {
+                (void)pendingRack.mpLabellingIndex->save();
+            }
+
+            const bool c_IsOutputCompressed{Core::CompressionFormat::NONE != Core::getCompressionFormat(rackResult.mOutputFile)};
+            (void)(c_IsOutputCompressed ? pendingRack.mpOutputStamp->save() : pendingRack.mpOutputStamp->save(pendingRack.mOutputContent));
+        }
+    }
+
+    // includes the time spent waiting for the file to be written (overlapping with the parsing of the next rack)
+    rackResult.mDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - pendingRack.mStartTime);
+}
+
+/* The read ahead window is refilled in chunks so the I/O backend gets multiple requests at once
+*/
+void BatchProcessor::_readAhead(const size_t rackIndex)
+{
+    std::lock_guard<std::mutex> lock{mReadAheadMutex};
+
+    if (mReadAheadRacksCount < std::min(rackIndex + scReadAheadRacksCount / 2u, mRackResults.size()))
+    {
+        const size_t c_ReadAheadEnd{std::min(rackIndex + scReadAheadRacksCount, mRackResults.size())};
+
+        for (; mReadAheadRacksCount < c_ReadAheadEnd; ++mReadAheadRacksCount)
+        {
+            mInputFileContents[mReadAheadRacksCount] = mpAsyncFileIO->readFile(mRackResults[mReadAheadRacksCount].mInputFile);
+        }
+    }
+}
+
+void BatchProcessor::_moveOutputFileToBackupDir(const Core::Path_t& outputFile) const
+{
+    std::error_code errorCode;
+
+    if (std::filesystem::exists(outputFile, errorCode) && !mpOutputBackupStore->moveFile(outputFile))
+    {
+        std::cerr << "Warning! The existing output file could not be moved to the backup directory: " << outputFile.string() << "\n";
+    }
+}
+
+ConnectionReportsPtr BatchProcessor::_createConnectionReports(const Core::Path_t& outputFile) const
+{
+    ConnectionReportsPtr pConnectionReports{nullptr};
+
+    if (ParserCreator::ParserTypes::CONNECTION_INPUT == mParserType && !mReportTypes.empty())
+    {
+        pConnectionReports = std::make_shared<ConnectionReports>(outputFile);
+
+        for (const auto c_ReportType : mReportTypes)
+        {
+            pConnectionReports->addReport(c_ReportType);
+        }
+    }
+
+    return pConnectionReports;
+}
+
+/* The compression extension (if any) is removed from the filename (e.g. rack01_connectioninput.csv.gz: rack01_connectioninput.csv)
+*/
+bool BatchProcessor::_isOutputValid(const RackStatus rackStatus)
+{
+    return RackStatus::SUCCESS == rackStatus || RackStatus::LABELS_NOT_SPOOLED == rackStatus || RackStatus::REPORTS_NOT_WRITTEN == rackStatus;
+}
+
+std::string BatchProcessor::_getUncompressedFilename(const Core::Path_t& file)
+{
+    const bool c_IsCompressed{Core::CompressionFormat::NONE != Core::getCompressionFormat(file)};
+    const std::string c_UncompressedFilename{c_IsCompressed ? file.stem().string() : file.filename().string()};
+
+    return c_UncompressedFilename;
+}
@@ -0,0 +1,214 @@
+#ifndef BATCHPROCESSOR_H
+#define BATCHPROCESSOR_H
+
+#include <vector>
+#include <set>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include "parsercreator.h"
+#include "outputstamp.h"
+#include "backupstore.h"
+#include "asyncfileio.h"
+#include "compressedfilestream.h"
+
+/* This class runs the same parsing operation (option 1 or 2) on multiple racks, each rack having its own input, output and error files
+   The racks are processed in parallel by a bounded pool of worker threads, the largest input files being scheduled first
+   Each rack is handled exactly like a single (headless) run: the output file is removed if parsing errors occurred, the error file is removed otherwise
+   With asynchronous I/O the input files are read ahead and each rack is parsed in memory, its output (or error) file being written in the background while the worker parses the next rack
+   Compressed input files (.gz, .zst) are decompressed while being parsed and get an output file compressed the same way, the compression being done in the background (any I/O mode)
+*/
+class BatchProcessor
+{
+public:
+    enum class RackStatus
+    {
+        NOT_PROCESSED,
+        SUCCESS,
+        UP_TO_DATE,                             // input and output unchanged since the previous run (not processed again)
+        INPUT_FILE_NOT_OPENED,
+        OUTPUT_FILE_NOT_OPENED,
+        ERROR_FILE_NOT_OPENED,
+        PARSER_NOT_CREATED,
+        PARSING_ERROR,
+        LABELS_NOT_SPOOLED,                     // the labels could not be written to the spool directory (the output file is written though)
+        REPORTS_NOT_WRITTEN                     // (some of) the requested reports could not be written (the output file is written though)
+    };
+
+    enum class IOMode
+    {
+        BLOCKING,                               // each worker reads and writes the files of its racks itself
+        ASYNC,                                  // io_uring if available, thread pool otherwise
+        ASYNC_THREAD_POOL
+    };
+
+    struct RackResult_t
+    {
+        std::string mRackName;                  // input filename without the default input filename suffix (e.g. rack01_ for rack01_connectioninput.csv)
+        Core::Path_t mInputFile;
+        Core::Path_t mOutputFile;
+        Core::Path_t mErrorFile;
+        std::uintmax_t mInputFileSize;          // used for scheduling (largest first)
+        RackStatus mStatus;
+        std::chrono::milliseconds mDuration;
+    };
+
+    /* The output directory is optional: if empty, the output and error files of each rack are written next to its input file
+       The number of workers is capped to the number of racks (0 means: use the hardware concurrency)
+    */
+    BatchProcessor(const ParserCreator::ParserTypes parserType, const Core::Path_t& outputDir, const size_t workersCount);
+
+    /* Replaces the extension of the rack output files (e.g. rack01_labellingtable.xlsx or rack01_labellingtable.zpl), which selects their format. Only applies to the racks added afterwards
+    */
+    void setOutputFormat(const Parser::OutputFormat outputFormat);
+
+    /* Adds all files from the directory whose names end with the default input filename of the operation (e.g. rack01_connectioninput.csv for option 2), optionally compressed (e.g. rack01_connectioninput.csv.gz)
+    */
+    bool addRacksFromDirectory(const Core::Path_t& inputDir);
+
+    /* Adds the input files listed in the manifest file (one path per row, relative paths are resolved against the manifest directory)
+    */
+    bool addRacksFromManifest(const Core::Path_t& manifestFile);
+
+    /* Adds a single rack. Returns false if the output file of the rack is already used by another rack (in which case the rack is discarded)
+    */
+    bool addRack(const Core::Path_t& inputFile);
+
+    /* If set, an existing output file is moved to the backup store of this directory before being overwritten
+    */
+    void setOutputBackupDir(const Core::Path_t& outputBackupDir);
+
+    /* If set, the existing output file of a rack is only replaced (and backed up, see above) if the rack is successfully processed, otherwise it is kept as is
+       The new output file is written next to it and renamed once complete (e.g. in watch mode a mid-edit save with parsing errors keeps the last good labelling table)
+    */
+    void setPreviousOutputKeptOnFailure(const bool previousOutputKept);
+
+    /* Each rack keeps a stamp next to its output file so it is skipped if its input didn't change since the previous run
+       For option 2 each rack also keeps a labelling index next to its labelling table so only the changed connection input rows are labelled
+       If full processing is required, the existing stamps and indexes are ignored (and replaced)
+    */
+    void setFullProcessingRequired(const bool fullProcessingRequired);
+
+    /* If set, the labels of each successfully processed rack are also written to this directory as label printer jobs and the racks are processed even if up to date
+    */
+    void setLabelSpoolDir(const Core::Path_t& labelSpoolDir);
+
+    /* The requested reports are written next to the output file of each successfully processed rack (e.g. rack01_labellingtable_bom.csv) and the racks are processed even if up to date
+    */
+    void setReportTypes(const std::vector<ConnectionReports::ReportType>& reportTypes);
+
+    /* For option 2 the device ports used on more than one row and the labels calculated more than once are reported as parsing errors of each rack (within the rack only)
+       All connection input rows get labelled and the racks are processed even if up to date
+    */
+    void setConflictCheckRequired(const bool conflictCheckRequired);
+
+    /* The parsing of each rack stops once this number of errors is reached (0: no limit)
+    */
+    void setMaxErrorsCount(const size_t maxErrorsCount);
+
+    /* The parsing errors of each rack are logged as aggregated report (grouped by error code and column)
+    */
+    void setErrorReportAggregated(const bool errorReportAggregated);
+
+    /* Blocking I/O is used by default. With asynchronous I/O the written output and error files replace the existing ones (if any) only once complete
+    */
+    void setIOMode(const IOMode ioMode);
+
+    /* Processes all added racks. Returns false if at least one of them failed
+    */
+    bool process();
+
+    /* Writes the summary report (csv): one row per rack followed by the totals
+    */
+    void writeSummary(std::ostream& outStream) const;
+
+    const std::vector<RackResult_t>& getRackResults() const;
+    size_t getRacksCount() const;
+    size_t getFailedRacksCount() const;
+
+    static std::string_view getRackStatusAsString(const RackStatus rackStatus);
+
+    /* The racks that are up to date are considered successful too
+    */
+    static bool isSuccessfulRackStatus(const RackStatus rackStatus);
+
+private:
+    // rack parsed in memory, waiting for its output (or error) file to be written
+    struct PendingRack_t
+    {
+        RackResult_t* mpRackResult;
+        std::chrono::steady_clock::time_point mStartTime;
+        std::unique_ptr<OutputStamp> mpOutputStamp;
+        LabellingIndexPtr mpLabellingIndex;
+        std::string mOutputContent;
+        std::future<bool> mFileWritten;
+    };
+
+    void _processRacks();
+    std::optional<PendingRack_t> _processRack(RackResult_t& rackResult) const;
+    void _processRacksAsync();
+    PendingRack_t _startRackAsync(const size_t rackIndex);
+    void _parseRackInMemory(PendingRack_t& pendingRack, const Core::DecompressingInputStreamPtr& pInputStream) const;
+    void _finishPendingRack(PendingRack_t& pendingRack) const;
+    void _readAhead(const size_t rackIndex);
+    void _moveOutputFileToBackupDir(const Core::Path_t& outputFile) const;
+
+    /* Returns nullptr if no reports are requested
+    */
+    ConnectionReportsPtr _createConnectionReports(const Core::Path_t& outputFile) const;
+
+    /* The output file of the rack is complete (failing to spool the labels or to write the reports doesn't affect it)
+    */
+    static bool _isOutputValid(const RackStatus rackStatus);
+
+    static std::string _getUncompressedFilename(const Core::Path_t& file);
+
+    const ParserCreator::ParserTypes mParserType;
+    const Core::Path_t mOutputDir;
+    const size_t mWorkersCount;
+
+    // shared by all workers (the store serializes the backups)
+    std::shared_ptr<BackupStore> mpOutputBackupStore;
+    bool mIsPreviousOutputKept;
+    bool mIsFullProcessingRequired;
+    Core::Path_t mLabelSpoolDir;
+    std::vector<ConnectionReports::ReportType> mReportTypes;
+    size_t mMaxErrorsCount;
+    bool mIsErrorReportAggregated;
+    bool mIsConflictCheckRequired;
+
+    // filenames of the single run data files (from settings), used for naming the files of each rack
+    std::string mInputFilename;
+    std::string mOutputFilename;
+    std::string mErrorFilename;
+
+    // each worker only writes the results of the racks it picked up so no locking is required for them
+    std::vector<RackResult_t> mRackResults;
+
+    // output files of the added racks (each rack should have its own output file)
+    std::set<Core::Path_t> mOutputFiles;
+
+    // index of the next rack to be picked up by a worker
+    std::atomic<size_t> mNextRackIndex;
+
+    IOMode mIOMode;
+    std::unique_ptr<AsyncFileIO> mpAsyncFileIO;   // only exists while processing (blocking I/O: only if output files get compressed, which is done by its threads)
+
+    // input file contents requested so far (by rack index), the racks following the ones being processed are read ahead
+    std::vector<std::future<AsyncFileIO::FileContent_t>> mInputFileContents;
+    size_t mReadAheadRacksCount;
+    std::mutex mReadAheadMutex;
+    std::string mIOBackendName;
+
+    static constexpr size_t scReadAheadRacksCount{64u};
+
+    // racks per worker waiting for their files to be written (compressed), so the I/O backend can write them together
+    static constexpr size_t scPendingRacksCount{32u};
+
+    std::chrono::milliseconds mTotalDuration;
+};
+
+#endif // BATCHPROCESSOR_H
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#include "directorywatcher.h"
+
+DirectoryWatcher::DirectoryWatcher(const Core::Path_t& watchedDir, const std::vector<std::string>& watchedSuffixes)
+    : mWatchedDir{watchedDir}
+    , mWatchedSuffixes{watchedSuffixes}
+    , mNotificationFd{-1}
+{
+    if (isValid())
+    {
+#ifdef __linux__
+        mNotificationFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+        // files are reported once fully written, either in place or by moving a temporary file over them (as most spreadsheet applications do)
+        if (mNotificationFd >= 0 && inotify_add_watch(mNotificationFd, mWatchedDir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+        {
+            close(mNotificationFd);
+            mNotificationFd = -1;
+        }
+#endif
+        for (const auto& c_File : _getWatchedFiles())
+        {
+            acknowledgeFile(c_File);
+        }
+    }
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+#ifdef __linux__
+    if (mNotificationFd >= 0)
+    {
+        close(mNotificationFd);
+    }
+#endif
+}
+
+bool DirectoryWatcher::isValid() const
+{
+    std::error_code errorCode;
+    return std::filesystem::is_directory(mWatchedDir, errorCode);
+}
+
+std::vector<Core::Path_t> DirectoryWatcher::waitForChanges(const volatile std::sig_atomic_t& isStopRequested)
+{
+    std::vector<Core::Path_t> changedFiles;
+    std::set<Core::Path_t> pendingFiles;
+
+    while (changedFiles.empty() && !isStopRequested)
+    {
+        const bool c_NewChangesDetected{_waitForEvents(pendingFiles, pendingFiles.empty() ? scPollingInterval : scDebounceInterval)};
+
+        // the pending files are only checked once no further changes occurred within the debounce interval
+        if (!c_NewChangesDetected && !pendingFiles.empty())
+        {
+            for (const auto& c_File : pendingFiles)
+            {
+                if (FileFingerprint_t fingerprint; _getFingerprint(c_File, fingerprint))
+                {
+                    if (const auto c_KnownIt{mKnownFingerprints.find(c_File)}; mKnownFingerprints.cend() == c_KnownIt || c_KnownIt->second != fingerprint)
+                    {
+                        mKnownFingerprints[c_File] = fingerprint;
+                        changedFiles.push_back(c_File);
+                    }
+                }
+                else
+                {
+                    mKnownFingerprints.erase(c_File); // file removed in the meantime
+                }
+            }
+
+            pendingFiles.clear();
+        }
+    }
+
+    return changedFiles;
+}
+
+void DirectoryWatcher::acknowledgeFile(const Core::Path_t& file)
+{
+    if (FileFingerprint_t fingerprint; _getFingerprint(file, fingerprint))
+    {
+        mKnownFingerprints[file] = fingerprint;
+        mPolledFingerprints[file] = fingerprint;
+    }
+}
+
+bool DirectoryWatcher::isNotificationBased() const
+{
+    return mNotificationFd >= 0;
+}
+
+bool DirectoryWatcher::_waitForEvents(std::set<Core::Path_t>& pendingFiles, const std::chrono::milliseconds interval)
+{
+    return mNotificationFd >= 0 ? _waitForNotifications(pendingFiles, interval) : _pollDirectory(pendingFiles, interval);
+}
+
+bool DirectoryWatcher::_waitForNotifications(std::set<Core::Path_t>& pendingFiles, const std::chrono::milliseconds interval)
+{
+    bool newChangesDetected{false};
+
+#ifdef __linux__
+    pollfd pollData{mNotificationFd, POLLIN, 0};
+
+    // a signal (e.g. stop request) interrupts the wait, in which case no changes are reported
+    if (poll(&pollData, 1, static_cast<int>(interval.count())) > 0 && (pollData.revents & POLLIN))
+    {
+        alignas(inotify_event) char buffer[4096];
+        ssize_t readBytesCount;
+
+        while ((readBytesCount = read(mNotificationFd, buffer, sizeof(buffer))) > 0)
+        {
+            for (ssize_t offset{0}; offset < readBytesCount;)
+            {
+                const inotify_event* const c_pEvent{reinterpret_cast<const inotify_event*>(buffer + offset)};
+
+                if (c_pEvent->mask & IN_Q_OVERFLOW) // events lost, all files need to be checked
+                {
+                    const std::vector<Core::Path_t> c_WatchedFiles{_getWatchedFiles()};
+                    pendingFiles.insert(c_WatchedFiles.cbegin(), c_WatchedFiles.cend());
+                    newChangesDetected = true;
+                }
+                else if (c_pEvent->len > 0u)
+                {
+                    if (const Core::Path_t c_File{mWatchedDir / c_pEvent->name}; _isWatchedFile(c_File))
+                    {
+                        pendingFiles.insert(c_File);
+                        newChangesDetected = true;
+                    }
+                }
+
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + c_pEvent->len);
+            }
+        }
+    }
+#else
+    (void)pendingFiles;
+    (void)interval;
+#endif
+
+    return newChangesDetected;
+}
+
+bool DirectoryWatcher::_pollDirectory(std::set<Core::Path_t>& pendingFiles, const std::chrono::milliseconds interval)
+{
+    bool newChangesDetected{false};
+
+    std::this_thread::sleep_for(interval);
+
+    for (const auto& c_File : _getWatchedFiles())
+    {
+        if (FileFingerprint_t fingerprint; _getFingerprint(c_File, fingerprint))
+        {
+            if (const auto c_PolledIt{mPolledFingerprints.find(c_File)}; mPolledFingerprints.cend() == c_PolledIt || c_PolledIt->second != fingerprint)
+            {
+                mPolledFingerprints[c_File] = fingerprint;
+                pendingFiles.insert(c_File);
+                newChangesDetected = true;
+            }
+        }
+    }
+
+    return newChangesDetected;
+}
+
+std::vector<Core::Path_t> DirectoryWatcher::_getWatchedFiles() const
+{
+    std::vector<Core::Path_t> watchedFiles;
+    std::error_code errorCode;
+
+    for (std::filesystem::directory_iterator dirIt{mWatchedDir, errorCode}; !errorCode && std::filesystem::directory_iterator{} != dirIt; dirIt.increment(errorCode))
+    {
+        if (dirIt->is_regular_file(errorCode) && _isWatchedFile(dirIt->path()))
+        {
+            watchedFiles.push_back(dirIt->path());
+        }
+    }
+
+    return watchedFiles;
+}
+
+bool DirectoryWatcher::_isWatchedFile(const Core::Path_t& file) const
+{
+    const std::string c_Filename{file.filename().string()};
+
+    return mWatchedSuffixes.cend() != std::find_if(mWatchedSuffixes.cbegin(), mWatchedSuffixes.cend(), [&c_Filename](const std::string& suffix) {
+        return c_Filename.size() >= suffix.size() && 0 == c_Filename.compare(c_Filename.size() - suffix.size(), suffix.size(), suffix);
+    });
+}
+
+bool DirectoryWatcher::_getFingerprint(const Core::Path_t& file, FileFingerprint_t& fingerprint)
+{
+    std::error_code errorCode;
+
+    fingerprint.mLastWriteTime = std::filesystem::last_write_time(file, errorCode);
+
+    if (!errorCode)
+    {
+        fingerprint.mSize = std::filesystem::file_size(file, errorCode);
+    }
+
+    return !errorCode;
+}
+
+bool DirectoryWatcher::FileFingerprint_t::operator==(const FileFingerprint_t& other) const
+{
+    return mLastWriteTime == other.mLastWriteTime && mSize == other.mSize;
+}
+
+bool DirectoryWatcher::FileFingerprint_t::operator!=(const FileFingerprint_t& other) const
+{
+    return !(*this == other);
+}
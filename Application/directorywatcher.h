@@ -0,0 +1,79 @@
+#ifndef DIRECTORYWATCHER_H
+#define DIRECTORYWATCHER_H
+
+#include <vector>
+#include <map>
+#include <set>
+#include <csignal>
+
+#include "coreutils.h"
+
+namespace Core = Utilities::Core;
+
+/* This class detects the changes of the files contained in a directory whose names end with one of the watched suffixes (e.g. connectioninput.csv)
+   On Linux the change notifications are received via inotify, otherwise (or if inotify is not available) the directory is polled periodically
+   In both cases the notifications are only used as hints: a file is reported as changed only if its fingerprint (modification time, size) differs from the last known one
+   This way the files written by the application itself can be ignored (see acknowledgeFile())
+*/
+class DirectoryWatcher
+{
+public:
+    DirectoryWatcher(const Core::Path_t& watchedDir, const std::vector<std::string>& watchedSuffixes);
+    ~DirectoryWatcher();
+
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+
+    /* Checks that the watched directory exists (the current state of the watched files is recorded at construction time and is not reported as change)
+    */
+    bool isValid() const;
+
+    /* Blocks until at least one watched file changed or stop is requested (e.g. from a signal handler)
+       The changes are debounced: the files are only reported once no further changes have been detected for a short interval (e.g. multiple writes when saving)
+    */
+    std::vector<Core::Path_t> waitForChanges(const volatile std::sig_atomic_t& isStopRequested);
+
+    /* Records the current state of a file so its current content is no longer reported as change (e.g. an output file written by application)
+    */
+    void acknowledgeFile(const Core::Path_t& file);
+
+    bool isNotificationBased() const;
+
+private:
+    struct FileFingerprint_t
+    {
+        std::filesystem::file_time_type mLastWriteTime;
+        std::uintmax_t mSize;
+
+        bool operator==(const FileFingerprint_t& other) const;
+        bool operator!=(const FileFingerprint_t& other) const;
+    };
+
+    /* Waits for the given interval and collects the watched files that might have changed into the pending files
+       Returns true if new changes were detected during the interval
+    */
+    bool _waitForEvents(std::set<Core::Path_t>& pendingFiles, const std::chrono::milliseconds interval);
+    bool _waitForNotifications(std::set<Core::Path_t>& pendingFiles, const std::chrono::milliseconds interval);
+    bool _pollDirectory(std::set<Core::Path_t>& pendingFiles, const std::chrono::milliseconds interval);
+
+    std::vector<Core::Path_t> _getWatchedFiles() const;
+    bool _isWatchedFile(const Core::Path_t& file) const;
+    static bool _getFingerprint(const Core::Path_t& file, FileFingerprint_t& fingerprint);
+
+    static constexpr std::chrono::milliseconds scPollingInterval{250};
+    static constexpr std::chrono::milliseconds scDebounceInterval{150};
+
+    const Core::Path_t mWatchedDir;
+    const std::vector<std::string> mWatchedSuffixes;
+
+    // state of the watched files when last processed (or acknowledged)
+    std::map<Core::Path_t, FileFingerprint_t> mKnownFingerprints;
+
+    // state of the watched files when last polled (only used if no notifications are available)
+    std::map<Core::Path_t, FileFingerprint_t> mPolledFingerprints;
+
+    // inotify file descriptor (-1 if notifications are not available)
+    int mNotificationFd;
+};
+
+#endif // DIRECTORYWATCHER_H
@@ -0,0 +1,527 @@
+#include "iouringfileio.h"
+
+#ifdef IO_URING_AVAILABLE
+
+#include <cerrno>
+#include <cstring>
+#include <climits>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "compression.h"
+
+IoUringFileIO::IoUringFileIO()
+    : mRingFileDescriptor{-1}
+    , mEventFileDescriptor{-1}
+    , mEventCounter{0u}
+    , mpSubmissionRing{MAP_FAILED}
+    , mSubmissionRingSize{0u}
+    , mpCompletionRing{MAP_FAILED}
+    , mCompletionRingSize{0u}
+    , mpSubmissionEntries{static_cast<io_uring_sqe*>(MAP_FAILED)}
+    , mSubmissionEntriesSize{0u}
+    , mpSubmissionHead{nullptr}
+    , mpSubmissionTail{nullptr}
+    , mpSubmissionArray{nullptr}
+    , mSubmissionMask{0u}
+    , mSubmissionEntriesCount{0u}
+    , mpCompletionHead{nullptr}
+    , mpCompletionTail{nullptr}
+    , mCompletionMask{0u}
+    , mpCompletionEntries{nullptr}
+    , mIsStopRequested{false}
+{
+    if (_setupRing() && _areOperationsSupported())
+    {
+        mEventFileDescriptor = eventfd(0, EFD_CLOEXEC);
+
+        if (mEventFileDescriptor >= 0)
+        {
+            mIOThread = std::thread{&IoUringFileIO::_processRequests, this};
+        }
+    }
+}
+
+/* The queued requests are still handled (so all provided futures get their results)
+*/
+IoUringFileIO::~IoUringFileIO()
+{
+    if (mIOThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock{mNewRequestsMutex};
+            mIsStopRequested = true;
+        }
+
+        const std::uint64_t c_Increment{1u};
+        const ssize_t c_Result{write(mEventFileDescriptor, &c_Increment, sizeof(c_Increment))};
+        (void)c_Result;
+
+        mIOThread.join();
+    }
+
+    // the I/O thread only exits once the eventfd read is no longer in flight, so the kernel cannot complete into the unmapped rings
+    if (MAP_FAILED != static_cast<void*>(mpSubmissionEntries))
+    {
+        munmap(mpSubmissionEntries, mSubmissionEntriesSize);
+    }
+
+    if (MAP_FAILED != mpCompletionRing && mpCompletionRing != mpSubmissionRing)
+    {
+        munmap(mpCompletionRing, mCompletionRingSize);
+    }
+
+    if (MAP_FAILED != mpSubmissionRing)
+    {
+        munmap(mpSubmissionRing, mSubmissionRingSize);
+    }
+
+    if (mRingFileDescriptor >= 0)
+    {
+        close(mRingFileDescriptor);
+    }
+
+    if (mEventFileDescriptor >= 0)
+    {
+        close(mEventFileDescriptor);
+    }
+}
+
+bool IoUringFileIO::isSetup() const
+{
+    return mIOThread.joinable();
+}
+
+std::future<AsyncFileIO::FileContent_t> IoUringFileIO::readFile(const Core::Path_t& file)
+{
+    std::unique_ptr<Request_t> pRequest{new Request_t{false, Operation::OPEN, file.string(), {}, {}, 0u, -1, false, {}, {}}};
+    std::future<FileContent_t> result{pRequest->mReadPromise.get_future()};
+
+    _addRequest(std::move(pRequest));
+
+    return result;
+}
+
+std::future<bool> IoUringFileIO::writeFile(const Core::Path_t& file, std::string content)
+{
+    std::unique_ptr<Request_t> pRequest{new Request_t{true, Operation::OPEN, file.string(), Core::getTemporaryFile(file).string(), std::move(content), 0u, -1, false, {}, {}}};
+    std::future<bool> result{pRequest->mWritePromise.get_future()};
+
+    _addRequest(std::move(pRequest));
+
+    return result;
+}
+
+std::string_view IoUringFileIO::getBackendName() const
+{
+    return "io_uring";
+}
+
+bool IoUringFileIO::_setupRing()
+{
+    io_uring_params params{};
+    mRingFileDescriptor = static_cast<int>(syscall(__NR_io_uring_setup, scRingEntriesCount, &params));
+
+    if (mRingFileDescriptor >= 0)
+    {
+        mSubmissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+        mCompletionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        // newer kernels map both rings at once
+        const bool c_IsSingleMapping{0u != (params.features & IORING_FEAT_SINGLE_MMAP)};
+
+        if (c_IsSingleMapping)
+        {
+            mSubmissionRingSize = std::max(mSubmissionRingSize, mCompletionRingSize);
+            mCompletionRingSize = mSubmissionRingSize;
+        }
+
+        mpSubmissionRing = mmap(nullptr, mSubmissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFileDescriptor, IORING_OFF_SQ_RING);
+        mpCompletionRing = c_IsSingleMapping ? mpSubmissionRing
+                                             : mmap(nullptr, mCompletionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFileDescriptor, IORING_OFF_CQ_RING);
+
+        mSubmissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        mpSubmissionEntries = static_cast<io_uring_sqe*>(mmap(nullptr, mSubmissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFileDescriptor, IORING_OFF_SQES));
+    }
+
+    const bool c_Success{MAP_FAILED != mpSubmissionRing && MAP_FAILED != mpCompletionRing && MAP_FAILED != static_cast<void*>(mpSubmissionEntries)};
+
+    if (c_Success)
+    {
+        unsigned char* const c_pSubmissionRing{static_cast<unsigned char*>(mpSubmissionRing)};
+        unsigned char* const c_pCompletionRing{static_cast<unsigned char*>(mpCompletionRing)};
+
+        mpSubmissionHead = reinterpret_cast<unsigned int*>(c_pSubmissionRing + params.sq_off.head);
+        mpSubmissionTail = reinterpret_cast<unsigned int*>(c_pSubmissionRing + params.sq_off.tail);
+        mpSubmissionArray = reinterpret_cast<unsigned int*>(c_pSubmissionRing + params.sq_off.array);
+        mSubmissionMask = *reinterpret_cast<unsigned int*>(c_pSubmissionRing + params.sq_off.ring_mask);
+        mSubmissionEntriesCount = params.sq_entries;
+        mpCompletionHead = reinterpret_cast<unsigned int*>(c_pCompletionRing + params.cq_off.head);
+        mpCompletionTail = reinterpret_cast<unsigned int*>(c_pCompletionRing + params.cq_off.tail);
+        mCompletionMask = *reinterpret_cast<unsigned int*>(c_pCompletionRing + params.cq_off.ring_mask);
+        mpCompletionEntries = reinterpret_cast<io_uring_cqe*>(c_pCompletionRing + params.cq_off.cqes);
+    }
+
+    return c_Success;
+}
+
+/* The file operations (open, close, rename) were added in later kernel versions than the ring itself (5.6, 5.11)
+*/
+bool IoUringFileIO::_areOperationsSupported() const
+{
+    constexpr unsigned int c_ProbedOperationsCount{256u};
+
+    std::vector<unsigned char> probeBuffer(sizeof(io_uring_probe) + c_ProbedOperationsCount * sizeof(io_uring_probe_op));
+    io_uring_probe* const c_pProbe{reinterpret_cast<io_uring_probe*>(probeBuffer.data())};
+
+    bool areSupported{syscall(__NR_io_uring_register, mRingFileDescriptor, IORING_REGISTER_PROBE, c_pProbe, c_ProbedOperationsCount) >= 0};
+
+    for (const unsigned int c_Operation : {IORING_OP_ASYNC_CANCEL, IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE, IORING_OP_RENAMEAT})
+    {
+        areSupported = areSupported && c_Operation < c_pProbe->ops_len && 0u != (c_pProbe->ops[c_Operation].flags & IO_URING_OP_SUPPORTED);
+    }
+
+    return areSupported;
+}
+
+/* The I/O thread takes all new requests at once, so it only needs to be woken up by the first one
+*/
+void IoUringFileIO::_addRequest(std::unique_ptr<Request_t> pRequest)
+{
+    bool isWakeUpRequired{false};
+
+    {
+        std::lock_guard<std::mutex> lock{mNewRequestsMutex};
+
+        isWakeUpRequired = mNewRequests.empty();
+        mNewRequests.push_back(std::move(pRequest));
+    }
+
+    if (isWakeUpRequired)
+    {
+        const std::uint64_t c_Increment{1u};
+        const ssize_t c_Result{write(mEventFileDescriptor, &c_Increment, sizeof(c_Increment))};
+        (void)c_Result;
+    }
+}
+
+/* I/O thread: each iteration submits the operations prepared so far and waits for at least one completion (a new request completes the eventfd read)
+   The in flight requests are owned by the ring (their address is the user data of the operation); the eventfd read and its cancellation have their own user data
+   When stopping, the eventfd read is cancelled and the thread exits only after both its completion and the cancellation one have been received
+*/
+void IoUringFileIO::_processRequests()
+{
+    std::deque<std::unique_ptr<Request_t>> readyRequests;
+    size_t inFlightRequestsCount{0u};
+    bool isEventReadInFlight{false};
+    bool isEventReadCancelled{false};
+    bool isCancelInFlight{false};
+    bool isStopRequested{false};
+
+    std::vector<std::unique_ptr<Request_t>> newRequests;
+
+    while (!isStopRequested || inFlightRequestsCount > 0u || !readyRequests.empty() || isEventReadInFlight || isCancelInFlight)
+    {
+        {
+            std::lock_guard<std::mutex> lock{mNewRequestsMutex};
+
+            newRequests.swap(mNewRequests);
+            isStopRequested = mIsStopRequested;
+        }
+
+        // compression is done outside the lock so the requesting threads are not blocked meanwhile
+        for (auto& pRequest : newRequests)
+        {
+            if (_compressContent(*pRequest))
+            {
+                readyRequests.push_back(std::move(pRequest));
+            }
+            else
+            {
+                _finishRequest(std::move(pRequest));
+            }
+        }
+
+        newRequests.clear();
+
+        if (!isEventReadInFlight && !isStopRequested)
+        {
+            isEventReadInFlight = _prepareEventRead();
+        }
+        else if (isEventReadInFlight && isStopRequested && !isEventReadCancelled)
+        {
+            isEventReadCancelled = _prepareEventReadCancel();
+            isCancelInFlight = isEventReadCancelled;
+        }
+
+        // the completion ring has twice the size of the submission ring so it cannot overflow
+        while (!readyRequests.empty() && inFlightRequestsCount < mSubmissionEntriesCount - 1u && _prepareOperation(*readyRequests.front()))
+        {
+            (void)readyRequests.front().release();
+            readyRequests.pop_front();
+            ++inFlightRequestsCount;
+        }
+
+        if (inFlightRequestsCount > 0u || isEventReadInFlight || isCancelInFlight)
+        {
+            const unsigned int c_SubmittedEntriesCount{*mpSubmissionTail - __atomic_load_n(mpSubmissionHead, __ATOMIC_ACQUIRE)};
+
+            // interrupted by a signal before submitting: the entries stay in the ring and are submitted by the next call
+            (void)syscall(__NR_io_uring_enter, mRingFileDescriptor, c_SubmittedEntriesCount, 1u, IORING_ENTER_GETEVENTS, nullptr, 0u);
+        }
+
+        unsigned int completionHead{*mpCompletionHead};
+
+        while (completionHead != __atomic_load_n(mpCompletionTail, __ATOMIC_ACQUIRE))
+        {
+            const io_uring_cqe& c_CompletionEntry{mpCompletionEntries[completionHead & mCompletionMask]};
+
+            if (scEventReadUserData == c_CompletionEntry.user_data)
+            {
+                isEventReadInFlight = false;
+            }
+            else if (scCancelUserData == c_CompletionEntry.user_data)
+            {
+                // the read might have completed meanwhile (not found) or be completing (already started), its own completion entry is awaited anyway
+                isCancelInFlight = false;
+            }
+            else
+            {
+                std::unique_ptr<Request_t> pRequest{reinterpret_cast<Request_t*>(c_CompletionEntry.user_data)};
+                --inFlightRequestsCount;
+
+                if (_completeOperation(*pRequest, c_CompletionEntry.res))
+                {
+                    readyRequests.push_back(std::move(pRequest));
+                }
+                else
+                {
+                    _finishRequest(std::move(pRequest));
+                }
+            }
+
+            ++completionHead;
+            __atomic_store_n(mpCompletionHead, completionHead, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+/* Only write requests of compressed files (.gz, .zst) are concerned, the content being replaced by its compressed version
+*/
+bool IoUringFileIO::_compressContent(Request_t& request)
+{
+    const Core::CompressionFormat c_CompressionFormat{request.mIsWriteRequest ? Core::getCompressionFormat(request.mFile) : Core::CompressionFormat::NONE};
+
+    if (std::string compressedContent; Core::CompressionFormat::NONE != c_CompressionFormat)
+    {
+        request.mIsFailed = !Core::compressContent(request.mContent, c_CompressionFormat, compressedContent);
+        request.mContent = std::move(compressedContent);
+    }
+
+    return !request.mIsFailed;
+}
+
+io_uring_sqe* IoUringFileIO::_getSubmissionEntry()
+{
+    io_uring_sqe* pSubmissionEntry{nullptr};
+
+    const unsigned int c_Tail{*mpSubmissionTail};
+
+    if (c_Tail - __atomic_load_n(mpSubmissionHead, __ATOMIC_ACQUIRE) < mSubmissionEntriesCount)
+    {
+        const unsigned int c_Index{c_Tail & mSubmissionMask};
+
+        pSubmissionEntry = &mpSubmissionEntries[c_Index];
+        std::memset(pSubmissionEntry, 0, sizeof(io_uring_sqe));
+        mpSubmissionArray[c_Index] = c_Index;
+
+        __atomic_store_n(mpSubmissionTail, c_Tail + 1u, __ATOMIC_RELEASE);
+    }
+
+    return pSubmissionEntry;
+}
+
+/* The entry is published before being filled in, which is safe as the kernel only reads the ring when entering it from this thread
+*/
+bool IoUringFileIO::_prepareOperation(Request_t& request)
+{
+    io_uring_sqe* const c_pEntry{_getSubmissionEntry()};
+
+    if (nullptr != c_pEntry)
+    {
+        c_pEntry->user_data = reinterpret_cast<std::uint64_t>(&request);
+
+        switch (request.mOperation)
+        {
+        case Operation::OPEN:
+            c_pEntry->opcode = IORING_OP_OPENAT;
+            c_pEntry->fd = AT_FDCWD;
+
+            if (request.mIsWriteRequest)
+            {
+                c_pEntry->addr = reinterpret_cast<std::uint64_t>(request.mTemporaryFile.c_str());
+                c_pEntry->open_flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+                c_pEntry->len = 0666;
+            }
+            else
+            {
+                c_pEntry->addr = reinterpret_cast<std::uint64_t>(request.mFile.c_str());
+                c_pEntry->open_flags = O_RDONLY | O_CLOEXEC;
+            }
+            break;
+        case Operation::READ:
+            // the buffer grows geometrically so big files need few reads
+            if (request.mContent.size() - request.mOffset < scReadChunkSize)
+            {
+                request.mContent.resize(std::max(2u * request.mContent.size(), request.mOffset + scReadChunkSize));
+            }
+
+            c_pEntry->opcode = IORING_OP_READ;
+            c_pEntry->fd = request.mFileDescriptor;
+            c_pEntry->addr = reinterpret_cast<std::uint64_t>(request.mContent.data() + request.mOffset);
+            c_pEntry->len = static_cast<std::uint32_t>(std::min<size_t>(request.mContent.size() - request.mOffset, INT_MAX));
+            c_pEntry->off = request.mOffset;
+            break;
+        case Operation::WRITE:
+            c_pEntry->opcode = IORING_OP_WRITE;
+            c_pEntry->fd = request.mFileDescriptor;
+            c_pEntry->addr = reinterpret_cast<std::uint64_t>(request.mContent.data() + request.mOffset);
+            c_pEntry->len = static_cast<std::uint32_t>(std::min<size_t>(request.mContent.size() - request.mOffset, INT_MAX));
+            c_pEntry->off = request.mOffset;
+            break;
+        case Operation::CLOSE:
+            c_pEntry->opcode = IORING_OP_CLOSE;
+            c_pEntry->fd = request.mFileDescriptor;
+            break;
+        case Operation::RENAME:
+            c_pEntry->opcode = IORING_OP_RENAMEAT;
+            c_pEntry->fd = AT_FDCWD;
+            c_pEntry->addr = reinterpret_cast<std::uint64_t>(request.mTemporaryFile.c_str());
+            c_pEntry->len = static_cast<std::uint32_t>(AT_FDCWD);
+            c_pEntry->addr2 = reinterpret_cast<std::uint64_t>(request.mFile.c_str());
+            break;
+        }
+    }
+
+    return nullptr != c_pEntry;
+}
+
+bool IoUringFileIO::_prepareEventRead()
+{
+    io_uring_sqe* const c_pEntry{_getSubmissionEntry()};
+
+    if (nullptr != c_pEntry)
+    {
+        c_pEntry->opcode = IORING_OP_READ;
+        c_pEntry->fd = mEventFileDescriptor;
+        c_pEntry->addr = reinterpret_cast<std::uint64_t>(&mEventCounter);
+        c_pEntry->len = sizeof(mEventCounter);
+        c_pEntry->user_data = scEventReadUserData;
+    }
+
+    return nullptr != c_pEntry;
+}
+
+bool IoUringFileIO::_prepareEventReadCancel()
+{
+    io_uring_sqe* const c_pEntry{_getSubmissionEntry()};
+
+    if (nullptr != c_pEntry)
+    {
+        c_pEntry->opcode = IORING_OP_ASYNC_CANCEL;
+        c_pEntry->addr = scEventReadUserData;
+        c_pEntry->user_data = scCancelUserData;
+    }
+
+    return nullptr != c_pEntry;
+}
+
+/* Moves the request to its next operation based on the result of the completed one (negative: error code)
+   Returns false if the request is finished
+*/
+bool IoUringFileIO::_completeOperation(Request_t& request, const int result)
+{
+    bool isNextOperationRequired{true};
+
+    switch (request.mOperation)
+    {
+    case Operation::OPEN:
+        if (result >= 0)
+        {
+            request.mFileDescriptor = result;
+            request.mOperation = !request.mIsWriteRequest ? Operation::READ : request.mContent.empty() ? Operation::CLOSE : Operation::WRITE;
+        }
+        else
+        {
+            request.mIsFailed = true;
+            isNextOperationRequired = false;
+        }
+        break;
+    case Operation::READ:
+        // the file is read until no more data is returned (a short read is not relied upon as end of file)
+        if (result > 0)
+        {
+            request.mOffset += static_cast<size_t>(result);
+        }
+        else
+        {
+            request.mIsFailed = result < 0;
+            request.mOperation = Operation::CLOSE;
+        }
+        break;
+    case Operation::WRITE:
+        if (result > 0)
+        {
+            request.mOffset += static_cast<size_t>(result);
+            request.mOperation = request.mOffset < request.mContent.size() ? Operation::WRITE : Operation::CLOSE;
+        }
+        else
+        {
+            request.mIsFailed = true;
+            request.mOperation = Operation::CLOSE;
+        }
+        break;
+    case Operation::CLOSE:
+        // for written files the close might report a delayed write error
+        request.mIsFailed = request.mIsFailed || result < 0;
+        request.mFileDescriptor = -1;
+        request.mOperation = Operation::RENAME;
+        isNextOperationRequired = request.mIsWriteRequest && !request.mIsFailed;
+        break;
+    case Operation::RENAME:
+        request.mIsFailed = result < 0;
+        isNextOperationRequired = false;
+        break;
+    }
+
+    return isNextOperationRequired;
+}
+
+void IoUringFileIO::_finishRequest(std::unique_ptr<Request_t> pRequest)
+{
+    if (pRequest->mIsWriteRequest)
+    {
+        if (pRequest->mIsFailed)
+        {
+            std::error_code errorCode;
+            (void)std::filesystem::remove(pRequest->mTemporaryFile, errorCode);
+        }
+
+        pRequest->mWritePromise.set_value(!pRequest->mIsFailed);
+    }
+    else if (pRequest->mIsFailed)
+    {
+        pRequest->mReadPromise.set_value(std::nullopt);
+    }
+    else
+    {
+        pRequest->mContent.resize(pRequest->mOffset);
+        pRequest->mReadPromise.set_value(std::move(pRequest->mContent));
+    }
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef IOURINGFILEIO_H
+#define IOURINGFILEIO_H
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define IO_URING_AVAILABLE
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "asyncfileio.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+/* Linux backend: a single I/O thread owns an io_uring instance (set up with raw system calls, no library required)
+   Each request is a chain of operations (read: open, read until end of file, close; write: open temporary file, write, close, rename), the next operation being submitted once the previous one completes
+   The operations of all pending requests are submitted and completed together, so a single system call serves many racks
+   New requests wake up the I/O thread by an eventfd read that is kept in flight (and cancelled when the instance is destroyed)
+*/
+class IoUringFileIO final : public AsyncFileIO
+{
+public:
+    IoUringFileIO();
+    ~IoUringFileIO() override;
+
+    IoUringFileIO(const IoUringFileIO&) = delete;
+    IoUringFileIO& operator=(const IoUringFileIO&) = delete;
+
+    /* False if io_uring is not available (e.g. old kernel, disabled by system settings or container policy) or lacks a required operation
+    */
+    bool isSetup() const;
+
+    std::future<FileContent_t> readFile(const Core::Path_t& file) override;
+    std::future<bool> writeFile(const Core::Path_t& file, std::string content) override;
+    std::string_view getBackendName() const override;
+
+private:
+    enum class Operation
+    {
+        OPEN,
+        READ,
+        WRITE,
+        CLOSE,
+        RENAME
+    };
+
+    struct Request_t
+    {
+        bool mIsWriteRequest;
+        Operation mOperation;
+        std::string mFile;
+        std::string mTemporaryFile;
+        std::string mContent;
+        size_t mOffset;
+        int mFileDescriptor;
+        bool mIsFailed;
+        std::promise<FileContent_t> mReadPromise;
+        std::promise<bool> mWritePromise;
+    };
+
+    bool _setupRing();
+    bool _areOperationsSupported() const;
+    void _addRequest(std::unique_ptr<Request_t> pRequest);
+    void _processRequests();
+
+    io_uring_sqe* _getSubmissionEntry();
+    bool _compressContent(Request_t& request);
+    bool _prepareOperation(Request_t& request);
+    bool _prepareEventRead();
+    bool _prepareEventReadCancel();
+    bool _completeOperation(Request_t& request, const int result);
+    void _finishRequest(std::unique_ptr<Request_t> pRequest);
+
+    static constexpr unsigned int scRingEntriesCount{256u};
+    static constexpr size_t scReadChunkSize{64u * 1024u};
+
+    // requests are referenced by their (aligned) address, so these values cannot clash with them
+    static constexpr std::uint64_t scEventReadUserData{0u};
+    static constexpr std::uint64_t scCancelUserData{1u};
+
+    int mRingFileDescriptor;
+    int mEventFileDescriptor;
+    std::uint64_t mEventCounter;
+
+    void* mpSubmissionRing;
+    size_t mSubmissionRingSize;
+    void* mpCompletionRing;
+    size_t mCompletionRingSize;
+    io_uring_sqe* mpSubmissionEntries;
+    size_t mSubmissionEntriesSize;
+
+    unsigned int* mpSubmissionHead;
+    unsigned int* mpSubmissionTail;
+    unsigned int* mpSubmissionArray;
+    unsigned int mSubmissionMask;
+    unsigned int mSubmissionEntriesCount;
+    unsigned int* mpCompletionHead;
+    unsigned int* mpCompletionTail;
+    unsigned int mCompletionMask;
+    io_uring_cqe* mpCompletionEntries;
+
+    std::vector<std::unique_ptr<Request_t>> mNewRequests;
+    std::mutex mNewRequestsMutex;
+    bool mIsStopRequested;
+    std::thread mIOThread;
+};
+
+#endif
+
+#endif // IOURINGFILEIO_H
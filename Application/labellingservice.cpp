@@ -0,0 +1,408 @@
+#include <algorithm>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#include "appsettings.h"
+#include "labelformats.h"
+#include "devicecatalog.h"
+#include "labellingservice.h"
+
+LabellingService::LabellingService(const Core::Path_t& socketFile, const size_t workersCount)
+    : mSocketFile{socketFile}
+    , mWorkersCount{workersCount > 0u ? workersCount : std::max(1u, std::thread::hardware_concurrency())}
+    , mListeningFd{-1}
+    , mIsStopping{false}
+    , mHandledRequestsCount{0u}
+{
+}
+
+LabellingService::~LabellingService()
+{
+#ifndef _WIN32
+    // the socket file is only removed if created by this service (otherwise it might belong to another running service)
+    if (mListeningFd >= 0)
+    {
+        close(mListeningFd);
+
+        std::error_code errorCode;
+        (void)std::filesystem::remove(mSocketFile, errorCode);
+    }
+#endif
+}
+
+bool LabellingService::start()
+{
+    bool success{false};
+
+#ifndef _WIN32
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    if (const std::string c_SocketFile{mSocketFile.string()}; mListeningFd < 0 && !c_SocketFile.empty() && c_SocketFile.size() < sizeof(address.sun_path))
+    {
+        std::copy(c_SocketFile.cbegin(), c_SocketFile.cend(), address.sun_path);
+
+        // a socket file left behind by a service that is no longer running can be replaced
+        if (std::error_code errorCode; std::filesystem::exists(mSocketFile, errorCode))
+        {
+            bool isServiceRunning{false};
+
+            if (const int c_ProbeFd{socket(AF_UNIX, SOCK_STREAM, 0)}; c_ProbeFd >= 0)
+            {
+                isServiceRunning = 0 == connect(c_ProbeFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+                close(c_ProbeFd);
+            }
+
+            if (!isServiceRunning)
+            {
+                (void)std::filesystem::remove(mSocketFile, errorCode);
+            }
+        }
+
+        mListeningFd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (mListeningFd >= 0 && 0 == bind(mListeningFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)))
+        {
+            if (0 == listen(mListeningFd, SOMAXCONN))
+            {
+                // only the user running the service should be able to send requests
+                std::error_code errorCode;
+                std::filesystem::permissions(mSocketFile, std::filesystem::perms::owner_read | std::filesystem::perms::owner_write, errorCode);
+
+                success = true;
+            }
+            else
+            {
+                close(mListeningFd);
+                mListeningFd = -1;
+
+                std::error_code errorCode;
+                (void)std::filesystem::remove(mSocketFile, errorCode);
+            }
+        }
+        else if (mListeningFd >= 0)
+        {
+            close(mListeningFd);
+            mListeningFd = -1;
+        }
+    }
+#endif
+
+    return success;
+}
+
+void LabellingService::run(const volatile std::sig_atomic_t& isStopRequested)
+{
+#ifndef _WIN32
+    if (mListeningFd >= 0)
+    {
+        // the singletons are lazily created and their creation is not thread safe so this should be done before starting the workers (afterwards they are only read)
+        (void)AppSettings::getInstance();
+        (void)LabelFormats::getInstance();
+        (void)DeviceCatalog::getInstance();
+
+        mIsStopping = false;
+
+        std::vector<std::thread> workers;
+        workers.reserve(mWorkersCount);
+
+        for (size_t workerNumber{0u}; workerNumber < mWorkersCount; ++workerNumber)
+        {
+            workers.emplace_back(&LabellingService::_handleConnections, this);
+        }
+
+        pollfd pollData{mListeningFd, POLLIN, 0};
+
+        // the waiting is interrupted periodically (or by signals) in order to check the stop request
+        while (!isStopRequested)
+        {
+            if (poll(&pollData, 1, scStopCheckInterval) > 0 && (pollData.revents & POLLIN))
+            {
+                if (const int c_ConnectionFd{accept(mListeningFd, nullptr, nullptr)}; c_ConnectionFd >= 0)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock{mPendingConnectionsMutex};
+                        mPendingConnections.push(c_ConnectionFd);
+                    }
+
+                    mPendingConnectionsCondition.notify_one();
+                }
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mPendingConnectionsMutex};
+            mIsStopping = true;
+        }
+
+        mPendingConnectionsCondition.notify_all();
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        while (!mPendingConnections.empty())
+        {
+            close(mPendingConnections.front());
+            mPendingConnections.pop();
+        }
+    }
+#else
+    (void)isStopRequested;
+#endif
+}
+
+size_t LabellingService::getWorkersCount() const
+{
+    return mWorkersCount;
+}
+
+size_t LabellingService::getHandledRequestsCount() const
+{
+    return mHandledRequestsCount;
+}
+
+std::string_view LabellingService::getOperationKeyword(const ParserCreator::ParserTypes parserType)
+{
+    std::string_view operationKeyword;
+
+    switch(parserType)
+    {
+    case ParserCreator::ParserTypes::CONNECTION_DEFINITION:
+        operationKeyword = "define";
+        break;
+    case ParserCreator::ParserTypes::CONNECTION_INPUT:
+        operationKeyword = "label";
+        break;
+    default:
+        break;
+    }
+
+    return operationKeyword;
+}
+
+ParserCreator::ParserTypes LabellingService::getParserType(const std::string_view operationKeyword)
+{
+    ParserCreator::ParserTypes parserType{ParserCreator::ParserTypes::UNKNOWN};
+
+    if (getOperationKeyword(ParserCreator::ParserTypes::CONNECTION_DEFINITION) == operationKeyword)
+    {
+        parserType = ParserCreator::ParserTypes::CONNECTION_DEFINITION;
+    }
+    else if (getOperationKeyword(ParserCreator::ParserTypes::CONNECTION_INPUT) == operationKeyword)
+    {
+        parserType = ParserCreator::ParserTypes::CONNECTION_INPUT;
+    }
+
+    return parserType;
+}
+
+std::string_view LabellingService::getRequestStatusAsString(const RequestStatus requestStatus)
+{
+    std::string_view requestStatusString;
+
+    switch(requestStatus)
+    {
+    case RequestStatus::OK:
+        requestStatusString = "OK";
+        break;
+    case RequestStatus::PARSING_ERROR:
+        requestStatusString = "PARSING_ERROR";
+        break;
+    case RequestStatus::INVALID_REQUEST:
+        requestStatusString = "INVALID_REQUEST";
+        break;
+    }
+
+    return requestStatusString;
+}
+
+bool LabellingService::writeData(const int socketFd, const std::string_view data)
+{
+    bool success{true};
+
+#ifndef _WIN32
+    // a client that closed the connection early should not terminate the whole process (SIGPIPE)
+#ifdef MSG_NOSIGNAL
+    constexpr int c_SendFlags{MSG_NOSIGNAL};
+#else
+    constexpr int c_SendFlags{0};
+#endif
+
+    for (size_t writtenBytesCount{0u}; success && writtenBytesCount < data.size();)
+    {
+        if (const ssize_t c_SentBytesCount{send(socketFd, data.data() + writtenBytesCount, data.size() - writtenBytesCount, c_SendFlags)}; c_SentBytesCount > 0)
+        {
+            writtenBytesCount += static_cast<size_t>(c_SentBytesCount);
+        }
+        else if (c_SentBytesCount < 0 && EINTR == errno)
+        {
+            // interrupted by signal, try again
+        }
+        else
+        {
+            success = false;
+        }
+    }
+#else
+    (void)socketFd;
+    success = data.empty();
+#endif
+
+    return success;
+}
+
+bool LabellingService::readData(const int socketFd, std::string& data, const size_t maxSize)
+{
+    bool success{false};
+
+#ifndef _WIN32
+    bool isEndOfStreamReached{false};
+    char buffer[16384];
+
+    data.clear();
+
+    while (!isEndOfStreamReached && data.size() <= maxSize)
+    {
+        if (const ssize_t c_ReceivedBytesCount{recv(socketFd, buffer, sizeof(buffer), 0)}; c_ReceivedBytesCount > 0)
+        {
+            data.append(buffer, static_cast<size_t>(c_ReceivedBytesCount));
+        }
+        else if (0 == c_ReceivedBytesCount)
+        {
+            isEndOfStreamReached = true;
+            success = data.size() <= maxSize;
+        }
+        else if (EINTR != errno)
+        {
+            isEndOfStreamReached = true; // error or timeout
+        }
+    }
+#else
+    (void)socketFd;
+    (void)data;
+    (void)maxSize;
+#endif
+
+    return success;
+}
+
+void LabellingService::_handleConnections()
+{
+    WarmParsers_t warmParsers{_createWarmParsers()};
+    bool isStopping{false};
+
+    while (!isStopping)
+    {
+        int connectionFd{-1};
+
+        {
+            std::unique_lock<std::mutex> lock{mPendingConnectionsMutex};
+            mPendingConnectionsCondition.wait(lock, [this]() {return mIsStopping || !mPendingConnections.empty();});
+
+            isStopping = mIsStopping;
+
+            if (!isStopping)
+            {
+                connectionFd = mPendingConnections.front();
+                mPendingConnections.pop();
+            }
+        }
+
+        if (connectionFd >= 0)
+        {
+            _handleConnection(connectionFd, warmParsers);
+        }
+    }
+}
+
+void LabellingService::_handleConnection(const int connectionFd, WarmParsers_t& warmParsers)
+{
+#ifndef _WIN32
+    timeval timeout{};
+    timeout.tv_sec = static_cast<decltype(timeout.tv_sec)>(scSocketTimeout.count());
+
+    (void)setsockopt(connectionFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    (void)setsockopt(connectionFd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    std::string request;
+    const RequestStatus c_RequestStatus{readData(connectionFd, request, scMaxRequestSize) ? _handleRequest(request, warmParsers) : RequestStatus::INVALID_REQUEST};
+
+    // for an invalid request the streams might still contain the data of the previous request
+    const std::string c_Output{RequestStatus::INVALID_REQUEST != c_RequestStatus ? warmParsers.mpOutputStream->str() : ""};
+    const std::string c_Errors{RequestStatus::INVALID_REQUEST != c_RequestStatus ? warmParsers.mpErrorStream->str() : ""};
+
+    std::string responseHeader{getRequestStatusAsString(c_RequestStatus)};
+    responseHeader += " " + std::to_string(c_Output.size()) + " " + std::to_string(c_Errors.size()) + "\n";
+
+    (void)(writeData(connectionFd, responseHeader) && writeData(connectionFd, c_Output) && writeData(connectionFd, c_Errors));
+
+    close(connectionFd);
+    ++mHandledRequestsCount;
+#else
+    (void)connectionFd;
+    (void)warmParsers;
+#endif
+}
+
+LabellingService::RequestStatus LabellingService::_handleRequest(const std::string_view request, WarmParsers_t& warmParsers) const
+{
+    RequestStatus requestStatus{RequestStatus::INVALID_REQUEST};
+
+    if (const size_t c_OperationEnd{request.find('\n')}; std::string_view::npos != c_OperationEnd)
+    {
+        std::string_view operationKeyword{request.substr(0, c_OperationEnd)};
+
+        if (!operationKeyword.empty() && '\r' == operationKeyword.back())
+        {
+            operationKeyword.remove_suffix(1);
+        }
+
+        const ParserCreator::ParserTypes c_ParserType{getParserType(operationKeyword)};
+        Parser* const c_pParser{ParserCreator::ParserTypes::CONNECTION_DEFINITION == c_ParserType ? warmParsers.mpConnectionDefinitionParser.get() :
+                                ParserCreator::ParserTypes::CONNECTION_INPUT == c_ParserType      ? warmParsers.mpConnectionInputParser.get()      : nullptr};
+
+        if (c_pParser)
+        {
+            // the streams are rewound and their states cleared (the input stream reached its end in the previous parsing session)
+            warmParsers.mpInputStream->str(std::string{request.substr(c_OperationEnd + 1)});
+            warmParsers.mpInputStream->clear();
+            warmParsers.mpOutputStream->str({});
+            warmParsers.mpOutputStream->clear();
+            warmParsers.mpErrorStream->str({});
+            warmParsers.mpErrorStream->clear();
+
+            const bool c_ParsingErrorsOccurred{c_pParser->parse()};
+            requestStatus = !c_ParsingErrorsOccurred ? RequestStatus::OK : RequestStatus::PARSING_ERROR;
+        }
+    }
+
+    return requestStatus;
+}
+
+LabellingService::WarmParsers_t LabellingService::_createWarmParsers()
+{
+    WarmParsers_t warmParsers{std::make_shared<std::stringstream>(), std::make_shared<std::stringstream>(), std::make_shared<std::stringstream>(), nullptr, nullptr};
+
+    // each parser creator creates exactly one parser
+    ParserCreator connectionDefinitionParserCreator;
+    ParserCreator connectionInputParserCreator;
+
+    warmParsers.mpConnectionDefinitionParser = connectionDefinitionParserCreator.createParser(ParserCreator::ParserTypes::CONNECTION_DEFINITION,
+                                                                                              warmParsers.mpInputStream, warmParsers.mpOutputStream, warmParsers.mpErrorStream);
+    warmParsers.mpConnectionInputParser = connectionInputParserCreator.createParser(ParserCreator::ParserTypes::CONNECTION_INPUT,
+                                                                                    warmParsers.mpInputStream, warmParsers.mpOutputStream, warmParsers.mpErrorStream);
+
+    ASSERT(warmParsers.mpConnectionDefinitionParser && warmParsers.mpConnectionInputParser, "The service parsers could not be created");
+
+    return warmParsers;
+}
@@ -0,0 +1,105 @@
+#ifndef LABELLINGSERVICE_H
+#define LABELLINGSERVICE_H
+
+#include <vector>
+#include <queue>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <csignal>
+
+#include "parsercreator.h"
+
+/* This class serves parsing requests (option 1 or 2) received on a local (Unix domain) socket, so other tools can get the labels of a rack without starting the application each time
+   Protocol (one request per connection):
+    - request: operation keyword ("define" or "label") on the first row, followed by the content of the input file; the client ends the request by shutting down its writing side
+    - response: status row "<status> <output size> <errors size>" (sizes in bytes), followed by the output file content and the error file content
+      status: OK, PARSING_ERROR (only the errors are provided) or INVALID_REQUEST (no content provided)
+   The requests are handled by a fixed pool of worker threads. Each worker keeps its own parsers (bound to memory streams) and reuses them for all the requests it handles
+*/
+class LabellingService
+{
+public:
+    enum class RequestStatus
+    {
+        OK,
+        PARSING_ERROR,
+        INVALID_REQUEST
+    };
+
+    /* The number of workers is the number of requests that can be handled in parallel (0 means: use the hardware concurrency)
+    */
+    LabellingService(const Core::Path_t& socketFile, const size_t workersCount);
+    ~LabellingService();
+
+    LabellingService(const LabellingService&) = delete;
+    LabellingService& operator=(const LabellingService&) = delete;
+
+    /* Creates the socket file and starts listening. A stale socket file (no service listening on it) is replaced
+       Returns false if the socket cannot be setup (e.g. another service is already running)
+    */
+    bool start();
+
+    /* Accepts the connections and dispatches them to workers until stop is requested (e.g. from a signal handler)
+       The requests that are in progress when stopping are completed, the pending ones are dropped
+    */
+    void run(const volatile std::sig_atomic_t& isStopRequested);
+
+    size_t getWorkersCount() const;
+    size_t getHandledRequestsCount() const;
+
+    /* Conversions between parser types and the operation keywords used in requests (UNKNOWN/empty if no match)
+    */
+    static std::string_view getOperationKeyword(const ParserCreator::ParserTypes parserType);
+    static ParserCreator::ParserTypes getParserType(const std::string_view operationKeyword);
+
+    static std::string_view getRequestStatusAsString(const RequestStatus requestStatus);
+
+    /* Socket I/O helpers (also used by client). Reading stops at end of stream, returns false on error/timeout or if the data exceeds the maximum size
+    */
+    static bool writeData(const int socketFd, const std::string_view data);
+    static bool readData(const int socketFd, std::string& data, const size_t maxSize);
+
+    static constexpr std::string_view scDefaultSocketFilename{"labelcalculator.sock"};
+
+    // a connection input file for a full rack is a few hundred KB so this is just a safety limit
+    static constexpr size_t scMaxRequestSize{64u * 1024u * 1024u};
+
+    // clients that stop sending/receiving data should not block a worker forever
+    static constexpr std::chrono::seconds scSocketTimeout{5};
+
+private:
+    // memory streams and parsers created once per worker (the parsers reset their state before each parsing session)
+    struct WarmParsers_t
+    {
+        std::shared_ptr<std::stringstream> mpInputStream;
+        std::shared_ptr<std::stringstream> mpOutputStream;
+        std::shared_ptr<std::stringstream> mpErrorStream;
+        ParserPtr mpConnectionDefinitionParser;
+        ParserPtr mpConnectionInputParser;
+    };
+
+    void _handleConnections();
+    void _handleConnection(const int connectionFd, WarmParsers_t& warmParsers);
+    RequestStatus _handleRequest(const std::string_view request, WarmParsers_t& warmParsers) const;
+
+    static WarmParsers_t _createWarmParsers();
+
+    // maximum time (ms) between two consecutive checks of the stop request
+    static constexpr int scStopCheckInterval{250};
+
+    const Core::Path_t mSocketFile;
+    const size_t mWorkersCount;
+
+    int mListeningFd;
+
+    // connections accepted but not yet picked up by a worker
+    std::queue<int> mPendingConnections;
+    std::mutex mPendingConnectionsMutex;
+    std::condition_variable mPendingConnectionsCondition;
+    bool mIsStopping;
+
+    std::atomic<size_t> mHandledRequestsCount;
+};
+
+#endif // LABELLINGSERVICE_H
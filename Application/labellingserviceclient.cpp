@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "labellingserviceclient.h"
+
+LabellingServiceClient::LabellingServiceClient(const Core::Path_t& socketFile)
+    : mSocketFile{socketFile}
+{
+}
+
+bool LabellingServiceClient::sendRequest(const ParserCreator::ParserTypes parserType, const std::string_view inputData, Response_t& response) const
+{
+    bool success{false};
+
+#ifndef _WIN32
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    const std::string c_SocketFile{mSocketFile.string()};
+    const std::string_view c_OperationKeyword{LabellingService::getOperationKeyword(parserType)};
+
+    if (!c_OperationKeyword.empty() && !c_SocketFile.empty() && c_SocketFile.size() < sizeof(address.sun_path))
+    {
+        std::copy(c_SocketFile.cbegin(), c_SocketFile.cend(), address.sun_path);
+
+        if (const int c_SocketFd{socket(AF_UNIX, SOCK_STREAM, 0)}; c_SocketFd >= 0)
+        {
+            std::string rawResponse;
+
+            // the writing side is shut down once the request is sent so the service knows the request is complete
+            success = 0 == connect(c_SocketFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) &&
+                      LabellingService::writeData(c_SocketFd, std::string{c_OperationKeyword} + "\n") &&
+                      LabellingService::writeData(c_SocketFd, inputData) &&
+                      0 == shutdown(c_SocketFd, SHUT_WR) &&
+                      LabellingService::readData(c_SocketFd, rawResponse, scMaxResponseSize) &&
+                      _parseResponse(rawResponse, response);
+
+            close(c_SocketFd);
+        }
+    }
+#else
+    (void)parserType;
+    (void)inputData;
+    (void)response;
+#endif
+
+    return success;
+}
+
+LabellingServiceClient::LoadTestResult_t LabellingServiceClient::runLoadTest(const ParserCreator::ParserTypes parserType, const std::string_view inputData, const size_t requestsCount,
+                                                                             const size_t clientsCount) const
+{
+    const size_t c_ClientsCount{std::max<size_t>(1u, std::min(clientsCount, requestsCount))};
+
+    // each client only writes the latencies of its own requests so no locking is required
+    std::vector<std::vector<std::chrono::microseconds>> clientLatencies(c_ClientsCount);
+    std::atomic<size_t> nextRequestIndex{0u};
+    std::atomic<size_t> failedRequestsCount{0u};
+
+    const auto c_SendRequests{[&](std::vector<std::chrono::microseconds>& latencies) {
+        Response_t response;
+
+        while (nextRequestIndex++ < requestsCount)
+        {
+            const auto c_RequestStartTime{std::chrono::steady_clock::now()};
+
+            if (sendRequest(parserType, inputData, response))
+            {
+                latencies.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - c_RequestStartTime));
+            }
+            else
+            {
+                ++failedRequestsCount;
+            }
+        }
+    }};
+
+    const auto c_StartTime{std::chrono::steady_clock::now()};
+
+    std::vector<std::thread> clients;
+    clients.reserve(c_ClientsCount);
+
+    for (auto& latencies : clientLatencies)
+    {
+        clients.emplace_back(c_SendRequests, std::ref(latencies));
+    }
+
+    for (auto& client : clients)
+    {
+        client.join();
+    }
+
+    LoadTestResult_t loadTestResult{requestsCount, failedRequestsCount, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - c_StartTime),
+                                    std::chrono::microseconds{0}, std::chrono::microseconds{0}, std::chrono::microseconds{0}, 0.0};
+
+    std::vector<std::chrono::microseconds> latencies;
+
+    for (const auto& c_ClientLatencies : clientLatencies)
+    {
+        latencies.insert(latencies.end(), c_ClientLatencies.cbegin(), c_ClientLatencies.cend());
+    }
+
+    if (!latencies.empty())
+    {
+        std::sort(latencies.begin(), latencies.end());
+
+        // nearest rank percentiles
+        const size_t c_LatenciesCount{latencies.size()};
+
+        loadTestResult.mMedianLatency = latencies[(c_LatenciesCount * 50u + 99u) / 100u - 1u];
+        loadTestResult.mP99Latency = latencies[(c_LatenciesCount * 99u + 99u) / 100u - 1u];
+        loadTestResult.mMaxLatency = latencies.back();
+    }
+
+    if (loadTestResult.mDuration.count() > 0)
+    {
+        loadTestResult.mRequestsPerSecond = static_cast<double>(latencies.size()) * 1000000.0 / static_cast<double>(loadTestResult.mDuration.count());
+    }
+
+    return loadTestResult;
+}
+
+void LabellingServiceClient::writeLoadTestResult(const LoadTestResult_t& loadTestResult, std::ostream& outStream)
+{
+    const auto c_ToMilliseconds{[](const std::chrono::microseconds duration) {return static_cast<double>(duration.count()) / 1000.0;}};
+
+    outStream << std::fixed << std::setprecision(3);
+    outStream << "Requests: " << loadTestResult.mRequestsCount << " (failed: " << loadTestResult.mFailedRequestsCount << ")\n";
+    outStream << "Duration (ms): " << c_ToMilliseconds(loadTestResult.mDuration) << "\n";
+    outStream << "Requests/sec: " << std::setprecision(1) << loadTestResult.mRequestsPerSecond << std::setprecision(3) << "\n";
+    outStream << "Latency (ms): median " << c_ToMilliseconds(loadTestResult.mMedianLatency) << ", p99 " << c_ToMilliseconds(loadTestResult.mP99Latency)
+              << ", max " << c_ToMilliseconds(loadTestResult.mMaxLatency) << "\n";
+    outStream << std::defaultfloat;
+}
+
+/* Response format: status row "<status> <output size> <errors size>" followed by the output and errors content
+*/
+bool LabellingServiceClient::_parseResponse(const std::string& rawResponse, Response_t& response)
+{
+    bool success{false};
+
+    if (const size_t c_HeaderEnd{rawResponse.find('\n')}; std::string::npos != c_HeaderEnd)
+    {
+        std::istringstream headerStream{rawResponse.substr(0, c_HeaderEnd)};
+        std::string status;
+        size_t outputSize{0u};
+        size_t errorsSize{0u};
+
+        if (headerStream >> status >> outputSize >> errorsSize && rawResponse.size() - c_HeaderEnd - 1 == outputSize + errorsSize)
+        {
+            for (const auto c_Status : {LabellingService::RequestStatus::OK, LabellingService::RequestStatus::PARSING_ERROR, LabellingService::RequestStatus::INVALID_REQUEST})
+            {
+                if (LabellingService::getRequestStatusAsString(c_Status) == status)
+                {
+                    response.mStatus = c_Status;
+                    response.mOutput = rawResponse.substr(c_HeaderEnd + 1, outputSize);
+                    response.mErrors = rawResponse.substr(c_HeaderEnd + 1 + outputSize);
+                    success = true;
+                }
+            }
+        }
+    }
+
+    return success;
+}
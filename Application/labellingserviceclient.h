@@ -0,0 +1,51 @@
+#ifndef LABELLINGSERVICECLIENT_H
+#define LABELLINGSERVICECLIENT_H
+
+#include "labellingservice.h"
+
+/* This class sends requests to a running labelling service (see LabellingService for the protocol)
+   It can also generate load (same request sent repeatedly by multiple concurrent clients) for measuring the service throughput and latency
+*/
+class LabellingServiceClient
+{
+public:
+    struct Response_t
+    {
+        LabellingService::RequestStatus mStatus;
+        std::string mOutput;                    // output file content (empty if errors occurred)
+        std::string mErrors;                    // error file content
+    };
+
+    struct LoadTestResult_t
+    {
+        size_t mRequestsCount;
+        size_t mFailedRequestsCount;            // no (valid) response received
+        std::chrono::microseconds mDuration;
+        std::chrono::microseconds mMedianLatency;
+        std::chrono::microseconds mP99Latency;
+        std::chrono::microseconds mMaxLatency;
+        double mRequestsPerSecond;
+    };
+
+    explicit LabellingServiceClient(const Core::Path_t& socketFile);
+
+    /* Sends one request and waits for the response. Returns false if the service cannot be reached or the response is invalid
+    */
+    bool sendRequest(const ParserCreator::ParserTypes parserType, const std::string_view inputData, Response_t& response) const;
+
+    /* Sends the same request the given number of times, spread among the concurrent clients (each one waiting for a response before sending its next request)
+    */
+    LoadTestResult_t runLoadTest(const ParserCreator::ParserTypes parserType, const std::string_view inputData, const size_t requestsCount, const size_t clientsCount) const;
+
+    static void writeLoadTestResult(const LoadTestResult_t& loadTestResult, std::ostream& outStream);
+
+private:
+    static bool _parseResponse(const std::string& rawResponse, Response_t& response);
+
+    // the labelling table is larger than the connection input file it is calculated from
+    static constexpr size_t scMaxResponseSize{4u * LabellingService::scMaxRequestSize};
+
+    const Core::Path_t mSocketFile;
+};
+
+#endif // LABELLINGSERVICECLIENT_H
@@ -0,0 +1,57 @@
+#include "filelock.h"
+#include "runworkspace.h"
+
+RunWorkspace::RunWorkspace(const Core::Path_t& workspaceDir)
+    : mWorkspaceDir{workspaceDir}
+{
+}
+
+RunWorkspace::~RunWorkspace()
+{
+    if (!mRunDir.empty())
+    {
+        std::error_code errorCode;
+        (void)std::filesystem::remove_all(mRunDir, errorCode);
+    }
+}
+
+/* The run directory is named by the start time and made unique among the running processes and threads (e.g. run_2024-05-01_143000.4711.0.tmp)
+*/
+bool RunWorkspace::create()
+{
+    bool success{false};
+
+    if (!mWorkspaceDir.empty() && mRunDir.empty())
+    {
+        std::error_code errorCode;
+        (void)std::filesystem::create_directories(mWorkspaceDir, errorCode);
+
+        const Core::Path_t c_RunDir{Core::getTemporaryFile(mWorkspaceDir / (std::string{scRunDirPrefix} + Core::getDateTimeString(std::chrono::system_clock::now())))};
+
+        // an existing directory is not reused (it belongs to another run)
+        if (!errorCode && std::filesystem::create_directory(c_RunDir, errorCode) && !errorCode)
+        {
+            mRunDir = c_RunDir;
+            success = true;
+        }
+    }
+
+    return success;
+}
+
+Core::Path_t RunWorkspace::getRunFile(const Core::Path_t& publishedFile) const
+{
+    return mRunDir / publishedFile.filename();
+}
+
+bool RunWorkspace::publish(const Core::Path_t& publishedFile) const
+{
+    const bool c_Success{!mRunDir.empty() && Core::replaceFile(getRunFile(publishedFile), publishedFile)};
+
+    return c_Success;
+}
+
+Core::Path_t RunWorkspace::getLockFile(const Core::Path_t& publishedFile) const
+{
+    return Core::FileLock::getLockFile(mWorkspaceDir / scLocksDirName, publishedFile);
+}
@@ -0,0 +1,46 @@
+#ifndef RUNWORKSPACE_H
+#define RUNWORKSPACE_H
+
+#include "coreutils.h"
+
+namespace Core = Utilities::Core;
+
+/* Private directory of a single run, created within the workspace directory: the output and error files are written there and published (moved over the data files) once complete
+   Concurrent runs thereby never write to the same files, while each published file is either the previous or the new complete one
+   The run directory is removed (together with any unpublished file) when the object is destroyed
+*/
+class RunWorkspace
+{
+public:
+    explicit RunWorkspace(const Core::Path_t& workspaceDir);
+    ~RunWorkspace();
+
+    RunWorkspace(const RunWorkspace&) = delete;
+    RunWorkspace& operator=(const RunWorkspace&) = delete;
+
+    /* Creates the run directory (unique name) and, if missing, the workspace directory. Returns false if the directory cannot be created
+    */
+    bool create();
+
+    /* Returns the file to be written within the run directory in place of the given (published) file
+    */
+    Core::Path_t getRunFile(const Core::Path_t& publishedFile) const;
+
+    /* Moves the run file over the published file (even if not residing on the same file system)
+    */
+    bool publish(const Core::Path_t& publishedFile) const;
+
+    /* Returns the lock file held while replacing the published file (residing in the locks subdirectory of the workspace directory, shared by all runs)
+       No run directory is required
+    */
+    Core::Path_t getLockFile(const Core::Path_t& publishedFile) const;
+
+private:
+    static constexpr std::string_view scRunDirPrefix{"run_"};
+    static constexpr std::string_view scLocksDirName{"locks"};
+
+    const Core::Path_t mWorkspaceDir;
+    Core::Path_t mRunDir;
+};
+
+#endif // RUNWORKSPACE_H
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include "compression.h"
+#include "threadpoolfileio.h"
+
+ThreadPoolFileIO::ThreadPoolFileIO(const size_t threadsCount)
+    : mIsStopRequested{false}
+{
+    for (size_t threadNumber{0u}; threadNumber < std::max<size_t>(threadsCount, 1u); ++threadNumber)
+    {
+        mThreads.emplace_back(&ThreadPoolFileIO::_processTasks, this);
+    }
+}
+
+/* The queued requests are still handled (so all provided futures get their results)
+*/
+ThreadPoolFileIO::~ThreadPoolFileIO()
+{
+    {
+        std::lock_guard<std::mutex> lock{mTasksMutex};
+        mIsStopRequested = true;
+    }
+
+    mTasksCondition.notify_all();
+
+    for (auto& thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+std::future<AsyncFileIO::FileContent_t> ThreadPoolFileIO::readFile(const Core::Path_t& file)
+{
+    // the task is shared as std::function requires a copyable target
+    auto pTask{std::make_shared<std::packaged_task<FileContent_t()>>([file]() {return _readFile(file);})};
+    std::future<FileContent_t> result{pTask->get_future()};
+
+    _addTask([pTask]() {(*pTask)();});
+
+    return result;
+}
+
+std::future<bool> ThreadPoolFileIO::writeFile(const Core::Path_t& file, std::string content)
+{
+    auto pTask{std::make_shared<std::packaged_task<bool()>>([file, content{std::move(content)}]() {return _writeFile(file, content);})};
+    std::future<bool> result{pTask->get_future()};
+
+    _addTask([pTask]() {(*pTask)();});
+
+    return result;
+}
+
+std::string_view ThreadPoolFileIO::getBackendName() const
+{
+    return "thread pool";
+}
+
+void ThreadPoolFileIO::_addTask(Task_t task)
+{
+    {
+        std::lock_guard<std::mutex> lock{mTasksMutex};
+        mTasks.push_back(std::move(task));
+    }
+
+    mTasksCondition.notify_one();
+}
+
+void ThreadPoolFileIO::_processTasks()
+{
+    bool isStopRequired{false};
+
+    while (!isStopRequired)
+    {
+        Task_t task;
+
+        {
+            std::unique_lock<std::mutex> lock{mTasksMutex};
+            mTasksCondition.wait(lock, [this]() {return mIsStopRequested || !mTasks.empty();});
+
+            if (!mTasks.empty())
+            {
+                task = std::move(mTasks.front());
+                mTasks.pop_front();
+            }
+            else
+            {
+                isStopRequired = true;
+            }
+        }
+
+        if (task)
+        {
+            task();
+        }
+    }
+}
+
+AsyncFileIO::FileContent_t ThreadPoolFileIO::_readFile(const Core::Path_t& file)
+{
+    FileContent_t content;
+
+    if (std::ifstream inputStream{file, std::ios::binary}; inputStream.is_open())
+    {
+        std::ostringstream contentStream;
+        contentStream << inputStream.rdbuf();
+
+        // an empty file sets the failbit of the content stream, which is not an error
+        if (!inputStream.bad())
+        {
+            content = contentStream.str();
+        }
+    }
+
+    return content;
+}
+
+bool ThreadPoolFileIO::_writeFile(const Core::Path_t& file, const std::string& content)
+{
+    const Core::Path_t c_TemporaryFile{Core::getTemporaryFile(file)};
+    const Core::CompressionFormat c_CompressionFormat{Core::getCompressionFormat(file)};
+    const bool c_IsCompressionRequired{Core::CompressionFormat::NONE != c_CompressionFormat};
+
+    std::string compressedContent;
+    bool success{!c_IsCompressionRequired || Core::compressContent(content, c_CompressionFormat, compressedContent)};
+
+    if (std::ofstream outputStream; success)
+    {
+        const std::string& c_WrittenContent{c_IsCompressionRequired ? compressedContent : content};
+
+        outputStream.open(c_TemporaryFile, std::ios::binary);
+        outputStream.write(c_WrittenContent.data(), static_cast<std::streamsize>(c_WrittenContent.size()));
+        outputStream.close();
+        success = outputStream.good(); // also false if the file could not be opened
+    }
+
+    std::error_code errorCode;
+
+    if (success)
+    {
+        std::filesystem::rename(c_TemporaryFile, file, errorCode);
+        success = !errorCode;
+    }
+
+    if (!success)
+    {
+        (void)std::filesystem::remove(c_TemporaryFile, errorCode);
+    }
+
+    return success;
+}
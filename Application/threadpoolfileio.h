@@ -0,0 +1,44 @@
+#ifndef THREADPOOLFILEIO_H
+#define THREADPOOLFILEIO_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "asyncfileio.h"
+
+/* Portable backend: the requests are queued and handled in order by the pool threads, each file being read or written with blocking calls
+*/
+class ThreadPoolFileIO final : public AsyncFileIO
+{
+public:
+    explicit ThreadPoolFileIO(const size_t threadsCount);
+    ~ThreadPoolFileIO() override;
+
+    ThreadPoolFileIO(const ThreadPoolFileIO&) = delete;
+    ThreadPoolFileIO& operator=(const ThreadPoolFileIO&) = delete;
+
+    std::future<FileContent_t> readFile(const Core::Path_t& file) override;
+    std::future<bool> writeFile(const Core::Path_t& file, std::string content) override;
+    std::string_view getBackendName() const override;
+
+private:
+    using Task_t = std::function<void()>;
+
+    void _addTask(Task_t task);
+    void _processTasks();
+
+    static FileContent_t _readFile(const Core::Path_t& file);
+    static bool _writeFile(const Core::Path_t& file, const std::string& content);
+
+    std::vector<std::thread> mThreads;
+    std::deque<Task_t> mTasks;
+    std::mutex mTasksMutex;
+    std::condition_variable mTasksCondition;
+    bool mIsStopRequested;
+};
+
+#endif // THREADPOOLFILEIO_H
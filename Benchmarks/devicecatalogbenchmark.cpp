@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "devicecatalog.h"
+
+/* Guards the loading time of a large device catalog file (the catalog is loaded by each run requiring device ports, before parsing starts)
+   The keyword of each entry is checked against the ones read before, so the loading should not become quadratic with the number of entries
+*/
+namespace
+{
+    constexpr size_t c_DeviceTypesCount{500u};
+    constexpr size_t c_RoundsCount{5u};
+
+    // the optimized builds should meet the target, the others are only required not to exceed it by much
+#ifdef NDEBUG
+    constexpr std::chrono::microseconds c_MaxLoadingDuration{1000};
+#else
+    constexpr std::chrono::microseconds c_MaxLoadingDuration{10000};
+#endif
+
+    std::string getKeyword(const size_t deviceTypeIndex)
+    {
+        return "bmdev" + std::to_string(deviceTypeIndex);
+    }
+
+    // the entries cycle through the parameters and formats most commonly used by the catalog device types
+    bool writeDeviceCatalogFile(const Core::Path_t& deviceCatalogFile)
+    {
+        std::ofstream deviceCatalogStream{deviceCatalogFile};
+
+        deviceCatalogStream << "Keyword,Description,Label,Parameters,Port types,Description format,Label format\n";
+
+        for (size_t deviceTypeIndex{0u}; deviceTypeIndex < c_DeviceTypesCount; ++deviceTypeIndex)
+        {
+            const std::string c_Index{std::to_string(deviceTypeIndex)};
+
+            deviceCatalogStream << getKeyword(deviceTypeIndex) << ",Benchmark device " << c_Index << ",BD" << c_Index;
+
+            switch (deviceTypeIndex % 3u)
+            {
+            case 0u:
+                deviceCatalogStream << ",portType;port,N=Ethernet/ETH;F=Fibre Channel/FC,,\n";
+                break;
+            case 1u:
+                deviceCatalogStream << ",slot;port,,,\n";
+                break;
+            default:
+                deviceCatalogStream << ",module;portType;port,N=Ethernet/ETH;M=Management/MGMT,{device} U{u} - module {module} - {portTypeDescription} port {port},U{u}_M{module}_{portTypeLabel}{port}\n";
+                break;
+            }
+        }
+
+        return deviceCatalogStream.good();
+    }
+}
+
+int main()
+{
+    const Core::Path_t c_DeviceCatalogFile{std::filesystem::temp_directory_path() / "labelcalculator_benchmark_devicecatalog.csv"};
+    bool success{writeDeviceCatalogFile(c_DeviceCatalogFile)};
+
+    std::chrono::nanoseconds minDuration{std::chrono::nanoseconds::max()};
+
+    for (size_t round{0u}; success && round < c_RoundsCount; ++round)
+    {
+        const auto c_StartTime{std::chrono::steady_clock::now()};
+        const DeviceCatalog c_DeviceCatalog{c_DeviceCatalogFile};
+        minDuration = std::min<std::chrono::nanoseconds>(minDuration, std::chrono::steady_clock::now() - c_StartTime);
+
+        // all entries should have been loaded
+        for (size_t deviceTypeIndex{0u}; success && deviceTypeIndex < c_DeviceTypesCount; ++deviceTypeIndex)
+        {
+            success = Data::DeviceTypeID::UNKNOWN_DEVICE != c_DeviceCatalog.getDeviceTypeID(getKeyword(deviceTypeIndex));
+        }
+    }
+
+    std::error_code errorCode;
+    (void)std::filesystem::remove(c_DeviceCatalogFile, errorCode);
+
+    if (success)
+    {
+        success = minDuration <= c_MaxLoadingDuration;
+
+        std::cout << "Device catalog: " << c_DeviceTypesCount << " device types loaded in " << std::chrono::duration_cast<std::chrono::microseconds>(minDuration).count() << "us (maximum: "
+                  << c_MaxLoadingDuration.count() << "us)" << (success ? "" : " (FAILED)") << "\n";
+    }
+    else
+    {
+        std::cout << "Device catalog: the " << c_DeviceTypesCount << " device types could not be written or loaded (FAILED)\n";
+    }
+
+    return success ? 0 : 1;
+}
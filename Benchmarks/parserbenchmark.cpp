@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "applicationdata.h"
+#include "parsercreator.h"
+
+/* Guards the linear parsing of rows padded with long runs of empty cells (spreadsheet exports often contain thousands of trailing or interleaved commas)
+   Each row is parsed with 10k and 100k empty cells: linear parsing takes about 10 times longer for the larger row while the previous (quadratic) scan took about 100 times longer
+*/
+namespace
+{
+    constexpr size_t c_SmallEmptyCellsCount{10'000u};
+    constexpr size_t c_LargeEmptyCellsCount{100'000u};
+    constexpr size_t c_RoundsCount{3u};
+
+    // the time ratio is allowed to exceed the (linear) cells count ratio for absorbing the fixed costs and the measurement noise
+    constexpr double c_MaxTimeRatio{30.0};
+
+    // the quadratic scan needed ~18s for the connection definitions row with 100k empty cells
+    constexpr std::chrono::milliseconds c_MaxParsingDuration{2000};
+
+    std::string createInput(const ParserCreator::ParserTypes parserType, const size_t emptyCellsCount)
+    {
+        const std::string c_EmptyCells(emptyCellsCount, Data::c_CSVSeparator);
+        std::string input;
+
+        if (ParserCreator::ParserTypes::CONNECTION_DEFINITION == parserType)
+        {
+            // each empty cell followed by a connection is reported as error (the whole remaining row being checked for parseable content)
+            input = std::string{Data::c_ConnectionDefinitionsHeader} + "\n";
+            input += "50,lan,,,\n";
+            input += "49,svr" + c_EmptyCells + ",50/1\n";
+        }
+        else
+        {
+            input = std::string{Data::c_ConnectionInputHeader} + "\n";
+            input += "C,lan,50,1,-,-,svr,49,N,1,-" + c_EmptyCells + "\n";
+        }
+
+        return input;
+    }
+
+    std::chrono::nanoseconds parseInput(const ParserCreator::ParserTypes parserType, const std::string& input)
+    {
+        std::chrono::nanoseconds minDuration{std::chrono::nanoseconds::max()};
+
+        for (size_t round{0u}; round < c_RoundsCount; ++round)
+        {
+            const Core::InputStreamPtr c_pInputStream{std::make_shared<std::istringstream>(input)};
+            const Core::OutputStreamPtr c_pOutputStream{std::make_shared<std::ostringstream>()};
+            const Core::ErrorStreamPtr c_pErrorStream{std::make_shared<std::ostringstream>()};
+
+            ParserCreator parserCreator;
+            const ParserPtr c_pParser{parserCreator.createParser(parserType, c_pInputStream, c_pOutputStream, c_pErrorStream)};
+
+            const auto c_StartTime{std::chrono::steady_clock::now()};
+            (void)c_pParser->parse();
+            minDuration = std::min<std::chrono::nanoseconds>(minDuration, std::chrono::steady_clock::now() - c_StartTime);
+        }
+
+        return minDuration;
+    }
+
+    bool checkLinearParsing(const ParserCreator::ParserTypes parserType, const std::string_view parserName)
+    {
+        const std::chrono::nanoseconds c_SmallRowDuration{parseInput(parserType, createInput(parserType, c_SmallEmptyCellsCount))};
+        const std::chrono::nanoseconds c_LargeRowDuration{parseInput(parserType, createInput(parserType, c_LargeEmptyCellsCount))};
+
+        const double c_TimeRatio{static_cast<double>(c_LargeRowDuration.count()) / static_cast<double>(std::max<std::chrono::nanoseconds::rep>(c_SmallRowDuration.count(), 1))};
+        const bool c_IsLinear{c_TimeRatio <= c_MaxTimeRatio && c_LargeRowDuration <= c_MaxParsingDuration};
+
+        std::cout << parserName << ": " << c_SmallEmptyCellsCount << " empty cells: " << std::chrono::duration_cast<std::chrono::microseconds>(c_SmallRowDuration).count() << "us, "
+                  << c_LargeEmptyCellsCount << " empty cells: " << std::chrono::duration_cast<std::chrono::microseconds>(c_LargeRowDuration).count() << "us, ratio: " << c_TimeRatio
+                  << (c_IsLinear ? "" : " (FAILED)") << "\n";
+
+        return c_IsLinear;
+    }
+}
+
+int main()
+{
+    bool success{checkLinearParsing(ParserCreator::ParserTypes::CONNECTION_INPUT, "Connection input")};
+    success = checkLinearParsing(ParserCreator::ParserTypes::CONNECTION_DEFINITION, "Connection definitions") && success;
+
+    return success ? 0 : 1;
+}
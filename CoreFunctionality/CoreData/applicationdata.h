@@ -29,7 +29,8 @@ namespace Data
         RACK_SERVER,
         SCALABLE_SERVER,
         STORAGE,
-        BLADE_SERVER
+        BLADE_SERVER,
+        FIRST_CATALOG_DEVICE // device types loaded from the device catalog file are numbered starting with this value (no built-in device type beyond this point)
     };
 
     inline const std::map<std::string, DeviceTypeID> c_DeviceTypeTextToIDMapping
@@ -56,6 +57,12 @@ namespace Data
 
     inline constexpr std::string_view c_LabellingTableHeader{"__Item number__,__Cable part number__,__Source device description__,"
                                                              "__Source label__,__Destination device description__,__Destination label__"};
+
+    // reports produced together with the labelling table (the power connections report has the labelling table header)
+    inline constexpr std::string_view c_BillOfMaterialsHeader{"__Cable part number__,__Quantity__"};
+
+    inline constexpr std::string_view c_PortMapHeader{"__U number__,__Device__,__Port description__,__Port label__,"
+                                                      "__Remote port description__,__Remote port label__,__Cable part number__,__Item number__"};
 }
 
 #endif // APPLICATIONDATA_H
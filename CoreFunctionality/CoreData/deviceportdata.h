@@ -1,6 +1,8 @@
 #ifndef DEVICEPORTDATA_H
 #define DEVICEPORTDATA_H
 
+#include <array>
+
 #include "deviceporttypes.h"
 #include "applicationdata.h"
 
@@ -15,23 +17,100 @@ namespace Data
     // padding data that is prepended to raw input data in case device port doesn't start parsing from beginning of row
     inline constexpr std::string_view c_Padding{"--PREVIOUS_CELLS--"};
 
-    inline const std::map<DeviceTypeID, size_t> c_RequiredInputParamsCount
+    // required input parameters of a device port, in the order in which they are entered within connectioninput.csv
+    struct DevicePortSchema_t
+    {
+        size_t mParametersCount;
+        std::array<PortParameterID, c_MaxPortInputParametersCount> mParameters;
+    };
+
+    // placeholders used for creating the connection input template file (same order as the PortParameterID enumerators)
+    inline constexpr std::array<std::string_view, static_cast<size_t>(PortParameterID::PortParametersCount)> c_PortParameterPlaceholders
     {
-        {    DeviceTypeID::PDU,                 3    },
-        {    DeviceTypeID::EXTENSION_BAR,       2    },
-        {    DeviceTypeID::UPS,                 2    },
-        {    DeviceTypeID::LAN_SWITCH,          2    },
-        {    DeviceTypeID::LAN_DIRECTOR,        3    },
-        {    DeviceTypeID::SAN_SWITCH,          2    },
-        {    DeviceTypeID::SAN_DIRECTOR,        3    },
-        {    DeviceTypeID::INFINIBAND_SWITCH,   2    },
-        {    DeviceTypeID::KVM_SWITCH,          2    },
-        {    DeviceTypeID::RACK_SERVER,         2    },
-        {    DeviceTypeID::SCALABLE_SERVER,     3    },
-        {    DeviceTypeID::STORAGE,             3    },
-        {    DeviceTypeID::BLADE_SERVER,        3    }
+        "PLACEMENT", "LOAD SEGMENT NUMBER", "PORT TYPE", "PORT NUMBER", "BLADE NUMBER", "SLOT NUMBER", "CONTROLLER NUMBER", "MODULE TYPE", "MODULE NUMBER"
     };
 
+    inline constexpr size_t c_BuiltInDeviceTypesCount{static_cast<size_t>(DeviceTypeID::FIRST_CATALOG_DEVICE) - static_cast<size_t>(DeviceTypeID::PDU)};
+
+    /* Single source for the parameters of each built-in device type (index is: device type ID - PDU), used for:
+        - determining the number and order of the parameters parsed by each device port
+        - creating the placeholders of the connection input template file (option 1)
+       The parameter values are checked by each device port, as most checks depend on the other parameters of the port (e.g. port type and blade number)
+    */
+    inline constexpr std::array<DevicePortSchema_t, c_BuiltInDeviceTypesCount> c_DevicePortSchemas
+    {{
+        /* PDU */               {3, {{ PortParameterID::PLACEMENT,
+                                       PortParameterID::LOAD_SEGMENT_NUMBER,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* EXTENSION_BAR */     {2, {{ PortParameterID::PLACEMENT,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* UPS */               {2, {{ PortParameterID::LOAD_SEGMENT_NUMBER,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* LAN_SWITCH */        {2, {{ PortParameterID::PORT_TYPE,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* LAN_DIRECTOR */      {3, {{ PortParameterID::BLADE_NUMBER,
+                                       PortParameterID::PORT_TYPE,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* SAN_SWITCH */        {2, {{ PortParameterID::PORT_TYPE,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* SAN_DIRECTOR */      {3, {{ PortParameterID::BLADE_NUMBER,
+                                       PortParameterID::PORT_TYPE,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* INFINIBAND_SWITCH */ {2, {{ PortParameterID::PORT_TYPE,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* KVM_SWITCH */        {2, {{ PortParameterID::PORT_TYPE,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* RACK_SERVER */       {2, {{ PortParameterID::PORT_TYPE,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* SCALABLE_SERVER */   {3, {{ PortParameterID::SLOT_NUMBER,
+                                       PortParameterID::PORT_TYPE,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* STORAGE */           {3, {{ PortParameterID::CONTROLLER_NUMBER,
+                                       PortParameterID::PORT_TYPE,
+                                       PortParameterID::PORT_NUMBER }}},
+        /* BLADE_SERVER */      {3, {{ PortParameterID::MODULE_TYPE,
+                                       PortParameterID::MODULE_NUMBER,
+                                       PortParameterID::PORT_NUMBER }}}
+    }};
+
+    inline constexpr const DevicePortSchema_t& getDevicePortSchema(const DeviceTypeID deviceTypeID)
+    {
+        return c_DevicePortSchemas[static_cast<size_t>(deviceTypeID) - static_cast<size_t>(DeviceTypeID::PDU)];
+    }
+
+    // each schema should require at least one and at most c_MaxPortInputParametersCount parameters, each parameter being required once
+    inline constexpr bool isValidDevicePortSchema(const DevicePortSchema_t& schema)
+    {
+        bool isValid{schema.mParametersCount > 0u && schema.mParametersCount <= c_MaxPortInputParametersCount};
+
+        for (size_t parameterIndex{0u}; isValid && parameterIndex < schema.mParametersCount; ++parameterIndex)
+        {
+            isValid = schema.mParameters[parameterIndex] < PortParameterID::PortParametersCount;
+
+            for (size_t previousIndex{0u}; isValid && previousIndex < parameterIndex; ++previousIndex)
+            {
+                isValid = schema.mParameters[previousIndex] != schema.mParameters[parameterIndex];
+            }
+        }
+
+        return isValid;
+    }
+
+    inline constexpr bool areValidDevicePortSchemas()
+    {
+        bool areValid{true};
+
+        for (const DevicePortSchema_t& schema : c_DevicePortSchemas)
+        {
+            areValid = areValid && isValidDevicePortSchema(schema);
+        }
+
+        return areValid;
+    }
+
+    // missing schemas are detected as well (value-initialized, no parameters)
+    static_assert(areValidDevicePortSchemas(), "Invalid device port schema detected");
+
     // placement types for specific power devices (PDUs, extension bars)
     inline const std::map<std::string, std::string> c_DevicePlacementIdentifiers
     {
@@ -86,6 +165,58 @@ namespace Data
         {"I", {"Infiniband", "IB"   }},
         {"S", {"SAS"       , "SAS"  }}
     };
+
+    // names of the variables to be used within label formats (same order as the LabelFormatVariable enumerators)
+    inline constexpr std::array<std::string_view, static_cast<size_t>(LabelFormatVariable::LabelFormatVariablesCount)> c_LabelFormatVariableNames
+    {
+        "u", "device", "deviceLabel", "placement", "placementDescription", "loadSegment", "portTypeDescription", "portTypeLabel", "port", "blade", "slot", "controller", "module"
+    };
+
+    /* Built-in description and label formats (same order as the LabelFormatID enumerators); they can be overridden by the label formats file (see Documentation)
+       Optional sections (enclosed in square brackets) are skipped if any contained variable is empty (e.g. device types without label or switches without blades)
+    */
+    inline constexpr std::array<LabelFormatInfo_t, static_cast<size_t>(LabelFormatID::LabelFormatsCount)> c_DefaultLabelFormats
+    {{
+        {"pdu_load_segment_port",               "{device} placed at U{u} {placementDescription} - load segment number {loadSegment} - port number {port}",  "U{u}[_{deviceLabel}]_{placement}_P{loadSegment}.{port}"},
+        {"pdu_port",                            "{device} placed at U{u} {placementDescription} - port number {port}",                                      "U{u}[_{deviceLabel}]_{placement}_P{port}"              },
+        {"pdu_management_port",                 "{device} placed at U{u} {placementDescription} - management port",                                         "U{u}[_{deviceLabel}]_{placement}_MGMT"                 },
+        {"pdu_in_port",                         "{device} placed at U{u} {placementDescription} - port number IN",                                          "U{u}[_{deviceLabel}]_{placement}_IN"                   },
+        {"extension_bar_port",                  "{device} placed at U{u} {placementDescription} - port number {port}",                                      "U{u}[_{deviceLabel}]_{placement}_P{port}"              },
+        {"extension_bar_in_port",               "{device} placed at U{u} {placementDescription} - port number IN",                                          "U{u}[_{deviceLabel}]_{placement}_IN"                   },
+        {"ups_port",                            "{device} placed at U{u} - load segment {loadSegment} - port {port}",                                       "U{u}[_{deviceLabel}]_P{loadSegment}.{port}"            },
+        {"ups_management_port",                 "{device} placed at U{u} - management port",                                                                "U{u}[_{deviceLabel}]_MGMT"                             },
+        {"switch_data_port",                    "{device} placed at U{u}[ - blade {blade}] - [{portTypeDescription} ]port {port}",                          "U{u}[_{deviceLabel}][_B{blade}][_{portTypeLabel}]_P{port}"},
+        {"switch_power_supply",                 "{device} placed at U{u} - power supply {port}",                                                            "U{u}[_{deviceLabel}]_PS{port}"                         },
+        {"switch_management_port",              "{device} placed at U{u} - management port",                                                                "U{u}[_{deviceLabel}]_MGMT"                             },
+        {"server_data_port",                    "{device} placed at U{u}[ - slot {slot}] - {portTypeDescription} port {port}",                              "U{u}[_{deviceLabel}][_S{slot}]_{portTypeLabel}_P{port}"},
+        {"server_power_supply",                 "{device} placed at U{u}[ - slot {slot}] - power supply {port}",                                            "U{u}[_{deviceLabel}][_S{slot}]_PS{port}"               },
+        {"server_kvm_port",                     "{device} placed at U{u}[ - slot {slot}] - KVM port",                                                       "U{u}[_{deviceLabel}][_S{slot}]_KVM"                    },
+        {"server_management_port",              "{device} placed at U{u}[ - slot {slot}] - management port",                                                "U{u}[_{deviceLabel}][_S{slot}]_MGMT"                   },
+        {"storage_data_port",                   "{device} placed at U{u} - controller {controller} - port {port}",                                          "U{u}[_{deviceLabel}]_C{controller}_P{port}"            },
+        {"storage_controller_management_port",  "{device} placed at U{u} - controller {controller} - management port",                                      "U{u}[_{deviceLabel}]_C{controller}_MGMT"               },
+        {"storage_management_port",             "{device} placed at U{u} - management port",                                                                "U{u}[_{deviceLabel}]_MGMT"                             },
+        {"storage_power_supply",                "{device} placed at U{u} - power supply {port}",                                                            "U{u}[_{deviceLabel}]_PS{port}"                         },
+        {"blade_data_module_port",              "{device} placed at U{u} - data module {module} - port {port}",                                             "U{u}[_{deviceLabel}]_DMO{module}_P{port}"              },
+        {"blade_management_module",             "{device} placed at U{u} - management module {module}",                                                     "U{u}[_{deviceLabel}]_MGMT{module}"                     },
+        {"blade_power_supply",                  "{device} placed at U{u} - power supply {module}",                                                          "U{u}[_{deviceLabel}]_PS{module}"                       },
+        {"blade_management_uplink_port",        "{device} placed at U{u} - management uplink port",                                                         "U{u}[_{deviceLabel}]_MG_UP"                            },
+        {"blade_management_downlink_port",      "{device} placed at U{u} - management downlink port",                                                       "U{u}[_{deviceLabel}]_MG_DO"                            }
+    }};
+
+    // the ports carrying power (power supplies and the ports of the power distribution devices, management ports excluded)
+    inline constexpr std::array<LabelFormatID, 10> c_PowerPortLabelFormats
+    {
+        LabelFormatID::PDU_LOAD_SEGMENT_PORT,
+        LabelFormatID::PDU_PORT,
+        LabelFormatID::PDU_IN_PORT,
+        LabelFormatID::EXTENSION_BAR_PORT,
+        LabelFormatID::EXTENSION_BAR_IN_PORT,
+        LabelFormatID::UPS_PORT,
+        LabelFormatID::SWITCH_POWER_SUPPLY,
+        LabelFormatID::SERVER_POWER_SUPPLY,
+        LabelFormatID::STORAGE_POWER_SUPPLY,
+        LabelFormatID::BLADE_POWER_SUPPLY
+    };
 }
 
 #endif // DEVICEPORTDATA_H
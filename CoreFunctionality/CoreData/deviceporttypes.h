@@ -3,6 +3,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 
 namespace Data
 {
@@ -18,6 +19,81 @@ namespace Data
 
         bool mIsManagementPortAllowed;
     };
+
+    /* Each port description/label layout (e.g. switch data port, storage controller management port etc) has its own format
+       The enumerators are used as indexes for the label formats table (the last one is the formats count)
+    */
+    enum class LabelFormatID : size_t
+    {
+        PDU_LOAD_SEGMENT_PORT,
+        PDU_PORT,
+        PDU_MANAGEMENT_PORT,
+        PDU_IN_PORT,
+        EXTENSION_BAR_PORT,
+        EXTENSION_BAR_IN_PORT,
+        UPS_PORT,
+        UPS_MANAGEMENT_PORT,
+        SWITCH_DATA_PORT,
+        SWITCH_POWER_SUPPLY,
+        SWITCH_MANAGEMENT_PORT,
+        SERVER_DATA_PORT,
+        SERVER_POWER_SUPPLY,
+        SERVER_KVM_PORT,
+        SERVER_MANAGEMENT_PORT,
+        STORAGE_DATA_PORT,
+        STORAGE_CONTROLLER_MANAGEMENT_PORT,
+        STORAGE_MANAGEMENT_PORT,
+        STORAGE_POWER_SUPPLY,
+        BLADE_DATA_MODULE_PORT,
+        BLADE_MANAGEMENT_MODULE,
+        BLADE_POWER_SUPPLY,
+        BLADE_MANAGEMENT_UPLINK_PORT,
+        BLADE_MANAGEMENT_DOWNLINK_PORT,
+        LabelFormatsCount
+    };
+
+    /* Variables that can be used within label formats (the last enumerator is the variables count)
+       Each variable is filled-in by the device port based on its parsed input parameters
+    */
+    enum class LabelFormatVariable : size_t
+    {
+        U_POSITION,
+        DEVICE_DESCRIPTION,
+        DEVICE_LABEL,
+        PLACEMENT,
+        PLACEMENT_DESCRIPTION,
+        LOAD_SEGMENT_NUMBER,
+        PORT_TYPE_DESCRIPTION,
+        PORT_TYPE_LABEL,
+        PORT_NUMBER,
+        BLADE_NUMBER,
+        SLOT_NUMBER,
+        CONTROLLER_NUMBER,
+        MODULE_NUMBER,
+        LabelFormatVariablesCount
+    };
+
+    // input parameters that can be required by device ports (the last enumerator is the parameters count)
+    enum class PortParameterID : size_t
+    {
+        PLACEMENT,
+        LOAD_SEGMENT_NUMBER,
+        PORT_TYPE,
+        PORT_NUMBER,
+        BLADE_NUMBER,
+        SLOT_NUMBER,
+        CONTROLLER_NUMBER,
+        MODULE_TYPE,
+        MODULE_NUMBER,
+        PortParametersCount
+    };
+
+    struct LabelFormatInfo_t
+    {
+        std::string_view mKey;                  // format name as used in the label formats file
+        std::string_view mDescriptionFormat;    // pattern for the device port description
+        std::string_view mLabelFormat;          // pattern for the device port label
+    };
 }
 
 #endif // DEVICEPORTTYPES_H
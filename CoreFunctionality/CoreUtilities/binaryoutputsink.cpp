@@ -0,0 +1,52 @@
+#include "binaryoutputsink.h"
+
+Utilities::Core::BinaryOutputSink::BinaryOutputSink(const OutputStreamPtr pOutputStream)
+    : OutputSink(pOutputStream)
+{
+}
+
+bool Utilities::Core::BinaryOutputSink::writeHeader(const std::vector<std::string_view>& columnNames)
+{
+    std::string& buffer{_getBuffer()};
+
+    buffer += scMagic;
+    buffer += scVersion;
+    _appendFields(buffer, columnNames);
+
+    return _writeBufferIfFull();
+}
+
+bool Utilities::Core::BinaryOutputSink::writeRow(const std::vector<std::string_view>& fields)
+{
+    std::string& buffer{_getBuffer()};
+
+    mRecordPayload.clear();
+    _appendFields(mRecordPayload, fields);
+
+    _appendVarint(buffer, mRecordPayload.size());
+    buffer += mRecordPayload;
+
+    return _writeBufferIfFull();
+}
+
+void Utilities::Core::BinaryOutputSink::_appendFields(std::string& output, const std::vector<std::string_view>& fields)
+{
+    _appendVarint(output, fields.size());
+
+    for (const auto& c_Field : fields)
+    {
+        _appendVarint(output, c_Field.size());
+        output += c_Field;
+    }
+}
+
+void Utilities::Core::BinaryOutputSink::_appendVarint(std::string& output, std::uint64_t value)
+{
+    while (value >= 0x80u)
+    {
+        output += static_cast<char>((value & 0x7Fu) | 0x80u);
+        value >>= 7;
+    }
+
+    output += static_cast<char>(value);
+}
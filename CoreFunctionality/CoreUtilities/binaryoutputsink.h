@@ -0,0 +1,32 @@
+#ifndef BINARYOUTPUTSINK_H
+#define BINARYOUTPUTSINK_H
+
+#include "outputsink.h"
+
+namespace Utilities::Core
+{
+    /* Compact binary record format, all lengths and counts being unsigned LEB128 varints (7 bits per byte, least significant group first):
+       - file header: magic "LCBR", version byte (1), columns count, then each column name as length + bytes
+       - one record per row: payload length (so a reader can skip records), then the payload: fields count, then each field as length + bytes
+       No separators or escaping are needed so the fields are copied as they are
+    */
+    class BinaryOutputSink final : public OutputSink
+    {
+    public:
+        explicit BinaryOutputSink(const OutputStreamPtr pOutputStream);
+
+        virtual bool writeHeader(const std::vector<std::string_view>& columnNames) override;
+        virtual bool writeRow(const std::vector<std::string_view>& fields) override;
+
+    private:
+        static void _appendFields(std::string& output, const std::vector<std::string_view>& fields);
+        static void _appendVarint(std::string& output, std::uint64_t value);
+
+        static constexpr std::string_view scMagic{"LCBR"};
+        static constexpr char scVersion{1};
+
+        std::string mRecordPayload;                 // reused for each row
+    };
+}
+
+#endif // BINARYOUTPUTSINK_H
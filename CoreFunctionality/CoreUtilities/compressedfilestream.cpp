@@ -0,0 +1,409 @@
+#include "compressedfilestream.h"
+
+Utilities::Core::DecompressingInputStream::DecompressingInputStream()
+    : std::istream{nullptr}
+{
+    // the buffer is only constructed after the base class, so it gets attached here
+    rdbuf(&mBuffer);
+}
+
+void Utilities::Core::DecompressingInputStream::open(const std::filesystem::path& file)
+{
+    clear();
+
+    if (!mBuffer.open(file))
+    {
+        setstate(std::ios_base::failbit);
+    }
+}
+
+void Utilities::Core::DecompressingInputStream::open(std::string content, const CompressionFormat compressionFormat)
+{
+    clear();
+
+    if (!mBuffer.open(std::move(content), compressionFormat))
+    {
+        setstate(std::ios_base::failbit);
+    }
+}
+
+bool Utilities::Core::DecompressingInputStream::isOpen() const
+{
+    return mBuffer.isOpen();
+}
+
+void Utilities::Core::DecompressingInputStream::close()
+{
+    mBuffer.close();
+}
+
+bool Utilities::Core::DecompressingInputStream::isCorrupt() const
+{
+    return mBuffer.isCorrupt();
+}
+
+Utilities::Core::DecompressingInputStream::DecompressingBuffer::DecompressingBuffer()
+    : mIsFileSource{false}
+    , mIsSourceConsumed{true}
+    , mBufferPosition{0}
+    , mIsBufferFilled{false}
+    , mIsOpen{false}
+    , mIsCorrupt{false}
+{
+}
+
+/* The file buffer is used unbuffered as the data is read in big chunks anyway (an uncompressed file is read directly into the get area)
+*/
+bool Utilities::Core::DecompressingInputStream::DecompressingBuffer::open(const std::filesystem::path& file)
+{
+    close();
+
+    const CompressionFormat c_CompressionFormat{getCompressionFormat(file)};
+
+    if (isCompressionFormatSupported(c_CompressionFormat))
+    {
+        (void)mFileBuffer.pubsetbuf(nullptr, 0);
+
+        if (mFileBuffer.open(file, std::ios_base::in | std::ios_base::binary))
+        {
+            if (CompressionFormat::NONE != c_CompressionFormat)
+            {
+                mpDecompressor = std::make_unique<Decompressor>(c_CompressionFormat);
+            }
+
+            _allocateBuffer();
+            mIsFileSource = true;
+            mIsSourceConsumed = false;
+            mIsOpen = !mpDecompressor || mpDecompressor->isValid();
+        }
+    }
+
+    return mIsOpen;
+}
+
+/* Uncompressed content is read in place (no copy into the get area)
+*/
+bool Utilities::Core::DecompressingInputStream::DecompressingBuffer::open(std::string content, const CompressionFormat compressionFormat)
+{
+    close();
+
+    mContent = std::move(content);
+    mRemainingContent = mContent;
+    mIsSourceConsumed = true;
+
+    if (CompressionFormat::NONE == compressionFormat)
+    {
+        setg(mContent.data(), mContent.data(), mContent.data() + mContent.size());
+        mIsOpen = true;
+    }
+    else if (isCompressionFormatSupported(compressionFormat))
+    {
+        mpDecompressor = std::make_unique<Decompressor>(compressionFormat);
+        _allocateBuffer();
+        mIsOpen = mpDecompressor->isValid();
+    }
+
+    return mIsOpen;
+}
+
+bool Utilities::Core::DecompressingInputStream::DecompressingBuffer::isOpen() const
+{
+    return mIsOpen;
+}
+
+void Utilities::Core::DecompressingInputStream::DecompressingBuffer::close()
+{
+    if (mFileBuffer.is_open())
+    {
+        (void)mFileBuffer.close();
+    }
+
+    mpDecompressor.reset();
+    mContent.clear();
+    mRemainingContent = {};
+    mIsFileSource = false;
+    mIsSourceConsumed = true;
+    mBufferPosition = 0;
+    mIsBufferFilled = false;
+    mIsOpen = false;
+    mIsCorrupt = false;
+
+    setg(nullptr, nullptr, nullptr);
+}
+
+bool Utilities::Core::DecompressingInputStream::DecompressingBuffer::isCorrupt() const
+{
+    return mIsCorrupt;
+}
+
+Utilities::Core::DecompressingInputStream::DecompressingBuffer::int_type Utilities::Core::DecompressingInputStream::DecompressingBuffer::underflow()
+{
+    int_type result{traits_type::eof()};
+
+    if (gptr() < egptr() || _decompress())
+    {
+        result = traits_type::to_int_type(*gptr());
+    }
+
+    return result;
+}
+
+/* Only the current position (tellg) and the beginning can be sought
+*/
+Utilities::Core::DecompressingInputStream::DecompressingBuffer::pos_type Utilities::Core::DecompressingInputStream::DecompressingBuffer::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode)
+{
+    pos_type result{off_type{-1}};
+
+    if (0 != (mode & std::ios_base::in) && 0 == offset && std::ios_base::cur == direction)
+    {
+        result = _getPosition();
+    }
+    else if (0 != (mode & std::ios_base::in) && 0 == offset && std::ios_base::beg == direction && _rewind())
+    {
+        result = 0;
+    }
+
+    return result;
+}
+
+Utilities::Core::DecompressingInputStream::DecompressingBuffer::pos_type Utilities::Core::DecompressingInputStream::DecompressingBuffer::seekpos(pos_type position, std::ios_base::openmode mode)
+{
+    return seekoff(off_type{position}, std::ios_base::beg, mode);
+}
+
+/* Fills the get area with the next decompressed (or read) data. The end of the compressed data is only valid if the compressed stream is complete
+*/
+bool Utilities::Core::DecompressingInputStream::DecompressingBuffer::_decompress()
+{
+    size_t producedCount{0u};
+
+    mBufferPosition += egptr() - eback();
+
+    if (mIsOpen && !mpDecompressor && !mIsSourceConsumed)
+    {
+        producedCount = _readData(mpBuffer.get(), scBufferSize);
+        mIsSourceConsumed = 0u == producedCount;
+    }
+
+    while (mIsOpen && mpDecompressor && !mIsCorrupt && 0u == producedCount)
+    {
+        if (mRemainingContent.empty() && !mIsSourceConsumed)
+        {
+            _readCompressedData();
+        }
+
+        if (mRemainingContent.empty() && mIsSourceConsumed && !mIsBufferFilled)
+        {
+            mIsCorrupt = !mpDecompressor->isStreamComplete();
+            break;
+        }
+
+        mIsCorrupt = !mpDecompressor->decompress(mRemainingContent, mpBuffer.get(), scBufferSize, producedCount);
+        mIsBufferFilled = scBufferSize == producedCount;
+    }
+
+    setg(mpBuffer.get(), mpBuffer.get(), mpBuffer.get() + producedCount);
+
+    return producedCount > 0u;
+}
+
+void Utilities::Core::DecompressingInputStream::DecompressingBuffer::_readCompressedData()
+{
+    mContent.resize(scBufferSize);
+    mContent.resize(_readData(mContent.data(), mContent.size()));
+    mRemainingContent = mContent;
+    mIsSourceConsumed = mContent.empty();
+}
+
+size_t Utilities::Core::DecompressingInputStream::DecompressingBuffer::_readData(char* pData, const size_t size)
+{
+    const std::streamsize c_ReadCount{mFileBuffer.sgetn(pData, static_cast<std::streamsize>(size))};
+
+    return c_ReadCount > 0 ? static_cast<size_t>(c_ReadCount) : 0u;
+}
+
+/* The buffer is not initialized (it is only read once filled) and kept when the stream is reopened
+*/
+void Utilities::Core::DecompressingInputStream::DecompressingBuffer::_allocateBuffer()
+{
+    if (!mpBuffer)
+    {
+        mpBuffer.reset(new char[scBufferSize]);
+    }
+}
+
+bool Utilities::Core::DecompressingInputStream::DecompressingBuffer::_rewind()
+{
+    bool success{mIsOpen};
+
+    if (success && 0 != _getPosition())
+    {
+        if (mIsFileSource)
+        {
+            success = std::streampos{0} == mFileBuffer.pubseekpos(0, std::ios_base::in);
+            mContent.clear();
+            mIsSourceConsumed = false;
+        }
+
+        if (mpDecompressor)
+        {
+            mpDecompressor->reset();
+            mIsBufferFilled = false;
+            mIsCorrupt = false;
+        }
+
+        mRemainingContent = mContent;
+
+        // uncompressed content from memory is read in place
+        if (mIsFileSource || mpDecompressor)
+        {
+            setg(mpBuffer.get(), mpBuffer.get(), mpBuffer.get());
+        }
+        else
+        {
+            setg(mContent.data(), mContent.data(), mContent.data() + mContent.size());
+        }
+
+        mBufferPosition = 0;
+    }
+
+    return success;
+}
+
+std::streamoff Utilities::Core::DecompressingInputStream::DecompressingBuffer::_getPosition() const
+{
+    return mBufferPosition + (gptr() - eback());
+}
+
+Utilities::Core::CompressingOutputStream::CompressingOutputStream()
+    : std::ostream{nullptr}
+{
+    rdbuf(&mBuffer);
+}
+
+void Utilities::Core::CompressingOutputStream::open(const std::filesystem::path& file)
+{
+    clear();
+
+    if (!mBuffer.open(file))
+    {
+        setstate(std::ios_base::failbit);
+    }
+}
+
+bool Utilities::Core::CompressingOutputStream::isOpen() const
+{
+    return mBuffer.isOpen();
+}
+
+void Utilities::Core::CompressingOutputStream::close()
+{
+    if (!mBuffer.close())
+    {
+        setstate(std::ios_base::failbit);
+    }
+}
+
+Utilities::Core::CompressingOutputStream::CompressingBuffer::CompressingBuffer()
+    : mIsFailed{false}
+{
+}
+
+/* The file buffer is used unbuffered: the (compressed) data is written in big chunks from the put area anyway
+*/
+bool Utilities::Core::CompressingOutputStream::CompressingBuffer::open(const std::filesystem::path& file)
+{
+    (void)close();
+
+    const CompressionFormat c_CompressionFormat{getCompressionFormat(file)};
+
+    if (isCompressionFormatSupported(c_CompressionFormat))
+    {
+        (void)mFileBuffer.pubsetbuf(nullptr, 0);
+
+        if (mFileBuffer.open(file, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary))
+        {
+            if (CompressionFormat::NONE != c_CompressionFormat)
+            {
+                mpCompressor = std::make_unique<Compressor>(c_CompressionFormat);
+                mIsFailed = !mpCompressor->isValid();
+            }
+
+            mBuffer.resize(scBufferSize);
+            setp(mBuffer.data(), mBuffer.data() + mBuffer.size());
+        }
+    }
+
+    return mFileBuffer.is_open() && !mIsFailed;
+}
+
+bool Utilities::Core::CompressingOutputStream::CompressingBuffer::isOpen() const
+{
+    return mFileBuffer.is_open();
+}
+
+bool Utilities::Core::CompressingOutputStream::CompressingBuffer::close()
+{
+    bool success{true};
+
+    if (mFileBuffer.is_open())
+    {
+        success = _writePendingData(true);
+        success = nullptr != mFileBuffer.close() && success;
+    }
+
+    mpCompressor.reset();
+    mCompressedData.clear();
+    mIsFailed = false;
+
+    setp(nullptr, nullptr);
+
+    return success;
+}
+
+Utilities::Core::CompressingOutputStream::CompressingBuffer::int_type Utilities::Core::CompressingOutputStream::CompressingBuffer::overflow(int_type ch)
+{
+    int_type result{traits_type::eof()};
+
+    if (mFileBuffer.is_open() && _writePendingData(false))
+    {
+        if (!traits_type::eq_int_type(ch, traits_type::eof()))
+        {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+
+        result = traits_type::not_eof(ch);
+    }
+
+    return result;
+}
+
+/* The compressor is not flushed (that would worsen the compression), so the compressed file is only complete once closed
+*/
+int Utilities::Core::CompressingOutputStream::CompressingBuffer::sync()
+{
+    const bool c_Success{mFileBuffer.is_open() && _writePendingData(false) && 0 == mFileBuffer.pubsync()};
+
+    return c_Success ? 0 : -1;
+}
+
+bool Utilities::Core::CompressingOutputStream::CompressingBuffer::_writePendingData(const bool isFinishRequired)
+{
+    const std::string_view c_PendingData{pbase(), static_cast<size_t>(pptr() - pbase())};
+
+    if (!mIsFailed && !mpCompressor)
+    {
+        mIsFailed = mFileBuffer.sputn(c_PendingData.data(), static_cast<std::streamsize>(c_PendingData.size())) != static_cast<std::streamsize>(c_PendingData.size());
+    }
+    else if (!mIsFailed)
+    {
+        mCompressedData.clear();
+        mIsFailed = !mpCompressor->compress(c_PendingData, mCompressedData) || (isFinishRequired && !mpCompressor->finish(mCompressedData)) ||
+                    mFileBuffer.sputn(mCompressedData.data(), static_cast<std::streamsize>(mCompressedData.size())) != static_cast<std::streamsize>(mCompressedData.size());
+    }
+
+    setp(mBuffer.data(), mBuffer.data() + mBuffer.size());
+
+    return !mIsFailed;
+}
@@ -0,0 +1,136 @@
+#ifndef COMPRESSEDFILESTREAM_H
+#define COMPRESSEDFILESTREAM_H
+
+#include <istream>
+#include <ostream>
+#include <fstream>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "compression.h"
+
+namespace Utilities::Core
+{
+    /* Input stream that transparently decompresses the data while it is being read: gzip (.gz) and zstd (.zst) files are decompressed chunk by chunk (no temporary file), other files being read as is
+       The data might also be a file content that has already been read into memory (e.g. by the asynchronous file I/O of the batch mode)
+       Only seeking back to the beginning is supported (which restarts the decompression). Corrupt or truncated compressed data ends the stream and is reported by isCorrupt()
+    */
+    class DecompressingInputStream : public std::istream
+    {
+    public:
+        DecompressingInputStream();
+
+        DecompressingInputStream(const DecompressingInputStream&) = delete;
+        DecompressingInputStream& operator=(const DecompressingInputStream&) = delete;
+
+        /* The compression format is selected by the file extension. The stream gets into fail state if the file cannot be opened or its format is not supported
+        */
+        void open(const std::filesystem::path& file);
+
+        /* The content (in the given format) is taken over by the stream
+        */
+        void open(std::string content, const CompressionFormat compressionFormat);
+
+        bool isOpen() const;
+        void close();
+        bool isCorrupt() const;
+
+    private:
+        class DecompressingBuffer : public std::streambuf
+        {
+        public:
+            DecompressingBuffer();
+
+            bool open(const std::filesystem::path& file);
+            bool open(std::string content, const CompressionFormat compressionFormat);
+            bool isOpen() const;
+            void close();
+            bool isCorrupt() const;
+
+        protected:
+            int_type underflow() override;
+            pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode) override;
+            pos_type seekpos(pos_type position, std::ios_base::openmode mode) override;
+
+        private:
+            bool _decompress();
+            void _readCompressedData();
+            size_t _readData(char* pData, const size_t size);
+            void _allocateBuffer();
+            bool _rewind();
+            std::streamoff _getPosition() const;
+
+            static constexpr size_t scBufferSize{64u * 1024u};
+
+            std::filebuf mFileBuffer;
+            std::unique_ptr<Decompressor> mpDecompressor;   // none for uncompressed data
+
+            // file: last compressed chunk read from file, memory: the whole content
+            std::string mContent;
+            std::string_view mRemainingContent;
+            bool mIsFileSource;
+            bool mIsSourceConsumed;
+
+            std::unique_ptr<char[]> mpBuffer;               // decompressed (or uncompressed file) data (get area)
+            std::streamoff mBufferPosition;                 // position of the get area within the decompressed data
+            bool mIsBufferFilled;                           // the decompressor might have more data pending even without further input
+            bool mIsOpen;
+            bool mIsCorrupt;
+        };
+
+        DecompressingBuffer mBuffer;
+    };
+
+    /* Output stream that transparently compresses the data while it is being written: gzip (.gz) and zstd (.zst) are selected by the file extension, other files being written as is
+       The compressed stream is only complete once the stream is closed. If the file cannot be completely written the stream gets into fail state
+    */
+    class CompressingOutputStream : public std::ostream
+    {
+    public:
+        CompressingOutputStream();
+
+        CompressingOutputStream(const CompressingOutputStream&) = delete;
+        CompressingOutputStream& operator=(const CompressingOutputStream&) = delete;
+
+        /* Creates (truncates) the file. The stream gets into fail state if the file cannot be opened or its format is not supported
+        */
+        void open(const std::filesystem::path& file);
+
+        bool isOpen() const;
+        void close();
+
+    private:
+        class CompressingBuffer : public std::streambuf
+        {
+        public:
+            CompressingBuffer();
+
+            bool open(const std::filesystem::path& file);
+            bool isOpen() const;
+            bool close();
+
+        protected:
+            int_type overflow(int_type ch) override;
+            int sync() override;
+
+        private:
+            bool _writePendingData(const bool isFinishRequired);
+
+            static constexpr size_t scBufferSize{64u * 1024u};
+
+            std::filebuf mFileBuffer;
+            std::unique_ptr<Compressor> mpCompressor;       // none for uncompressed data
+            std::vector<char> mBuffer;                      // data not written yet (put area)
+            std::string mCompressedData;
+            bool mIsFailed;
+        };
+
+        CompressingBuffer mBuffer;
+    };
+
+    using DecompressingInputStreamPtr = std::shared_ptr<DecompressingInputStream>;
+    using CompressingOutputStreamPtr = std::shared_ptr<CompressingOutputStream>;
+}
+
+#endif // COMPRESSEDFILESTREAM_H
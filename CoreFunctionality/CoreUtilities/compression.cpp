@@ -0,0 +1,404 @@
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstring>
+
+#ifdef ZLIB_AVAILABLE
+#include <zlib.h>
+#endif
+
+#ifdef ZSTD_AVAILABLE
+#include <zstd.h>
+#endif
+
+#include "coreutils.h"
+#include "compression.h"
+
+Utilities::Core::CompressionFormat Utilities::Core::getCompressionFormat(const std::filesystem::path& file)
+{
+    CompressionFormat compressionFormat{CompressionFormat::NONE};
+
+    std::string extension{file.extension().string()};
+    convertStringCase(extension, false);
+
+    if (".gz" == extension)
+    {
+        compressionFormat = CompressionFormat::GZIP;
+    }
+    else if (".zst" == extension)
+    {
+        compressionFormat = CompressionFormat::ZSTD;
+    }
+
+    return compressionFormat;
+}
+
+bool Utilities::Core::isCompressionFormatSupported(const CompressionFormat compressionFormat)
+{
+    bool isSupported{CompressionFormat::NONE == compressionFormat};
+
+#ifdef ZLIB_AVAILABLE
+    isSupported = isSupported || CompressionFormat::GZIP == compressionFormat || CompressionFormat::DEFLATE == compressionFormat;
+#endif
+
+#ifdef ZSTD_AVAILABLE
+    isSupported = isSupported || CompressionFormat::ZSTD == compressionFormat;
+#endif
+
+    return isSupported;
+}
+
+bool Utilities::Core::compressContent(const std::string_view content, const CompressionFormat compressionFormat, std::string& compressedContent)
+{
+    Compressor compressor{compressionFormat};
+
+    compressedContent.clear();
+
+    const bool c_Success{compressor.isValid() && compressor.compress(content, compressedContent) && compressor.finish(compressedContent)};
+
+    return c_Success;
+}
+
+/* Without zlib a (slower) bytewise table lookup is used
+*/
+std::uint32_t Utilities::Core::getCrc32(const std::string_view data, const std::uint32_t previousCrc)
+{
+    std::uint32_t crc{previousCrc};
+
+#ifdef ZLIB_AVAILABLE
+    std::string_view remainingData{data};
+
+    // zlib counts the data in 32 bit units so big data is provided in slices
+    while (!remainingData.empty())
+    {
+        const size_t c_SliceSize{std::min<size_t>(remainingData.size(), UINT_MAX)};
+
+        crc = static_cast<std::uint32_t>(crc32(crc, reinterpret_cast<const Bytef*>(remainingData.data()), static_cast<uInt>(c_SliceSize)));
+        remainingData.remove_prefix(c_SliceSize);
+    }
+#else
+    static const std::array<std::uint32_t, 256> sc_CrcTable{[]() {
+        std::array<std::uint32_t, 256> crcTable{};
+
+        for (std::uint32_t byteValue{0u}; byteValue < crcTable.size(); ++byteValue)
+        {
+            std::uint32_t crcValue{byteValue};
+
+            for (int bitNumber{0}; bitNumber < 8; ++bitNumber)
+            {
+                crcValue = 0u != (crcValue & 1u) ? 0xEDB88320u ^ (crcValue >> 1) : crcValue >> 1;
+            }
+
+            crcTable[byteValue] = crcValue;
+        }
+
+        return crcTable;
+    }()};
+
+    crc = ~crc;
+
+    for (const char c_Character : data)
+    {
+        crc = sc_CrcTable[(crc ^ static_cast<unsigned char>(c_Character)) & 0xFFu] ^ (crc >> 8);
+    }
+
+    crc = ~crc;
+#endif
+
+    return crc;
+}
+
+/* The gzip streams are written with the default compression level and without file name or modification time, so the same content is always compressed the same way (as required by the output stamps)
+*/
+Utilities::Core::Compressor::Compressor(const CompressionFormat compressionFormat)
+    : mCompressionFormat{compressionFormat}
+    , mpZlibStream{nullptr}
+    , mpZstdContext{nullptr}
+    , mIsValid{CompressionFormat::NONE == compressionFormat}
+{
+#ifdef ZLIB_AVAILABLE
+    if (CompressionFormat::GZIP == mCompressionFormat || CompressionFormat::DEFLATE == mCompressionFormat)
+    {
+        // the window bits select the gzip wrapper (positive, offset by 16) or raw deflate data (negative)
+        constexpr int c_GzipWindowBits{15 + 16};
+        constexpr int c_DeflateWindowBits{-15};
+        constexpr int c_MemoryLevel{8};
+
+        mpZlibStream = new z_stream{};
+        mIsValid = Z_OK == deflateInit2(mpZlibStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, CompressionFormat::GZIP == mCompressionFormat ? c_GzipWindowBits : c_DeflateWindowBits,
+                                        c_MemoryLevel, Z_DEFAULT_STRATEGY);
+
+        if (!mIsValid)
+        {
+            delete mpZlibStream;
+            mpZlibStream = nullptr;
+        }
+    }
+#endif
+
+#ifdef ZSTD_AVAILABLE
+    if (CompressionFormat::ZSTD == mCompressionFormat)
+    {
+        mpZstdContext = ZSTD_createCCtx();
+        mIsValid = nullptr != mpZstdContext && !ZSTD_isError(ZSTD_CCtx_setParameter(mpZstdContext, ZSTD_c_compressionLevel, ZSTD_CLEVEL_DEFAULT));
+    }
+#endif
+}
+
+Utilities::Core::Compressor::~Compressor()
+{
+#ifdef ZLIB_AVAILABLE
+    if (mpZlibStream)
+    {
+        (void)deflateEnd(mpZlibStream);
+        delete mpZlibStream;
+    }
+#endif
+
+#ifdef ZSTD_AVAILABLE
+    if (mpZstdContext)
+    {
+        (void)ZSTD_freeCCtx(mpZstdContext);
+    }
+#endif
+}
+
+bool Utilities::Core::Compressor::isValid() const
+{
+    return mIsValid;
+}
+
+bool Utilities::Core::Compressor::compress(const std::string_view data, std::string& output)
+{
+    return _compress(data, false, output);
+}
+
+bool Utilities::Core::Compressor::finish(std::string& output)
+{
+    return _compress({}, true, output);
+}
+
+/* The output grows by one chunk at a time, the unused part of the chunk being discarded after each step
+*/
+bool Utilities::Core::Compressor::_compress(const std::string_view data, const bool isFinishRequired, std::string& output)
+{
+    bool success{mIsValid};
+
+    if (success && CompressionFormat::NONE == mCompressionFormat)
+    {
+        output.append(data);
+    }
+
+#ifdef ZLIB_AVAILABLE
+    if (success && (CompressionFormat::GZIP == mCompressionFormat || CompressionFormat::DEFLATE == mCompressionFormat))
+    {
+        std::string_view remainingData{data};
+        bool isStreamEnded{false};
+
+        // zlib counts the data in 32 bit units so big data is provided in slices
+        do
+        {
+            const size_t c_SliceSize{std::min<size_t>(remainingData.size(), UINT_MAX)};
+            const bool c_IsLastSlice{c_SliceSize == remainingData.size()};
+
+            mpZlibStream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(remainingData.data()));
+            mpZlibStream->avail_in = static_cast<uInt>(c_SliceSize);
+
+            do
+            {
+                const size_t c_OutputSize{output.size()};
+                output.resize(c_OutputSize + scOutputChunkSize);
+
+                mpZlibStream->next_out = reinterpret_cast<Bytef*>(output.data() + c_OutputSize);
+                mpZlibStream->avail_out = static_cast<uInt>(scOutputChunkSize);
+
+                const int c_Result{deflate(mpZlibStream, isFinishRequired && c_IsLastSlice ? Z_FINISH : Z_NO_FLUSH)};
+
+                output.resize(c_OutputSize + scOutputChunkSize - mpZlibStream->avail_out);
+                success = Z_STREAM_ERROR != c_Result;
+                isStreamEnded = Z_STREAM_END == c_Result;
+            }
+            while (success && (0u == mpZlibStream->avail_out || 0u != mpZlibStream->avail_in || (isFinishRequired && c_IsLastSlice && !isStreamEnded)));
+
+            remainingData.remove_prefix(c_SliceSize);
+        }
+        while (success && !remainingData.empty());
+
+        // nothing can be written once the stream is ended
+        mIsValid = success && !isStreamEnded;
+    }
+#endif
+
+#ifdef ZSTD_AVAILABLE
+    if (success && CompressionFormat::ZSTD == mCompressionFormat)
+    {
+        ZSTD_inBuffer inputBuffer{data.data(), data.size(), 0u};
+        size_t remainingCount{0u};
+
+        do
+        {
+            const size_t c_OutputSize{output.size()};
+            output.resize(c_OutputSize + scOutputChunkSize);
+
+            ZSTD_outBuffer outputBuffer{output.data() + c_OutputSize, scOutputChunkSize, 0u};
+            remainingCount = ZSTD_compressStream2(mpZstdContext, &outputBuffer, &inputBuffer, isFinishRequired ? ZSTD_e_end : ZSTD_e_continue);
+
+            output.resize(c_OutputSize + outputBuffer.pos);
+            success = !ZSTD_isError(remainingCount);
+        }
+        while (success && (inputBuffer.pos < inputBuffer.size || (isFinishRequired && 0u != remainingCount)));
+
+        mIsValid = success && !isFinishRequired;
+    }
+#endif
+
+    return success;
+}
+
+Utilities::Core::Decompressor::Decompressor(const CompressionFormat compressionFormat)
+    : mCompressionFormat{compressionFormat}
+    , mpZlibStream{nullptr}
+    , mpZstdContext{nullptr}
+    , mIsValid{CompressionFormat::NONE == compressionFormat}
+    , mIsStreamComplete{CompressionFormat::NONE == compressionFormat}
+{
+#ifdef ZLIB_AVAILABLE
+    if (CompressionFormat::GZIP == mCompressionFormat)
+    {
+        constexpr int c_GzipWindowBits{15 + 16};
+
+        mpZlibStream = new z_stream{};
+        mIsValid = Z_OK == inflateInit2(mpZlibStream, c_GzipWindowBits);
+
+        if (!mIsValid)
+        {
+            delete mpZlibStream;
+            mpZlibStream = nullptr;
+        }
+    }
+#endif
+
+#ifdef ZSTD_AVAILABLE
+    if (CompressionFormat::ZSTD == mCompressionFormat)
+    {
+        mpZstdContext = ZSTD_createDCtx();
+        mIsValid = nullptr != mpZstdContext;
+    }
+#endif
+}
+
+Utilities::Core::Decompressor::~Decompressor()
+{
+#ifdef ZLIB_AVAILABLE
+    if (mpZlibStream)
+    {
+        (void)inflateEnd(mpZlibStream);
+        delete mpZlibStream;
+    }
+#endif
+
+#ifdef ZSTD_AVAILABLE
+    if (mpZstdContext)
+    {
+        (void)ZSTD_freeDCtx(mpZstdContext);
+    }
+#endif
+}
+
+bool Utilities::Core::Decompressor::isValid() const
+{
+    return mIsValid;
+}
+
+bool Utilities::Core::Decompressor::decompress(std::string_view& input, char* pOutput, const size_t outputSize, size_t& producedCount)
+{
+    bool success{mIsValid};
+
+    producedCount = 0u;
+
+    if (success && CompressionFormat::NONE == mCompressionFormat)
+    {
+        producedCount = std::min(input.size(), outputSize);
+        std::memcpy(pOutput, input.data(), producedCount);
+        input.remove_prefix(producedCount);
+    }
+
+#ifdef ZLIB_AVAILABLE
+    if (success && CompressionFormat::GZIP == mCompressionFormat)
+    {
+        mpZlibStream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        mpZlibStream->avail_in = static_cast<uInt>(std::min<size_t>(input.size(), UINT_MAX));
+        mpZlibStream->next_out = reinterpret_cast<Bytef*>(pOutput);
+        mpZlibStream->avail_out = static_cast<uInt>(std::min<size_t>(outputSize, UINT_MAX));
+
+        const uInt c_AvailableInputCount{mpZlibStream->avail_in};
+        const uInt c_AvailableOutputCount{mpZlibStream->avail_out};
+        const int c_Result{inflate(mpZlibStream, Z_NO_FLUSH)};
+
+        input.remove_prefix(c_AvailableInputCount - mpZlibStream->avail_in);
+        producedCount = c_AvailableOutputCount - mpZlibStream->avail_out;
+
+        success = Z_OK == c_Result || Z_STREAM_END == c_Result || Z_BUF_ERROR == c_Result;
+
+        // a call without progress (no input left) doesn't change the state of the stream
+        if (Z_BUF_ERROR != c_Result)
+        {
+            mIsStreamComplete = Z_STREAM_END == c_Result;
+        }
+
+        // another gzip member might follow
+        if (mIsStreamComplete && !input.empty())
+        {
+            success = Z_OK == inflateReset(mpZlibStream);
+            mIsStreamComplete = false;
+        }
+    }
+#endif
+
+#ifdef ZSTD_AVAILABLE
+    if (success && CompressionFormat::ZSTD == mCompressionFormat)
+    {
+        ZSTD_inBuffer inputBuffer{input.data(), input.size(), 0u};
+        ZSTD_outBuffer outputBuffer{pOutput, outputSize, 0u};
+
+        const size_t c_Result{ZSTD_decompressStream(mpZstdContext, &outputBuffer, &inputBuffer)};
+
+        input.remove_prefix(inputBuffer.pos);
+        producedCount = outputBuffer.pos;
+
+        success = !ZSTD_isError(c_Result);
+
+        // 0: a frame has been completely decompressed and flushed (the next frame, if any, starts with the next call)
+        if (inputBuffer.pos > 0u || outputBuffer.pos > 0u)
+        {
+            mIsStreamComplete = success && 0u == c_Result;
+        }
+    }
+#endif
+
+    return success;
+}
+
+bool Utilities::Core::Decompressor::isStreamComplete() const
+{
+    return mIsStreamComplete;
+}
+
+void Utilities::Core::Decompressor::reset()
+{
+    mIsStreamComplete = CompressionFormat::NONE == mCompressionFormat;
+
+#ifdef ZLIB_AVAILABLE
+    if (mpZlibStream)
+    {
+        mIsValid = Z_OK == inflateReset(mpZlibStream);
+    }
+#endif
+
+#ifdef ZSTD_AVAILABLE
+    if (mpZstdContext)
+    {
+        mIsValid = !ZSTD_isError(ZSTD_DCtx_reset(mpZstdContext, ZSTD_reset_session_only));
+    }
+#endif
+}
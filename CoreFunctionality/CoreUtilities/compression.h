@@ -0,0 +1,105 @@
+#ifndef COMPRESSION_H
+#define COMPRESSION_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <filesystem>
+
+// library types, only known to the translation unit (zlib and zstd are both optional)
+struct z_stream_s;
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+
+namespace Utilities::Core
+{
+    enum class CompressionFormat
+    {
+        NONE,
+        GZIP,
+        ZSTD,
+        DEFLATE                 // raw deflate data, only written within containers (e.g. zip entries) so it is never selected by file extension
+    };
+
+    /* The format is selected by the file extension: .gz (gzip) or .zst (zstd), any other file being uncompressed
+    */
+    CompressionFormat getCompressionFormat(const std::filesystem::path& file);
+
+    /* Each compression format is only available if the application has been built with its library (zlib, zstd)
+    */
+    bool isCompressionFormatSupported(const CompressionFormat compressionFormat);
+
+    /* Compresses the whole content at once (e.g. a file written in the background). Returns false if the format is not supported
+    */
+    bool compressContent(const std::string_view content, const CompressionFormat compressionFormat, std::string& compressedContent);
+
+    /* CRC-32 checksum (as used by gzip and zip) of the data, continuing from the checksum of the previous data (if any)
+    */
+    std::uint32_t getCrc32(const std::string_view data, const std::uint32_t previousCrc = 0u);
+
+    /* Streaming compressor: the data is provided in chunks, the compressed data being appended to the output string
+       The compressed stream is only complete once finish() has been called. The NONE format copies the data as is
+    */
+    class Compressor
+    {
+    public:
+        explicit Compressor(const CompressionFormat compressionFormat);
+        ~Compressor();
+
+        Compressor(const Compressor&) = delete;
+        Compressor& operator=(const Compressor&) = delete;
+
+        /* False if the format is not supported or the compressor could not be initialized
+        */
+        bool isValid() const;
+
+        bool compress(const std::string_view data, std::string& output);
+        bool finish(std::string& output);
+
+    private:
+        bool _compress(const std::string_view data, const bool isFinishRequired, std::string& output);
+
+        static constexpr size_t scOutputChunkSize{64u * 1024u};
+
+        const CompressionFormat mCompressionFormat;
+        z_stream_s* mpZlibStream;
+        ZSTD_CCtx_s* mpZstdContext;
+        bool mIsValid;
+    };
+
+    /* Streaming decompressor: the compressed data is consumed in chunks, each call producing as much decompressed data as fits into the output
+       Concatenated streams (multiple gzip members, multiple zstd frames) are decompressed as a single one. The NONE format copies the data as is
+    */
+    class Decompressor
+    {
+    public:
+        explicit Decompressor(const CompressionFormat compressionFormat);
+        ~Decompressor();
+
+        Decompressor(const Decompressor&) = delete;
+        Decompressor& operator=(const Decompressor&) = delete;
+
+        bool isValid() const;
+
+        /* The consumed data is removed from the input. Returns false if the data is corrupt
+        */
+        bool decompress(std::string_view& input, char* pOutput, const size_t outputSize, size_t& producedCount);
+
+        /* Returns true if the data consumed so far ends with a complete stream (so reaching the end of the input here is not a truncation)
+        */
+        bool isStreamComplete() const;
+
+        /* Prepares for decompressing the data from the beginning
+        */
+        void reset();
+
+    private:
+        const CompressionFormat mCompressionFormat;
+        z_stream_s* mpZlibStream;
+        ZSTD_DCtx_s* mpZstdContext;
+        bool mIsValid;
+        bool mIsStreamComplete;
+    };
+}
+
+#endif // COMPRESSION_H
@@ -1,4 +1,11 @@
 #include <algorithm>
+#include <atomic>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 #include "applicationdata.h"
 #include "coreutils.h"
@@ -34,17 +41,11 @@ Utilities::Core::Index_t Utilities::Core::readDataField(const std::string_view s
 
         if (!emptyStartingFieldParsed)
         {
-            while(currentIndex < c_Length)
-            {
-                if(src[currentIndex] != Data::c_CSVSeparator)
-                {
-                    dest += src[currentIndex];
-                    ++currentIndex;
-                    continue;
-                }
-
-                break;
-            }
+            // the field is copied at once (up to the next separator or the end of string)
+            const size_t c_FieldEnd{std::min(src.find(Data::c_CSVSeparator, currentIndex), c_Length)};
+
+            dest.append(src.substr(currentIndex, c_FieldEnd - currentIndex));
+            currentIndex = c_FieldEnd;
         }
 
         if(currentIndex != c_Length)
@@ -56,6 +57,24 @@ Utilities::Core::Index_t Utilities::Core::readDataField(const std::string_view s
     return nextIndex;
 }
 
+/* splits a csv row into its fields without copying them (the fields refer to the source string)
+*/
+void Utilities::Core::splitDataFields(const std::string_view src, std::vector<std::string_view>& fields)
+{
+    fields.clear();
+
+    size_t fieldBegin{0u};
+    size_t fieldEnd{0u};
+
+    do
+    {
+        fieldEnd = src.find(Data::c_CSVSeparator, fieldBegin);
+        fields.push_back(src.substr(fieldBegin, std::string_view::npos != fieldEnd ? fieldEnd - fieldBegin : std::string_view::npos));
+        fieldBegin = fieldEnd + 1;
+    }
+    while (std::string_view::npos != fieldEnd);
+}
+
 /* converts a string "in place" to upper- or lowercase
 */
 void Utilities::Core::convertStringCase(std::string& str, bool upperCase)
@@ -122,3 +141,171 @@ bool Utilities::Core::areParseableCharactersContained(const std::string_view str
 
     return containsParseableCharacters;
 }
+
+size_t Utilities::Core::getParseableCharactersEnd(const std::string_view str)
+{
+    size_t parseableCharactersEnd{str.size()};
+
+    while (parseableCharactersEnd > 0u)
+    {
+        if (const char c_CurrentChar{str[parseableCharactersEnd - 1]};
+            !std::isspace(static_cast<unsigned char>(c_CurrentChar)) && Data::c_CSVSeparator != c_CurrentChar)
+        {
+            break;
+        }
+
+        --parseableCharactersEnd;
+    }
+
+    return parseableCharactersEnd;
+}
+
+/* Reference: https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md (XXH64)
+   The input is read in little endian order so the same data gets the same hash on all supported platforms
+*/
+std::uint64_t Utilities::Core::getHash64(const std::string_view data, const std::uint64_t seed)
+{
+    constexpr std::uint64_t c_Prime1{0x9E3779B185EBCA87ull};
+    constexpr std::uint64_t c_Prime2{0xC2B2AE3D27D4EB4Full};
+    constexpr std::uint64_t c_Prime3{0x165667B19E3779F9ull};
+    constexpr std::uint64_t c_Prime4{0x85EBCA77C2B2AE63ull};
+    constexpr std::uint64_t c_Prime5{0x27D4EB2F165667C5ull};
+
+    const auto c_RotateLeft{[](const std::uint64_t value, const int bitsCount) {return (value << bitsCount) | (value >> (64 - bitsCount));}};
+
+    const auto c_Read{[&data](const size_t position, const size_t bytesCount) {
+        std::uint64_t value{0u};
+
+        for (size_t byteIndex{bytesCount}; byteIndex > 0u; --byteIndex)
+        {
+            value = (value << 8) | static_cast<unsigned char>(data[position + byteIndex - 1]);
+        }
+
+        return value;
+    }};
+
+    const auto c_Round{[&](const std::uint64_t accumulator, const std::uint64_t lane) {return c_RotateLeft(accumulator + lane * c_Prime2, 31) * c_Prime1;}};
+    const auto c_MergeRound{[&](const std::uint64_t accumulator, const std::uint64_t value) {return (accumulator ^ c_Round(0u, value)) * c_Prime1 + c_Prime4;}};
+
+    const size_t c_Size{data.size()};
+    size_t position{0u};
+    std::uint64_t hash;
+
+    if (c_Size >= 32u)
+    {
+        std::uint64_t accumulators[4]{seed + c_Prime1 + c_Prime2, seed + c_Prime2, seed, seed - c_Prime1};
+
+        for (; position + 32u <= c_Size; position += 32u)
+        {
+            for (size_t laneIndex{0u}; laneIndex < 4u; ++laneIndex)
+            {
+                accumulators[laneIndex] = c_Round(accumulators[laneIndex], c_Read(position + laneIndex * 8u, 8u));
+            }
+        }
+
+        hash = c_RotateLeft(accumulators[0], 1) + c_RotateLeft(accumulators[1], 7) + c_RotateLeft(accumulators[2], 12) + c_RotateLeft(accumulators[3], 18);
+
+        for (const auto c_Accumulator : accumulators)
+        {
+            hash = c_MergeRound(hash, c_Accumulator);
+        }
+    }
+    else
+    {
+        hash = seed + c_Prime5;
+    }
+
+    hash += static_cast<std::uint64_t>(c_Size);
+
+    for (; position + 8u <= c_Size; position += 8u)
+    {
+        hash = c_RotateLeft(hash ^ c_Round(0u, c_Read(position, 8u)), 27) * c_Prime1 + c_Prime4;
+    }
+
+    if (position + 4u <= c_Size)
+    {
+        hash = c_RotateLeft(hash ^ (c_Read(position, 4u) * c_Prime1), 23) * c_Prime2 + c_Prime3;
+        position += 4u;
+    }
+
+    for (; position < c_Size; ++position)
+    {
+        hash = c_RotateLeft(hash ^ (c_Read(position, 1u) * c_Prime5), 11) * c_Prime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= c_Prime2;
+    hash ^= hash >> 29;
+    hash *= c_Prime3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+bool Utilities::Core::getFileHash64(const Path_t& file, std::uint64_t& hash, const std::uint64_t seed)
+{
+    bool success{false};
+    std::error_code errorCode;
+
+    // the file is read in one go (the data files are at most a few MB)
+    if (const std::uintmax_t c_FileSize{std::filesystem::file_size(file, errorCode)}; !errorCode)
+    {
+        if (std::ifstream fileStream{file, std::ios::binary}; fileStream.is_open())
+        {
+            std::string content(static_cast<size_t>(c_FileSize), '\0');
+
+            if (fileStream.read(content.data(), static_cast<std::streamsize>(content.size())); fileStream.gcount() == static_cast<std::streamsize>(content.size()))
+            {
+                hash = getHash64(content, seed);
+                success = true;
+            }
+        }
+    }
+
+    return success;
+}
+
+Utilities::Core::Path_t Utilities::Core::getTemporaryFile(const Path_t& file)
+{
+    static std::atomic<unsigned int> s_TemporaryFilesCount{0u};
+
+#ifdef _WIN32
+    const int c_ProcessId{_getpid()};
+#else
+    const pid_t c_ProcessId{getpid()};
+#endif
+
+    Path_t temporaryFile{file};
+    temporaryFile += "." + std::to_string(c_ProcessId) + "." + std::to_string(s_TemporaryFilesCount++) + ".tmp";
+
+    return temporaryFile;
+}
+
+bool Utilities::Core::replaceFile(const Path_t& sourceFile, const Path_t& destinationFile)
+{
+    std::error_code errorCode;
+    std::filesystem::rename(sourceFile, destinationFile, errorCode);
+
+    if (std::errc::cross_device_link == errorCode)
+    {
+        const Path_t c_TemporaryFile{getTemporaryFile(destinationFile)};
+
+        if (std::filesystem::copy_file(sourceFile, c_TemporaryFile, errorCode); !errorCode)
+        {
+            std::filesystem::rename(c_TemporaryFile, destinationFile, errorCode);
+        }
+
+        std::error_code removalErrorCode;
+
+        if (errorCode)
+        {
+            (void)std::filesystem::remove(c_TemporaryFile, removalErrorCode);
+        }
+        else
+        {
+            (void)std::filesystem::remove(sourceFile, removalErrorCode);
+        }
+    }
+
+    return !errorCode;
+}
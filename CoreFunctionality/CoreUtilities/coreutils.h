@@ -3,6 +3,7 @@
 
 #include <string>
 #include <string_view>
+#include <vector>
 #include <optional>
 #include <filesystem>
 #include <chrono>
@@ -13,6 +14,7 @@
 #include <ctime>
 #include <iomanip>
 #include <cassert>
+#include <cstdint>
 
 #ifdef _WIN32
 #include "auxdata.h"
@@ -35,16 +37,25 @@ namespace Utilities::Core
     using Index_t = std::optional<size_t>;
     using Path_t = std::filesystem::path;
     using Error_t = unsigned short;
+    using Row_t = std::vector<std::string>; // the fields of an output table row (joined by the csv separator only when written as csv)
 
-    using InputStreamPtr = std::shared_ptr<std::ifstream>;
-    using OutputStreamPtr = std::shared_ptr<std::ofstream>;
-    using ErrorStreamPtr = std::shared_ptr<std::ofstream>;
+    // the parsers only require generic streams so they can read from/write to either files or memory (e.g. the labelling service requests)
+    using InputStreamPtr = std::shared_ptr<std::istream>;
+    using OutputStreamPtr = std::shared_ptr<std::ostream>;
+    using ErrorStreamPtr = std::shared_ptr<std::ostream>;
+
+    using InputFileStreamPtr = std::shared_ptr<std::ifstream>;
+    using OutputFileStreamPtr = std::shared_ptr<std::ofstream>;
 
     /* This function reads a substring starting with index until reaching a comma character (end of .csv cell) or the string has no more characters
        If the index points to CSV separator (',') then reading starts with next character
     */
     Index_t readDataField(const std::string_view src, std::string& dest, const Index_t index);
 
+    /* This function splits a .csv row (no quoted cells) into its fields, which refer to the characters of the row (the previous content of the fields vector is discarded)
+    */
+    void splitDataFields(const std::string_view src, std::vector<std::string_view>& fields);
+
     /* This function converts the string case to upper or lower
     */
     void convertStringCase(std::string& str, bool upperCase);
@@ -64,6 +75,30 @@ namespace Utilities::Core
     */
     bool areParseableCharactersContained(const std::string_view str);
 
+    /* This function returns the index following the last parseable character of the string (0 if no parseable characters are contained)
+       Any position lower than the returned index is followed by parseable content (the string is scanned backwards once)
+    */
+    size_t getParseableCharactersEnd(const std::string_view str);
+
+    /* This function returns the 64 bit hash of the data (xxHash64 algorithm), used for detecting content changes (not suitable for security purposes)
+       Multiple strings can be hashed together by passing the hash of the previous one as seed
+    */
+    std::uint64_t getHash64(const std::string_view data, const std::uint64_t seed = 0u);
+
+    /* This function calculates the 64 bit hash (see getHash64()) of the whole file content. Returns false if the file cannot be read
+    */
+    bool getFileHash64(const Path_t& file, std::uint64_t& hash, const std::uint64_t seed = 0u);
+
+    /* This function returns the path of a temporary file located next to the given file, unique among all running processes and threads (e.g. labellingtable.csv.4711.3.tmp)
+       A file written this way can then replace the given one by renaming (atomically, as both reside in the same directory)
+    */
+    Path_t getTemporaryFile(const Path_t& file);
+
+    /* This function moves the source file over the destination file so the destination is either the previous file or the complete new one (never a partially written file)
+       If both are not on the same file system (e.g. source on tmpfs) the source is copied to a temporary file next to the destination first. Returns false if the file cannot be moved
+    */
+    bool replaceFile(const Path_t& sourceFile, const Path_t& destinationFile);
+
     /* This function returns a string that represents a customized date/time value (e.g. current date and time)
     */
     template<typename clockType> std::string getDateTimeString(const std::chrono::time_point<clockType>& timePoint)
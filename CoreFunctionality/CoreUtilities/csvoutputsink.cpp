@@ -0,0 +1,31 @@
+#include "applicationdata.h"
+#include "csvoutputsink.h"
+
+Utilities::Core::CsvOutputSink::CsvOutputSink(const OutputStreamPtr pOutputStream)
+    : OutputSink(pOutputStream)
+{
+}
+
+bool Utilities::Core::CsvOutputSink::writeHeader(const std::vector<std::string_view>& columnNames)
+{
+    return writeRow(columnNames);
+}
+
+bool Utilities::Core::CsvOutputSink::writeRow(const std::vector<std::string_view>& fields)
+{
+    std::string& buffer{_getBuffer()};
+
+    for (size_t fieldIndex{0u}; fieldIndex < fields.size(); ++fieldIndex)
+    {
+        if (fieldIndex > 0u)
+        {
+            buffer += Data::c_CSVSeparator;
+        }
+
+        buffer += fields[fieldIndex];
+    }
+
+    buffer += '\n';
+
+    return _writeBufferIfFull();
+}
@@ -0,0 +1,20 @@
+#ifndef CSVOUTPUTSINK_H
+#define CSVOUTPUTSINK_H
+
+#include "outputsink.h"
+
+namespace Utilities::Core
+{
+    /* The default format: the header and each row are written as .csv rows (no quoted cells, same as for reading the input files)
+    */
+    class CsvOutputSink final : public OutputSink
+    {
+    public:
+        explicit CsvOutputSink(const OutputStreamPtr pOutputStream);
+
+        virtual bool writeHeader(const std::vector<std::string_view>& columnNames) override;
+        virtual bool writeRow(const std::vector<std::string_view>& fields) override;
+    };
+}
+
+#endif // CSVOUTPUTSINK_H
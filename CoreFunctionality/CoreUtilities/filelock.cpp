@@ -0,0 +1,90 @@
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include <sstream>
+#include <iomanip>
+
+#include "coreutils.h"
+#include "filelock.h"
+
+Utilities::Core::FileLock::FileLock(const std::filesystem::path& lockFile)
+#ifdef _WIN32
+    : mFileHandle{INVALID_HANDLE_VALUE}
+#else
+    : mFileDescriptor{-1}
+#endif
+    , mIsLocked{false}
+{
+    std::error_code errorCode;
+    (void)std::filesystem::create_directories(lockFile.parent_path(), errorCode);
+
+#ifdef _WIN32
+    mFileHandle = CreateFileW(lockFile.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (INVALID_HANDLE_VALUE != mFileHandle)
+    {
+        OVERLAPPED overlapped{};
+        mIsLocked = LockFileEx(mFileHandle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped);
+    }
+#else
+    mFileDescriptor = open(lockFile.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+
+    if (mFileDescriptor >= 0)
+    {
+        int result{-1};
+
+        // waiting might be interrupted by a signal (e.g. Ctrl+C handled by watch mode)
+        do
+        {
+            result = flock(mFileDescriptor, LOCK_EX);
+        }
+        while (result < 0 && EINTR == errno);
+
+        mIsLocked = 0 == result;
+    }
+#endif
+}
+
+/* Closing the file releases the lock
+*/
+Utilities::Core::FileLock::~FileLock()
+{
+#ifdef _WIN32
+    if (INVALID_HANDLE_VALUE != mFileHandle)
+    {
+        CloseHandle(mFileHandle);
+    }
+#else
+    if (mFileDescriptor >= 0)
+    {
+        close(mFileDescriptor);
+    }
+#endif
+}
+
+bool Utilities::Core::FileLock::isLocked() const
+{
+    return mIsLocked;
+}
+
+std::filesystem::path Utilities::Core::FileLock::getLockFile(const std::filesystem::path& lockDir, const std::filesystem::path& file)
+{
+    std::error_code errorCode;
+    std::filesystem::path absoluteFile{std::filesystem::weakly_canonical(file, errorCode)};
+
+    if (errorCode)
+    {
+        absoluteFile = std::filesystem::absolute(file, errorCode);
+    }
+
+    std::ostringstream lockFilename;
+    lockFilename << file.filename().string() << "." << std::hex << std::setfill('0') << std::setw(16) << getHash64(absoluteFile.string()) << ".lock";
+
+    return lockDir / lockFilename.str();
+}
@@ -0,0 +1,38 @@
+#ifndef FILELOCK_H
+#define FILELOCK_H
+
+#include <filesystem>
+
+namespace Utilities::Core
+{
+    /* Exclusive advisory lock on a file shared by multiple application instances (e.g. backup store, published output file), held until the object is destroyed
+       It only synchronizes the processes (and threads) that lock the same file; the lock file (and its directory) is created if missing and never removed
+       The constructor waits until the lock is acquired. If the lock file cannot be opened (e.g. read-only directory) no lock is held, which is reported by isLocked()
+    */
+    class FileLock
+    {
+    public:
+        explicit FileLock(const std::filesystem::path& lockFile);
+        ~FileLock();
+
+        FileLock(const FileLock&) = delete;
+        FileLock& operator=(const FileLock&) = delete;
+
+        bool isLocked() const;
+
+        /* The lock file of a data file is placed within the given directory (e.g. the workspace directory, so no lock files are left next to the data files)
+           It is named by the data file and the hash of its absolute path (e.g. labellingtable.csv.0123456789abcdef.lock), so the same lock file is used regardless of how the data file path is entered
+        */
+        static std::filesystem::path getLockFile(const std::filesystem::path& lockDir, const std::filesystem::path& file);
+
+    private:
+#ifdef _WIN32
+        void* mFileHandle;
+#else
+        int mFileDescriptor;
+#endif
+        bool mIsLocked;
+    };
+}
+
+#endif // FILELOCK_H
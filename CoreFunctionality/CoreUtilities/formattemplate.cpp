@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <optional>
+
+#include "formattemplate.h"
+
+Utilities::Core::FormatTemplate::FormatTemplate()
+    : mRequiredVariablesCount{0u}
+    , mIsValid{false}
+{
+}
+
+bool Utilities::Core::FormatTemplate::compile(const std::string_view pattern, const std::vector<std::string_view>& variableNames)
+{
+    mInstructions.clear();
+    mLiterals.clear();
+    mLiterals.reserve(pattern.size()); // upper bound
+    mRequiredVariablesCount = 0u;
+    mIsValid = true;
+
+    std::optional<size_t> currentSectionIndex; // index of the instruction that opened the current optional section (if any)
+    bool canMergeLiteral{false};               // a literal following a closed section should not be merged into the last literal of the section
+    const size_t c_PatternLength{pattern.size()};
+    size_t index{0u};
+
+    while (mIsValid && index < c_PatternLength)
+    {
+        const char c_CurrentChar{pattern[index]};
+        const bool c_IsDoubledChar{index + 1 < c_PatternLength && pattern[index + 1] == c_CurrentChar};
+
+        if (('{' == c_CurrentChar || '}' == c_CurrentChar || '[' == c_CurrentChar || ']' == c_CurrentChar) && c_IsDoubledChar)
+        {
+            _appendLiteral(pattern.substr(index, 1), canMergeLiteral); // escaped character
+            canMergeLiteral = true;
+            index += 2;
+        }
+        else if ('{' == c_CurrentChar)
+        {
+            const size_t c_ClosingBraceIndex{pattern.find('}', index)};
+
+            if (std::string_view::npos != c_ClosingBraceIndex)
+            {
+                const std::string_view c_VariableName{pattern.substr(index + 1, c_ClosingBraceIndex - index - 1)};
+
+                if (const auto c_VariableIt{std::find(variableNames.cbegin(), variableNames.cend(), c_VariableName)}; variableNames.cend() != c_VariableIt)
+                {
+                    const size_t c_VariableIndex{static_cast<size_t>(std::distance(variableNames.cbegin(), c_VariableIt))};
+                    mInstructions.push_back({InstructionType::VARIABLE, c_VariableIndex, 0u});
+                    mRequiredVariablesCount = std::max(mRequiredVariablesCount, c_VariableIndex + 1);
+                    index = c_ClosingBraceIndex + 1;
+                }
+                else
+                {
+                    mIsValid = false; // unknown variable
+                }
+            }
+            else
+            {
+                mIsValid = false; // unbalanced brace
+            }
+        }
+        else if ('[' == c_CurrentChar)
+        {
+            if (!currentSectionIndex.has_value())
+            {
+                currentSectionIndex = mInstructions.size();
+                mInstructions.push_back({InstructionType::OPTIONAL_SECTION, 0u, 0u}); // section end is determined when reaching the closing bracket
+                ++index;
+            }
+            else
+            {
+                mIsValid = false; // nested sections are not allowed
+            }
+        }
+        else if (']' == c_CurrentChar)
+        {
+            if (currentSectionIndex.has_value())
+            {
+                mInstructions[currentSectionIndex.value()].mFirst = mInstructions.size();
+                currentSectionIndex.reset();
+                canMergeLiteral = false;
+                ++index;
+            }
+            else
+            {
+                mIsValid = false; // unbalanced bracket
+            }
+        }
+        else if ('}' == c_CurrentChar)
+        {
+            mIsValid = false; // unbalanced brace
+        }
+        else
+        {
+            // the characters up to the next brace/bracket are appended at once
+            const size_t c_LiteralEnd{std::min(pattern.find_first_of("{}[]", index + 1), c_PatternLength)};
+
+            _appendLiteral(pattern.substr(index, c_LiteralEnd - index), canMergeLiteral);
+            canMergeLiteral = true;
+            index = c_LiteralEnd;
+        }
+    }
+
+    if (currentSectionIndex.has_value())
+    {
+        mIsValid = false; // optional section not closed
+    }
+
+    if (!mIsValid)
+    {
+        mInstructions.clear();
+        mLiterals.clear();
+        mRequiredVariablesCount = 0u;
+    }
+
+    return mIsValid;
+}
+
+bool Utilities::Core::FormatTemplate::isValid() const
+{
+    return mIsValid;
+}
+
+/* Two passes are performed over the instructions list: the first one calculates an upper bound of the resulting size (all literals and values, the optional sections
+   being checked only once, when writing), so the destination capacity can be reserved; the second one writes the actual content. No temporary strings are being created.
+*/
+void Utilities::Core::FormatTemplate::_render(std::string& dest, const std::string_view* pValues, const size_t valuesCount) const
+{
+    if (mIsValid && (0u == mRequiredVariablesCount || (pValues && valuesCount >= mRequiredVariablesCount)))
+    {
+        const size_t c_InstructionsCount{mInstructions.size()};
+        size_t requiredLength{mLiterals.size()};
+
+        for (const Instruction& c_Instruction : mInstructions)
+        {
+            if (InstructionType::VARIABLE == c_Instruction.mType)
+            {
+                requiredLength += pValues[c_Instruction.mFirst].size();
+            }
+        }
+
+        dest.reserve(dest.size() + requiredLength);
+
+        for (size_t instructionIndex{0u}; instructionIndex < c_InstructionsCount; ++instructionIndex)
+        {
+            const Instruction& c_Instruction{mInstructions[instructionIndex]};
+
+            if (InstructionType::LITERAL == c_Instruction.mType)
+            {
+                dest.append(mLiterals, c_Instruction.mFirst, c_Instruction.mSecond);
+            }
+            else if (InstructionType::VARIABLE == c_Instruction.mType)
+            {
+                dest.append(pValues[c_Instruction.mFirst]);
+            }
+            else if (!_isSectionEnabled(instructionIndex, pValues, valuesCount))
+            {
+                instructionIndex = c_Instruction.mFirst - 1; // skip section content
+            }
+        }
+    }
+}
+
+bool Utilities::Core::FormatTemplate::_isSectionEnabled(const size_t sectionIndex, const std::string_view* pValues, const size_t valuesCount) const
+{
+    bool isEnabled{true};
+
+    for (size_t instructionIndex{sectionIndex + 1}; instructionIndex < mInstructions[sectionIndex].mFirst; ++instructionIndex)
+    {
+        if (const Instruction& c_Instruction{mInstructions[instructionIndex]};
+            InstructionType::VARIABLE == c_Instruction.mType && (c_Instruction.mFirst >= valuesCount || pValues[c_Instruction.mFirst].empty()))
+        {
+            isEnabled = false;
+            break;
+        }
+    }
+
+    return isEnabled;
+}
+
+// consecutive literal characters are merged into a single instruction (if allowed)
+void Utilities::Core::FormatTemplate::_appendLiteral(const std::string_view literal, const bool canMerge)
+{
+    if (canMerge && !mInstructions.empty() && InstructionType::LITERAL == mInstructions.back().mType)
+    {
+        mInstructions.back().mSecond += literal.size();
+    }
+    else
+    {
+        mInstructions.push_back({InstructionType::LITERAL, mLiterals.size(), literal.size()});
+    }
+
+    mLiterals.append(literal);
+}
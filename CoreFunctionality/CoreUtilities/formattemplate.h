@@ -0,0 +1,65 @@
+#ifndef FORMATTEMPLATE_H
+#define FORMATTEMPLATE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+
+namespace Utilities::Core
+{
+    /* Text pattern compiled once into a list of instructions that are subsequently run for building the resulting string.
+       Pattern syntax:
+        - {name}: replaced by the value of the variable with the given name (variable names are provided at compile time)
+        - [...]: optional section, only written if ALL variables contained within it have non-empty values (sections cannot be nested)
+        - {{, }}, [[, ]]: literal brace/bracket characters
+        - any other character is written as it is
+       Example: "U{u}[_{type}]_P{port}" results in "U5_ETH_P1" for u = 5, type = ETH, port = 1 or in "U5_P1" if type is empty.
+    */
+    class FormatTemplate
+    {
+    public:
+        FormatTemplate();
+
+        /* Compiles the pattern into instructions. Returns false if the pattern is invalid (unknown variable, unbalanced brace/bracket etc).
+           In this case the template is reset to invalid state and renders nothing.
+        */
+        bool compile(const std::string_view pattern, const std::vector<std::string_view>& variableNames);
+
+        bool isValid() const;
+
+        /* Appends the rendered text to destination string (the required capacity is reserved upfront).
+           The values should be provided in the order of the variable names used when compiling the pattern.
+        */
+        template<size_t valuesCount> void render(std::string& dest, const std::array<std::string_view, valuesCount>& values) const
+        {
+            _render(dest, values.data(), valuesCount);
+        }
+
+    private:
+        enum class InstructionType
+        {
+            LITERAL,            // mFirst: literal offset within literals pool, mSecond: literal length
+            VARIABLE,           // mFirst: variable index
+            OPTIONAL_SECTION    // mFirst: index of the first instruction following the section
+        };
+
+        struct Instruction
+        {
+            InstructionType mType;
+            size_t mFirst;
+            size_t mSecond;
+        };
+
+        void _render(std::string& dest, const std::string_view* pValues, const size_t valuesCount) const;
+        bool _isSectionEnabled(const size_t sectionIndex, const std::string_view* pValues, const size_t valuesCount) const;
+        void _appendLiteral(const std::string_view literal, const bool canMerge);
+
+        std::vector<Instruction> mInstructions;
+        std::string mLiterals;              // all literal substrings of the pattern, concatenated
+        size_t mRequiredVariablesCount;     // highest used variable index + 1
+        bool mIsValid;
+    };
+}
+
+#endif // FORMATTEMPLATE_H
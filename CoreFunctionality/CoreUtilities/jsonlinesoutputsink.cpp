@@ -0,0 +1,117 @@
+#include <cctype>
+
+#include "jsonlinesoutputsink.h"
+
+Utilities::Core::JsonLinesOutputSink::JsonLinesOutputSink(const OutputStreamPtr pOutputStream)
+    : OutputSink(pOutputStream)
+{
+}
+
+bool Utilities::Core::JsonLinesOutputSink::writeHeader(const std::vector<std::string_view>& columnNames)
+{
+    mMemberPrefixes.clear();
+
+    for (const auto& c_ColumnName : columnNames)
+    {
+        std::string memberPrefix{mMemberPrefixes.empty() ? "\"" : ",\""};
+
+        _appendEscapedString(memberPrefix, _getKey(c_ColumnName));
+        memberPrefix += "\":\"";
+
+        mMemberPrefixes.push_back(std::move(memberPrefix));
+    }
+
+    return _isValid();
+}
+
+/* A row with more fields than columns gets keys named by the column number (e.g. column7)
+*/
+bool Utilities::Core::JsonLinesOutputSink::writeRow(const std::vector<std::string_view>& fields)
+{
+    while (mMemberPrefixes.size() < fields.size())
+    {
+        mMemberPrefixes.push_back((mMemberPrefixes.empty() ? "\"column" : ",\"column") + std::to_string(mMemberPrefixes.size() + 1) + "\":\"");
+    }
+
+    std::string& buffer{_getBuffer()};
+
+    buffer += '{';
+
+    for (size_t fieldIndex{0u}; fieldIndex < fields.size(); ++fieldIndex)
+    {
+        buffer += mMemberPrefixes[fieldIndex];
+        _appendEscapedString(buffer, fields[fieldIndex]);
+        buffer += '"';
+    }
+
+    buffer += "}\n";
+
+    return _writeBufferIfFull();
+}
+
+std::string Utilities::Core::JsonLinesOutputSink::_getKey(const std::string_view columnName)
+{
+    std::string key;
+    bool isSeparatorPending{false}; // consecutive non-alphanumeric characters result in a single underscore
+
+    for (const char c_Character : columnName)
+    {
+        if (std::isalnum(static_cast<unsigned char>(c_Character)))
+        {
+            if (isSeparatorPending && !key.empty())
+            {
+                key += '_';
+            }
+
+            key += static_cast<char>(std::tolower(static_cast<unsigned char>(c_Character)));
+            isSeparatorPending = false;
+        }
+        else
+        {
+            isSeparatorPending = true;
+        }
+    }
+
+    return key;
+}
+
+/* The characters other than quotes, backslashes and control characters are written as they are (the output is UTF-8 like the input)
+*/
+void Utilities::Core::JsonLinesOutputSink::_appendEscapedString(std::string& output, const std::string_view str)
+{
+    constexpr std::string_view c_HexDigits{"0123456789abcdef"};
+
+    for (const char c_Character : str)
+    {
+        switch (c_Character)
+        {
+        case '"':
+            output += "\\\"";
+            break;
+        case '\\':
+            output += "\\\\";
+            break;
+        case '\n':
+            output += "\\n";
+            break;
+        case '\r':
+            output += "\\r";
+            break;
+        case '\t':
+            output += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c_Character) < 0x20u)
+            {
+                output += "\\u00";
+                output += c_HexDigits[static_cast<unsigned char>(c_Character) >> 4];
+                output += c_HexDigits[static_cast<unsigned char>(c_Character) & 0x0Fu];
+            }
+            else
+            {
+                output += c_Character;
+            }
+            break;
+        }
+    }
+}
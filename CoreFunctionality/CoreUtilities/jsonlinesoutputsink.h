@@ -0,0 +1,31 @@
+#ifndef JSONLINESOUTPUTSINK_H
+#define JSONLINESOUTPUTSINK_H
+
+#include "outputsink.h"
+
+namespace Utilities::Core
+{
+    /* JSON Lines format: each row is written as a JSON object on its own line, the column names being the keys (e.g. "__Cable part number__" becomes "cable_part_number")
+       All values are strings. The header is not written as a row
+    */
+    class JsonLinesOutputSink final : public OutputSink
+    {
+    public:
+        explicit JsonLinesOutputSink(const OutputStreamPtr pOutputStream);
+
+        virtual bool writeHeader(const std::vector<std::string_view>& columnNames) override;
+        virtual bool writeRow(const std::vector<std::string_view>& fields) override;
+
+    private:
+        /* Lower case, the surrounding underscores removed and any other character than letters and digits replaced by an underscore
+        */
+        static std::string _getKey(const std::string_view columnName);
+
+        static void _appendEscapedString(std::string& output, const std::string_view str);
+
+        // the opening of each member (quoted key, colon and value opening quote), e.g. ,"item_number":"
+        std::vector<std::string> mMemberPrefixes;
+    };
+}
+
+#endif // JSONLINESOUTPUTSINK_H
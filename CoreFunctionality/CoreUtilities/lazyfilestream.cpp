@@ -0,0 +1,94 @@
+#include "lazyfilestream.h"
+
+Utilities::Core::LazyFileStream::LazyFileStream()
+    : std::ostream{nullptr}
+{
+    // the buffer is only constructed after the base class, so it gets attached here
+    rdbuf(&mBuffer);
+}
+
+void Utilities::Core::LazyFileStream::setFile(const std::filesystem::path& file)
+{
+    mBuffer.setFile(file);
+    clear();
+}
+
+void Utilities::Core::LazyFileStream::close()
+{
+    mBuffer.close();
+}
+
+bool Utilities::Core::LazyFileStream::isFileCreated() const
+{
+    return mBuffer.isFileCreated();
+}
+
+Utilities::Core::LazyFileStream::LazyFileBuffer::LazyFileBuffer()
+    : mIsOpeningAttempted{false}
+{
+}
+
+void Utilities::Core::LazyFileStream::LazyFileBuffer::setFile(const std::filesystem::path& file)
+{
+    close();
+    mFile = file;
+    mIsOpeningAttempted = false;
+}
+
+void Utilities::Core::LazyFileStream::LazyFileBuffer::close()
+{
+    if (mFileBuffer.is_open())
+    {
+        (void)mFileBuffer.close();
+    }
+}
+
+bool Utilities::Core::LazyFileStream::LazyFileBuffer::isFileCreated() const
+{
+    return mFileBuffer.is_open();
+}
+
+/* No put area is used (the file buffer does the buffering), so each write reaches either overflow() or xsputn()
+*/
+Utilities::Core::LazyFileStream::LazyFileBuffer::int_type Utilities::Core::LazyFileStream::LazyFileBuffer::overflow(int_type ch)
+{
+    int_type result{traits_type::eof()};
+
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+    {
+        result = traits_type::not_eof(ch);
+    }
+    else if (_openFile())
+    {
+        result = mFileBuffer.sputc(traits_type::to_char_type(ch));
+    }
+
+    return result;
+}
+
+std::streamsize Utilities::Core::LazyFileStream::LazyFileBuffer::xsputn(const char* pData, std::streamsize count)
+{
+    const std::streamsize c_WrittenCount{count > 0 && _openFile() ? mFileBuffer.sputn(pData, count) : 0};
+
+    return c_WrittenCount;
+}
+
+int Utilities::Core::LazyFileStream::LazyFileBuffer::sync()
+{
+    const int c_Result{mFileBuffer.is_open() ? mFileBuffer.pubsync() : 0};
+
+    return c_Result;
+}
+
+/* The file is opened once: if opening fails, all subsequent writes fail too (instead of retrying on each write)
+*/
+bool Utilities::Core::LazyFileStream::LazyFileBuffer::_openFile()
+{
+    if (!mIsOpeningAttempted)
+    {
+        mIsOpeningAttempted = true;
+        (void)mFileBuffer.open(mFile, std::ios_base::out | std::ios_base::trunc);
+    }
+
+    return mFileBuffer.is_open();
+}
@@ -0,0 +1,61 @@
+#ifndef LAZYFILESTREAM_H
+#define LAZYFILESTREAM_H
+
+#include <ostream>
+#include <fstream>
+#include <filesystem>
+#include <memory>
+
+namespace Utilities::Core
+{
+    /* Output stream that only creates (truncates) its file when the first character is written to it, used for files that are rarely required (e.g. the parsing errors file)
+       No file is created (and no existing file is touched) as long as nothing gets written. If the file cannot be opened on first write the stream gets into bad state
+    */
+    class LazyFileStream : public std::ostream
+    {
+    public:
+        LazyFileStream();
+
+        LazyFileStream(const LazyFileStream&) = delete;
+        LazyFileStream& operator=(const LazyFileStream&) = delete;
+
+        /* Sets the file to be written (the previous one gets closed) and clears the stream state. The file is not opened yet
+        */
+        void setFile(const std::filesystem::path& file);
+
+        void close();
+
+        /* Returns true if the file has been opened (i.e. something has been written to the stream)
+        */
+        bool isFileCreated() const;
+
+    private:
+        class LazyFileBuffer : public std::streambuf
+        {
+        public:
+            LazyFileBuffer();
+
+            void setFile(const std::filesystem::path& file);
+            void close();
+            bool isFileCreated() const;
+
+        protected:
+            int_type overflow(int_type ch) override;
+            std::streamsize xsputn(const char* pData, std::streamsize count) override;
+            int sync() override;
+
+        private:
+            bool _openFile();
+
+            std::filesystem::path mFile;
+            std::filebuf mFileBuffer;
+            bool mIsOpeningAttempted;
+        };
+
+        LazyFileBuffer mBuffer;
+    };
+
+    using LazyFileStreamPtr = std::shared_ptr<LazyFileStream>;
+}
+
+#endif // LAZYFILESTREAM_H
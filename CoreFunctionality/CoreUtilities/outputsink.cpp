@@ -0,0 +1,54 @@
+#include "outputsink.h"
+
+Utilities::Core::OutputSink::OutputSink(const OutputStreamPtr pOutputStream)
+    : mpOutputStream{pOutputStream}
+    , mIsFinished{false}
+    , mIsFailed{!pOutputStream}
+{
+    mBuffer.reserve(scBufferSize);
+}
+
+Utilities::Core::OutputSink::~OutputSink()
+{
+}
+
+bool Utilities::Core::OutputSink::finish()
+{
+    const bool c_Success{_isValid() && _writeBuffer()};
+
+    mIsFinished = true;
+    mIsFailed = !c_Success;
+
+    return c_Success;
+}
+
+std::string& Utilities::Core::OutputSink::_getBuffer()
+{
+    return mBuffer;
+}
+
+bool Utilities::Core::OutputSink::_writeBufferIfFull()
+{
+    bool success{_isValid()};
+
+    if (success && mBuffer.size() >= scBufferSize)
+    {
+        success = _writeBuffer();
+        mIsFailed = !success;
+    }
+
+    return success;
+}
+
+bool Utilities::Core::OutputSink::_isValid() const
+{
+    return !mIsFailed && !mIsFinished && mpOutputStream && !mpOutputStream->fail();
+}
+
+bool Utilities::Core::OutputSink::_writeBuffer()
+{
+    mpOutputStream->write(mBuffer.data(), static_cast<std::streamsize>(mBuffer.size()));
+    mBuffer.clear();
+
+    return !mpOutputStream->fail();
+}
@@ -0,0 +1,56 @@
+#ifndef OUTPUTSINK_H
+#define OUTPUTSINK_H
+
+#include <vector>
+
+#include "coreutils.h"
+
+namespace Utilities::Core
+{
+    /* Base class of the table output formats (csv, JSON Lines, binary records, spreadsheet)
+       The sinks receive the columns of each row as separate fields and only build the representation of their own format
+       The output is collected into a buffer that gets written to the stream in large blocks. Once an operation failed all following ones fail too
+    */
+    class OutputSink
+    {
+    public:
+        explicit OutputSink(const OutputStreamPtr pOutputStream);
+        virtual ~OutputSink();
+
+        OutputSink(const OutputSink&) = delete;
+        OutputSink& operator=(const OutputSink&) = delete;
+
+        /* Should be called once, before writing any row (the sink decides whether the column names are written as a row, used as keys etc)
+        */
+        virtual bool writeHeader(const std::vector<std::string_view>& columnNames) = 0;
+
+        virtual bool writeRow(const std::vector<std::string_view>& fields) = 0;
+
+        /* Writes the remaining buffered output, after which no rows can be written anymore
+        */
+        virtual bool finish();
+
+    protected:
+        /* The derived sinks append their output to the buffer and then call _writeBufferIfFull()
+        */
+        std::string& _getBuffer();
+
+        bool _writeBufferIfFull();
+        bool _isValid() const;
+
+        const OutputStreamPtr mpOutputStream;
+
+    private:
+        bool _writeBuffer();
+
+        static constexpr size_t scBufferSize{64u * 1024u};
+
+        std::string mBuffer;
+        bool mIsFinished;
+        bool mIsFailed;
+    };
+
+    using OutputSinkPtr = std::unique_ptr<OutputSink>;
+}
+
+#endif // OUTPUTSINK_H
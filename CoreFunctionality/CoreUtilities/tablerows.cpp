@@ -0,0 +1,41 @@
+#include "tablerows.h"
+
+void Utilities::Core::TableRows::appendRow(const Row_t& row)
+{
+    for (const auto& c_Field : row)
+    {
+        mFieldsData += c_Field;
+        mFieldEnds.push_back(mFieldsData.size());
+    }
+
+    mRowEnds.push_back(mFieldEnds.size());
+}
+
+void Utilities::Core::TableRows::getRow(const size_t rowIndex, std::vector<std::string_view>& fields) const
+{
+    fields.clear();
+
+    if (rowIndex < mRowEnds.size())
+    {
+        const std::string_view c_FieldsData{mFieldsData};
+        const size_t c_FirstFieldIndex{rowIndex > 0u ? mRowEnds[rowIndex - 1] : 0u};
+
+        for (size_t fieldIndex{c_FirstFieldIndex}; fieldIndex < mRowEnds[rowIndex]; ++fieldIndex)
+        {
+            const size_t c_FieldBegin{fieldIndex > 0u ? mFieldEnds[fieldIndex - 1] : 0u};
+            fields.push_back(c_FieldsData.substr(c_FieldBegin, mFieldEnds[fieldIndex] - c_FieldBegin));
+        }
+    }
+}
+
+size_t Utilities::Core::TableRows::getRowsCount() const
+{
+    return mRowEnds.size();
+}
+
+void Utilities::Core::TableRows::clear()
+{
+    mFieldsData.clear();
+    mFieldEnds.clear();
+    mRowEnds.clear();
+}
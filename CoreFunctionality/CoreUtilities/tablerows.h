@@ -0,0 +1,32 @@
+#ifndef TABLEROWS_H
+#define TABLEROWS_H
+
+#include "coreutils.h"
+
+namespace Utilities::Core
+{
+    /* Rows of an output table kept split into their fields (no separator is involved so the fields can contain any characters)
+       The fields of all rows are stored one after the other into a single buffer so storing a row doesn't require any allocations of its own
+    */
+    class TableRows
+    {
+    public:
+        TableRows() = default;
+
+        void appendRow(const Row_t& row);
+
+        /* The fields refer to the internal buffer so they are only valid until the next row is appended (the previous content of the fields vector is discarded)
+        */
+        void getRow(const size_t rowIndex, std::vector<std::string_view>& fields) const;
+
+        size_t getRowsCount() const;
+        void clear();
+
+    private:
+        std::string mFieldsData;                    // fields of all rows, in order
+        std::vector<size_t> mFieldEnds;             // end of each field within the fields data
+        std::vector<size_t> mRowEnds;               // end of each row within the field ends (index following its last field)
+    };
+}
+
+#endif // TABLEROWS_H
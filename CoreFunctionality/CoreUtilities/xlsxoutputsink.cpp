@@ -0,0 +1,26 @@
+#include "xlsxoutputsink.h"
+
+Utilities::Core::XlsxOutputSink::XlsxOutputSink(const OutputStreamPtr pOutputStream)
+    : OutputSink(pOutputStream)
+    , mXlsxWriter{pOutputStream}
+{
+}
+
+bool Utilities::Core::XlsxOutputSink::writeHeader(const std::vector<std::string_view>& columnNames)
+{
+    return mXlsxWriter.writeRow(columnNames);
+}
+
+bool Utilities::Core::XlsxOutputSink::writeRow(const std::vector<std::string_view>& fields)
+{
+    return mXlsxWriter.writeRow(fields);
+}
+
+/* The spreadsheet is only complete once the shared strings table and the zip central directory are written
+*/
+bool Utilities::Core::XlsxOutputSink::finish()
+{
+    const bool c_IsSpreadsheetFinished{mXlsxWriter.finish()};
+
+    return OutputSink::finish() && c_IsSpreadsheetFinished;
+}
@@ -0,0 +1,25 @@
+#ifndef XLSXOUTPUTSINK_H
+#define XLSXOUTPUTSINK_H
+
+#include "outputsink.h"
+#include "xlsxwriter.h"
+
+namespace Utilities::Core
+{
+    /* Spreadsheet format: the header and the rows are written into a single worksheet (see XlsxWriter), which takes care of its own buffering
+    */
+    class XlsxOutputSink final : public OutputSink
+    {
+    public:
+        explicit XlsxOutputSink(const OutputStreamPtr pOutputStream);
+
+        virtual bool writeHeader(const std::vector<std::string_view>& columnNames) override;
+        virtual bool writeRow(const std::vector<std::string_view>& fields) override;
+        virtual bool finish() override;
+
+    private:
+        XlsxWriter mXlsxWriter;
+    };
+}
+
+#endif // XLSXOUTPUTSINK_H
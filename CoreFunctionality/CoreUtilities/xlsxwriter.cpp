@@ -0,0 +1,169 @@
+#include "xlsxwriter.h"
+
+Utilities::Core::XlsxWriter::XlsxWriter(const OutputStreamPtr pOutputStream)
+    : mZipWriter{pOutputStream}
+    , mSharedStringReferencesCount{0u}
+    , mIsFinished{false}
+    , mIsFailed{false}
+{
+    mIsFailed = !(mZipWriter.addEntry("[Content_Types].xml") && mZipWriter.write(scContentTypes) &&
+                  mZipWriter.addEntry("_rels/.rels") && mZipWriter.write(scPackageRelationships) &&
+                  mZipWriter.addEntry("xl/workbook.xml") && mZipWriter.write(scWorkbook) &&
+                  mZipWriter.addEntry("xl/_rels/workbook.xml.rels") && mZipWriter.write(scWorkbookRelationships) &&
+                  mZipWriter.addEntry("xl/worksheets/sheet1.xml") && mZipWriter.write(scWorksheetBegin));
+}
+
+bool Utilities::Core::XlsxWriter::writeRow(const std::vector<std::string_view>& cells)
+{
+    bool success{!mIsFailed && !mIsFinished};
+
+    if (success)
+    {
+        mRowData = "<row>";
+
+        for (const auto& c_Cell : cells)
+        {
+            _appendCell(c_Cell);
+        }
+
+        mRowData += "</row>";
+
+        success = mZipWriter.write(mRowData);
+        mIsFailed = !success;
+    }
+
+    return success;
+}
+
+/* The shared strings are written in the order of their first occurrence (which is their index)
+*/
+bool Utilities::Core::XlsxWriter::finish()
+{
+    bool success{!mIsFailed && !mIsFinished && mZipWriter.write(scWorksheetEnd) && mZipWriter.addEntry("xl/sharedStrings.xml")};
+
+    if (success)
+    {
+        std::string sharedStringsData{"<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+                                      "<sst xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\" count=\""};
+
+        sharedStringsData += std::to_string(mSharedStringReferencesCount);
+        sharedStringsData += "\" uniqueCount=\"";
+        sharedStringsData += std::to_string(mSharedStrings.size());
+        sharedStringsData += "\">";
+
+        for (const auto& c_SharedString : mSharedStrings)
+        {
+            sharedStringsData += "<si>";
+            _appendText(sharedStringsData, c_SharedString);
+            sharedStringsData += "</si>";
+
+            if (sharedStringsData.size() >= scWriteChunkSize)
+            {
+                success = success && mZipWriter.write(sharedStringsData);
+                sharedStringsData.clear();
+            }
+        }
+
+        sharedStringsData += "</sst>";
+
+        success = success && mZipWriter.write(sharedStringsData) && mZipWriter.finish();
+    }
+
+    mIsFinished = true;
+    mIsFailed = !success;
+
+    return success;
+}
+
+/* An empty cell is still written as the cells of a row have no explicit column references
+*/
+void Utilities::Core::XlsxWriter::_appendCell(const std::string_view cell)
+{
+    if (cell.empty())
+    {
+        mRowData += "<c/>";
+    }
+    else if (cell.size() <= scMaxNumberDigitsCount && isDigitString(cell) && (1u == cell.size() || '0' != cell.front()))
+    {
+        mRowData += "<c><v>";
+        mRowData += cell;
+        mRowData += "</v></c>";
+    }
+    else if (const std::optional<size_t> c_SharedStringIndex{_getSharedStringIndex(cell)}; c_SharedStringIndex.has_value())
+    {
+        mRowData += "<c t=\"s\"><v>";
+        mRowData += std::to_string(*c_SharedStringIndex);
+        mRowData += "</v></c>";
+    }
+    else
+    {
+        mRowData += "<c t=\"inlineStr\"><is>";
+        _appendText(mRowData, cell);
+        mRowData += "</is></c>";
+    }
+}
+
+/* No index is returned if the string is not (and cannot be) interned, in which case it gets written inline
+*/
+std::optional<size_t> Utilities::Core::XlsxWriter::_getSharedStringIndex(const std::string_view cell)
+{
+    std::optional<size_t> sharedStringIndex;
+
+    if (const auto c_It{mSharedStringIndexes.find(cell)}; mSharedStringIndexes.cend() != c_It)
+    {
+        sharedStringIndex = c_It->second;
+    }
+    else if (cell.size() <= scMaxSharedStringLength && mSharedStrings.size() < scMaxSharedStringsCount)
+    {
+        sharedStringIndex = mSharedStrings.size();
+        mSharedStrings.emplace_back(cell);
+        mSharedStringIndexes.emplace(mSharedStrings.back(), *sharedStringIndex);
+    }
+
+    if (sharedStringIndex.has_value())
+    {
+        ++mSharedStringReferencesCount;
+    }
+
+    return sharedStringIndex;
+}
+
+void Utilities::Core::XlsxWriter::_appendText(std::string& output, const std::string_view text)
+{
+    // leading or trailing spaces would be dropped by the spreadsheet application otherwise
+    const bool c_IsSpacePreserved{!text.empty() && (' ' == text.front() || ' ' == text.back())};
+
+    output += c_IsSpacePreserved ? "<t xml:space=\"preserve\">" : "<t>";
+    _appendEscapedText(output, text);
+    output += "</t>";
+}
+
+/* The control characters (other than tab and line feed) are not allowed in XML 1.0 so they are discarded
+*/
+void Utilities::Core::XlsxWriter::_appendEscapedText(std::string& output, const std::string_view text)
+{
+    for (const char c_Character : text)
+    {
+        switch (c_Character)
+        {
+        case '&':
+            output += "&amp;";
+            break;
+        case '<':
+            output += "&lt;";
+            break;
+        case '>':
+            output += "&gt;";
+            break;
+        case '"':
+            output += "&quot;";
+            break;
+        default:
+            if (static_cast<unsigned char>(c_Character) >= 0x20u || '\t' == c_Character || '\n' == c_Character)
+            {
+                output += c_Character;
+            }
+            break;
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef XLSXWRITER_H
+#define XLSXWRITER_H
+
+#include <deque>
+#include <optional>
+#include <vector>
+#include <unordered_map>
+
+#include "zipwriter.h"
+
+namespace Utilities::Core
+{
+    /* Streaming XLSX (spreadsheet) writer: the rows of a table are written one by one into a single worksheet of the zip container, no document model being kept in memory
+       Cells consisting of digits only are written as numbers, all other cells as text: short strings (e.g. column names, part numbers, device types) are interned once into a bounded shared strings table written after the worksheet
+       The other strings (e.g. labels and descriptions, which are unique per row) are written inline, so the memory use does not depend on the number of rows. Once an operation failed all following ones fail too
+    */
+    class XlsxWriter
+    {
+    public:
+        /* The parts describing the workbook are written right away, followed by the beginning of the worksheet
+        */
+        explicit XlsxWriter(const OutputStreamPtr pOutputStream);
+
+        XlsxWriter(const XlsxWriter&) = delete;
+        XlsxWriter& operator=(const XlsxWriter&) = delete;
+
+        /* Each field becomes a cell of the row
+        */
+        bool writeRow(const std::vector<std::string_view>& cells);
+
+        /* Ends the worksheet and writes the shared strings table, after which no rows can be added anymore
+        */
+        bool finish();
+
+    private:
+        void _appendCell(const std::string_view cell);
+        std::optional<size_t> _getSharedStringIndex(const std::string_view cell);
+
+        static void _appendText(std::string& output, const std::string_view text);
+        static void _appendEscapedText(std::string& output, const std::string_view text);
+
+        // all fixed parts (the workbook has a single sheet)
+        static constexpr std::string_view scContentTypes{
+            "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+            "<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">"
+            "<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>"
+            "<Default Extension=\"xml\" ContentType=\"application/xml\"/>"
+            "<Override PartName=\"/xl/workbook.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet.main+xml\"/>"
+            "<Override PartName=\"/xl/worksheets/sheet1.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml\"/>"
+            "<Override PartName=\"/xl/sharedStrings.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.sharedStrings+xml\"/>"
+            "</Types>"};
+
+        static constexpr std::string_view scPackageRelationships{
+            "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+            "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+            "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/officeDocument\" Target=\"xl/workbook.xml\"/>"
+            "</Relationships>"};
+
+        static constexpr std::string_view scWorkbook{
+            "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+            "<workbook xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\" xmlns:r=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships\">"
+            "<sheets><sheet name=\"Sheet1\" sheetId=\"1\" r:id=\"rId1\"/></sheets>"
+            "</workbook>"};
+
+        static constexpr std::string_view scWorkbookRelationships{
+            "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+            "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+            "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet\" Target=\"worksheets/sheet1.xml\"/>"
+            "<Relationship Id=\"rId2\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/sharedStrings\" Target=\"sharedStrings.xml\"/>"
+            "</Relationships>"};
+
+        static constexpr std::string_view scWorksheetBegin{
+            "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+            "<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\"><sheetData>"};
+
+        static constexpr std::string_view scWorksheetEnd{"</sheetData></worksheet>"};
+
+        // the shared strings table is passed to the zip writer in chunks of (at least) this size
+        static constexpr size_t scWriteChunkSize{64u * 1024u};
+
+        // numbers with more digits lose precision in spreadsheets so they are kept as strings
+        static constexpr size_t scMaxNumberDigitsCount{15u};
+
+        // bounds of the shared strings table, longer strings and new strings once the table is full being written inline
+        static constexpr size_t scMaxSharedStringsCount{256u};
+        static constexpr size_t scMaxSharedStringLength{32u};
+
+        ZipWriter mZipWriter;
+
+        // interned strings (the deque keeps them in place so the index can refer to them) and their indexes within the shared strings table
+        std::deque<std::string> mSharedStrings;
+        std::unordered_map<std::string_view, size_t> mSharedStringIndexes;
+        size_t mSharedStringReferencesCount;
+
+        std::string mRowData;                       // reused for each row
+        bool mIsFinished;
+        bool mIsFailed;
+    };
+}
+
+#endif // XLSXWRITER_H
@@ -0,0 +1,195 @@
+#include "zipwriter.h"
+
+Utilities::Core::ZipWriter::ZipWriter(const OutputStreamPtr pOutputStream)
+    : mpOutputStream{pOutputStream}
+    , mCompressionFormat{isCompressionFormatSupported(CompressionFormat::DEFLATE) ? CompressionFormat::DEFLATE : CompressionFormat::NONE}
+    , mWrittenCount{0u}
+    , mIsEntryOpen{false}
+    , mIsFinished{false}
+    , mIsFailed{!pOutputStream}
+{
+}
+
+/* The local header leaves the checksum and sizes empty, they are written by the data descriptor once the entry is finished
+*/
+bool Utilities::Core::ZipWriter::addEntry(const std::string_view name)
+{
+    bool success{_finishEntry() && !mIsFinished && name.size() <= UINT16_MAX && mEntries.size() < UINT16_MAX};
+
+    if (success)
+    {
+        mEntries.push_back(Entry_t{std::string{name}, 0u, 0u, 0u, mWrittenCount});
+
+        std::string localHeader;
+
+        _appendUint32(localHeader, scLocalHeaderSignature);
+        _appendUint16(localHeader, scVersion);
+        _appendUint16(localHeader, scDataDescriptorFlag);
+        _appendUint16(localHeader, CompressionFormat::DEFLATE == mCompressionFormat ? 8u : 0u);
+        _appendUint16(localHeader, scDosTime);
+        _appendUint16(localHeader, scDosDate);
+        _appendUint32(localHeader, 0u);     // checksum
+        _appendUint32(localHeader, 0u);     // compressed size
+        _appendUint32(localHeader, 0u);     // size
+        _appendUint16(localHeader, static_cast<std::uint16_t>(name.size()));
+        _appendUint16(localHeader, 0u);     // extra field length
+        localHeader.append(name);
+
+        mpCompressor = std::make_unique<Compressor>(mCompressionFormat);
+        mIsEntryOpen = true;
+
+        success = mpCompressor->isValid() && _writeToStream(localHeader);
+        mIsFailed = !success;
+    }
+
+    return success;
+}
+
+bool Utilities::Core::ZipWriter::write(const std::string_view data)
+{
+    bool success{_isValid() && mIsEntryOpen};
+
+    if (success)
+    {
+        Entry_t& currentEntry{mEntries.back()};
+
+        currentEntry.mCrc = getCrc32(data, currentEntry.mCrc);
+        currentEntry.mSize += data.size();
+        mPendingData.append(data);
+
+        if (mPendingData.size() >= scChunkSize)
+        {
+            success = _compressPendingData(false);
+        }
+    }
+
+    return success;
+}
+
+bool Utilities::Core::ZipWriter::finish()
+{
+    bool success{_finishEntry() && !mIsFinished};
+
+    if (success)
+    {
+        const std::uint64_t c_CentralDirOffset{mWrittenCount};
+        std::string centralDir;
+
+        for (const auto& c_Entry : mEntries)
+        {
+            _appendUint32(centralDir, scCentralHeaderSignature);
+            _appendUint16(centralDir, scVersion);  // made by (MS-DOS compatible attributes)
+            _appendUint16(centralDir, scVersion);  // needed for extracting
+            _appendUint16(centralDir, scDataDescriptorFlag);
+            _appendUint16(centralDir, CompressionFormat::DEFLATE == mCompressionFormat ? 8u : 0u);
+            _appendUint16(centralDir, scDosTime);
+            _appendUint16(centralDir, scDosDate);
+            _appendUint32(centralDir, c_Entry.mCrc);
+            _appendUint32(centralDir, static_cast<std::uint32_t>(c_Entry.mCompressedSize));
+            _appendUint32(centralDir, static_cast<std::uint32_t>(c_Entry.mSize));
+            _appendUint16(centralDir, static_cast<std::uint16_t>(c_Entry.mName.size()));
+            _appendUint16(centralDir, 0u);         // extra field length
+            _appendUint16(centralDir, 0u);         // comment length
+            _appendUint16(centralDir, 0u);         // disk number
+            _appendUint16(centralDir, 0u);         // internal attributes
+            _appendUint32(centralDir, 0u);         // external attributes
+            _appendUint32(centralDir, static_cast<std::uint32_t>(c_Entry.mOffset));
+            centralDir.append(c_Entry.mName);
+        }
+
+        std::string endOfCentralDir;
+
+        _appendUint32(endOfCentralDir, scEndOfCentralDirSignature);
+        _appendUint16(endOfCentralDir, 0u);        // disk number
+        _appendUint16(endOfCentralDir, 0u);        // disk containing the central directory
+        _appendUint16(endOfCentralDir, static_cast<std::uint16_t>(mEntries.size()));
+        _appendUint16(endOfCentralDir, static_cast<std::uint16_t>(mEntries.size()));
+        _appendUint32(endOfCentralDir, static_cast<std::uint32_t>(centralDir.size()));
+        _appendUint32(endOfCentralDir, static_cast<std::uint32_t>(c_CentralDirOffset));
+        _appendUint16(endOfCentralDir, 0u);        // comment length
+
+        // the central directory should end within the supported archive size too
+        success = _writeToStream(centralDir) && _writeToStream(endOfCentralDir) && mWrittenCount <= scMaxSize;
+        mIsFailed = !success;
+        mIsFinished = true;
+    }
+
+    return success;
+}
+
+/* Nothing to do (successfully) if no entry is being written
+*/
+bool Utilities::Core::ZipWriter::_finishEntry()
+{
+    bool success{_isValid()};
+
+    if (success && mIsEntryOpen)
+    {
+        success = _compressPendingData(true);
+
+        if (success)
+        {
+            const Entry_t& c_CurrentEntry{mEntries.back()};
+            std::string dataDescriptor;
+
+            _appendUint32(dataDescriptor, scDataDescriptorSignature);
+            _appendUint32(dataDescriptor, c_CurrentEntry.mCrc);
+            _appendUint32(dataDescriptor, static_cast<std::uint32_t>(c_CurrentEntry.mCompressedSize));
+            _appendUint32(dataDescriptor, static_cast<std::uint32_t>(c_CurrentEntry.mSize));
+
+            success = c_CurrentEntry.mSize <= scMaxSize && c_CurrentEntry.mCompressedSize <= scMaxSize && _writeToStream(dataDescriptor);
+        }
+
+        mpCompressor.reset();
+        mIsEntryOpen = false;
+        mIsFailed = !success;
+    }
+
+    return success;
+}
+
+bool Utilities::Core::ZipWriter::_compressPendingData(const bool isFinishRequired)
+{
+    mCompressedData.clear();
+
+    bool success{mpCompressor->compress(mPendingData, mCompressedData) && (!isFinishRequired || mpCompressor->finish(mCompressedData))};
+
+    mPendingData.clear();
+
+    if (success)
+    {
+        mEntries.back().mCompressedSize += mCompressedData.size();
+        success = _writeToStream(mCompressedData);
+    }
+
+    mIsFailed = !success;
+
+    return success;
+}
+
+bool Utilities::Core::ZipWriter::_writeToStream(const std::string_view data)
+{
+    mpOutputStream->write(data.data(), static_cast<std::streamsize>(data.size()));
+    mWrittenCount += data.size();
+
+    return !mpOutputStream->fail();
+}
+
+bool Utilities::Core::ZipWriter::_isValid() const
+{
+    return !mIsFailed && mpOutputStream && !mpOutputStream->fail();
+}
+
+/* The zip format is little endian
+*/
+void Utilities::Core::ZipWriter::_appendUint16(std::string& output, const std::uint16_t value)
+{
+    output.push_back(static_cast<char>(value & 0xFFu));
+    output.push_back(static_cast<char>((value >> 8) & 0xFFu));
+}
+
+void Utilities::Core::ZipWriter::_appendUint32(std::string& output, const std::uint32_t value)
+{
+    _appendUint16(output, static_cast<std::uint16_t>(value & 0xFFFFu));
+    _appendUint16(output, static_cast<std::uint16_t>((value >> 16) & 0xFFFFu));
+}
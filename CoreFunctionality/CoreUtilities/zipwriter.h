@@ -0,0 +1,78 @@
+#ifndef ZIPWRITER_H
+#define ZIPWRITER_H
+
+#include <vector>
+
+#include "coreutils.h"
+#include "compression.h"
+
+namespace Utilities::Core
+{
+    /* Streaming zip archive writer: the entries are written one after the other directly to the output stream (no seeking back), the checksum and sizes of each entry following its data
+       The entries are deflated if zlib is available, otherwise stored. All entries get the same fixed modification time so the same content always results in the same archive
+       Archives of up to 4 GB are supported (no zip64 extensions). Once an operation failed (e.g. the stream could not be written) all following ones fail too
+    */
+    class ZipWriter
+    {
+    public:
+        explicit ZipWriter(const OutputStreamPtr pOutputStream);
+
+        ZipWriter(const ZipWriter&) = delete;
+        ZipWriter& operator=(const ZipWriter&) = delete;
+
+        /* Finishes the current entry (if any) and starts the next one (the name is the path within the archive, e.g. xl/workbook.xml)
+        */
+        bool addEntry(const std::string_view name);
+
+        /* Appends the data to the current entry (the data is collected and compressed in chunks)
+        */
+        bool write(const std::string_view data);
+
+        /* Finishes the last entry and writes the central directory, after which nothing can be added anymore
+        */
+        bool finish();
+
+    private:
+        struct Entry_t
+        {
+            std::string mName;
+            std::uint32_t mCrc;
+            std::uint64_t mCompressedSize;
+            std::uint64_t mSize;
+            std::uint64_t mOffset;          // of the local header
+        };
+
+        bool _finishEntry();
+        bool _compressPendingData(const bool isFinishRequired);
+        bool _writeToStream(const std::string_view data);
+        bool _isValid() const;
+
+        static void _appendUint16(std::string& output, const std::uint16_t value);
+        static void _appendUint32(std::string& output, const std::uint32_t value);
+
+        static constexpr std::uint32_t scLocalHeaderSignature{0x04034b50u};
+        static constexpr std::uint32_t scDataDescriptorSignature{0x08074b50u};
+        static constexpr std::uint32_t scCentralHeaderSignature{0x02014b50u};
+        static constexpr std::uint32_t scEndOfCentralDirSignature{0x06054b50u};
+        static constexpr std::uint16_t scVersion{20u};                  // 2.0: deflate, directories
+        static constexpr std::uint16_t scDataDescriptorFlag{0x0008u};   // checksum and sizes follow the data
+        static constexpr std::uint16_t scDosTime{0u};                   // 00:00:00
+        static constexpr std::uint16_t scDosDate{(1u << 5) | 1u};       // 1980-01-01 (earliest DOS date)
+        static constexpr std::uint64_t scMaxSize{0xFFFFFFFFu};
+        static constexpr size_t scChunkSize{256u * 1024u};
+
+        const OutputStreamPtr mpOutputStream;
+        const CompressionFormat mCompressionFormat;
+        std::unique_ptr<Compressor> mpCompressor;   // only exists while an entry is being written
+
+        std::vector<Entry_t> mEntries;
+        std::string mPendingData;                   // data of the current entry not compressed yet
+        std::string mCompressedData;
+        std::uint64_t mWrittenCount;
+        bool mIsEntryOpen;
+        bool mIsFinished;
+        bool mIsFailed;
+    };
+}
+
+#endif // ZIPWRITER_H
@@ -0,0 +1,94 @@
+#include "deviceportutils.h"
+#include "catalogdeviceport.h"
+
+namespace Ports = Utilities::DevicePorts;
+
+CatalogDevicePort::CatalogDevicePort(const DeviceCatalog::DeviceTypeInfo_t& deviceTypeInfo, const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice)
+    : DevicePort{deviceUPosition,
+                 fileRowNumber,
+                 isSourceDevice}
+    , mDeviceTypeInfo{deviceTypeInfo}
+{
+}
+
+// the port type should be one of the types of the device, all other parameters should be numeric (the first invalid parameter in input order is reported)
+void CatalogDevicePort::_updateDescriptionAndLabel()
+{
+    const Data::DevicePortSchema_t& c_Schema{mDeviceTypeInfo.mSchema};
+    bool isValid{true};
+
+    for (size_t parameterIndex{0u}; isValid && parameterIndex < c_Schema.mParametersCount; ++parameterIndex)
+    {
+        const Data::PortParameterID c_ParameterID{c_Schema.mParameters[parameterIndex]};
+        std::string& parameter{mParameters[parameterIndex]};
+
+        if (Data::PortParameterID::PORT_TYPE == c_ParameterID)
+        {
+            Core::convertStringCase(parameter, true);
+
+            if (auto portTypeIt{mDeviceTypeInfo.mPortTypes.find(parameter)}; mDeviceTypeInfo.mPortTypes.cend() != portTypeIt)
+            {
+                _setLabelFormatValue(Data::LabelFormatVariable::PORT_TYPE_DESCRIPTION, portTypeIt->second.first);
+                _setLabelFormatValue(Data::LabelFormatVariable::PORT_TYPE_LABEL, portTypeIt->second.second);
+            }
+            else
+            {
+                isValid = false;
+            }
+        }
+        else if (const DeviceCatalog::ParameterInfo_t* const c_pParameterInfo{DeviceCatalog::getParameterInfo(c_ParameterID)}; c_pParameterInfo)
+        {
+            if (Core::isDigitString(parameter))
+            {
+                _setLabelFormatValue(c_pParameterInfo->mVariable, parameter);
+            }
+            else
+            {
+                isValid = false;
+            }
+        }
+        else
+        {
+            isValid = false;
+            ASSERT(false, "Parameter not supported by catalog device port");
+        }
+
+        if (!isValid)
+        {
+            _setInvalidDescriptionAndLabel(Ports::c_InvalidPortParameterErrorTexts[static_cast<size_t>(c_ParameterID)]);
+        }
+    }
+
+    if (isValid)
+    {
+        _applyLabelFormat(mDeviceTypeInfo.mDescriptionFormat, mDeviceTypeInfo.mLabelFormat);
+    }
+
+    _checkLabel();
+}
+
+std::string* CatalogDevicePort::_getRequiredParameter(const Data::PortParameterID parameterID)
+{
+    std::string* pRequiredParameter{nullptr};
+
+    for (size_t parameterIndex{0u}; parameterIndex < mDeviceTypeInfo.mSchema.mParametersCount; ++parameterIndex)
+    {
+        if (parameterID == mDeviceTypeInfo.mSchema.mParameters[parameterIndex])
+        {
+            pRequiredParameter = &mParameters[parameterIndex];
+            break;
+        }
+    }
+
+    return pRequiredParameter;
+}
+
+const Data::DevicePortSchema_t& CatalogDevicePort::_getSchema() const
+{
+    return mDeviceTypeInfo.mSchema;
+}
+
+std::pair<std::string, std::string> CatalogDevicePort::_getDeviceTypeDescriptionAndLabel() const
+{
+    return {mDeviceTypeInfo.mDescription, mDeviceTypeInfo.mLabel};
+}
@@ -0,0 +1,30 @@
+#ifndef CATALOGDEVICEPORT_H
+#define CATALOGDEVICEPORT_H
+
+#include <array>
+
+#include "deviceport.h"
+#include "devicecatalog.h"
+
+// Generic (table driven) ports of the device types defined within the device catalog file
+class CatalogDevicePort final : public DevicePort
+{
+public:
+    CatalogDevicePort() = delete;
+    CatalogDevicePort(const DeviceCatalog::DeviceTypeInfo_t& deviceTypeInfo, const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
+
+protected:
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
+    virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
+
+private:
+    // catalog entry of the device type (owned by the device catalog)
+    const DeviceCatalog::DeviceTypeInfo_t& mDeviceTypeInfo;
+
+    // input parameters, in the order defined by the catalog entry schema
+    std::array<std::string, Data::c_MaxPortInputParametersCount> mParameters;
+};
+
+#endif // CATALOGDEVICEPORT_H
@@ -14,10 +14,23 @@ SwitchPort::SwitchPort(const std::string_view deviceUPosition, const Data::Devic
     // required parameters to be registered in the derived classes to make their ordering in the input csv file more flexible
 }
 
-void SwitchPort::_registerRequiredParameters()
+std::string* SwitchPort::_getRequiredParameter(const Data::PortParameterID parameterID)
 {
-    _registerRequiredParameter(&mPortType);
-    _registerRequiredParameter(&mPortNumber);
+    std::string* pRequiredParameter{nullptr};
+
+    switch(parameterID)
+    {
+    case Data::PortParameterID::PORT_TYPE:
+        pRequiredParameter = &mPortType;
+        break;
+    case Data::PortParameterID::PORT_NUMBER:
+        pRequiredParameter = &mPortNumber;
+        break;
+    default:
+        break;
+    }
+
+    return pRequiredParameter;
 }
 
 std::string SwitchPort::_getPortType() const
@@ -25,9 +38,10 @@ std::string SwitchPort::_getPortType() const
     return mPortType;
 }
 
-void SwitchPort::updateDescriptionAndLabel()
+void SwitchPort::_updateDescriptionAndLabel()
 {
     Core::convertStringCase(mPortType, true);
+    _setLabelFormatValue(Data::LabelFormatVariable::PORT_NUMBER, mPortNumber);
 
     if (mAllowedDataPortTypes.cend() != mAllowedDataPortTypes.find(mPortType) || Ports::isPowerPortType(mPortType))
     {
@@ -39,8 +53,7 @@ void SwitchPort::updateDescriptionAndLabel()
         {
             if (Ports::isManagementPortNumber(mPortNumber)) // management port
             {
-                _appendDataToDescription(" - management port");
-                _appendDataToLabel("_MGMT");
+                _applyLabelFormat(Data::LabelFormatID::SWITCH_MANAGEMENT_PORT);
             }
             else
             {
@@ -66,18 +79,14 @@ void SwitchPort::_handleNumberedPortType()
     {
         if (auto dataPortTypeIt{mAllowedDataPortTypes.find(mPortType)}; mAllowedDataPortTypes.cend() != dataPortTypeIt)
         {
-            const std::string c_DataPortTypeDescription{dataPortTypeIt->second.first};
-            const std::string c_DataPortTypeLabel{dataPortTypeIt->second.second};
-            const std::string c_TrailingSpace{c_DataPortTypeDescription.size() > 0 ? " " : ""};
-            const std::string c_PrecedingUnderscore{c_DataPortTypeLabel.size() > 0 ? "_" : ""};
-
-            _appendDataToDescription(" - " + c_DataPortTypeDescription + c_TrailingSpace + "port " + mPortNumber);
-            _appendDataToLabel(c_PrecedingUnderscore + c_DataPortTypeLabel + "_P" + mPortNumber);
+            // data port type description and/or label might be empty (the label format takes care of the required separators)
+            _setLabelFormatValue(Data::LabelFormatVariable::PORT_TYPE_DESCRIPTION, dataPortTypeIt->second.first);
+            _setLabelFormatValue(Data::LabelFormatVariable::PORT_TYPE_LABEL, dataPortTypeIt->second.second);
+            _applyLabelFormat(Data::LabelFormatID::SWITCH_DATA_PORT);
         }
         else if (Ports::isPowerPortType(mPortType))
         {
-            _appendDataToDescription(" - power supply " + mPortNumber);
-            _appendDataToLabel("_PS" + mPortNumber);
+            _applyLabelFormat(Data::LabelFormatID::SWITCH_POWER_SUPPLY);
         }
         else
         {
@@ -99,7 +108,7 @@ DirectorPort::DirectorPort(const std::string_view deviceUPosition, const Data::A
 {
 }
 
-void DirectorPort::updateDescriptionAndLabel()
+void DirectorPort::_updateDescriptionAndLabel()
 {
     const std::string c_PortType{_getPortType()};
     const bool c_IsDataPortType{!Ports::isPowerPortType(c_PortType) && "-" != c_PortType};
@@ -108,9 +117,8 @@ void DirectorPort::updateDescriptionAndLabel()
     {
         if (c_IsDataPortType)
         {
-            _appendDataToDescription(" - blade " + mBladeNumber);
-            _appendDataToLabel("_B" + mBladeNumber);
-            SwitchPort::updateDescriptionAndLabel();
+            _setLabelFormatValue(Data::LabelFormatVariable::BLADE_NUMBER, mBladeNumber);
+            SwitchPort::_updateDescriptionAndLabel();
         }
         else
         {
@@ -121,7 +129,7 @@ void DirectorPort::updateDescriptionAndLabel()
     {
         if (!c_IsDataPortType)
         {
-            SwitchPort::updateDescriptionAndLabel();
+            SwitchPort::_updateDescriptionAndLabel();
         }
         else
         {
@@ -134,10 +142,21 @@ void DirectorPort::updateDescriptionAndLabel()
     }
 }
 
-void DirectorPort::_registerRequiredParameters()
+std::string* DirectorPort::_getRequiredParameter(const Data::PortParameterID parameterID)
 {
-    _registerRequiredParameter(&mBladeNumber);
-    SwitchPort::_registerRequiredParameters();
+    std::string* pRequiredParameter{nullptr};
+
+    switch(parameterID)
+    {
+    case Data::PortParameterID::BLADE_NUMBER:
+        pRequiredParameter = &mBladeNumber;
+        break;
+    default:
+        pRequiredParameter = SwitchPort::_getRequiredParameter(parameterID);
+        break;
+    }
+
+    return pRequiredParameter;
 }
 
 LANSwitchPort::LANSwitchPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice)
@@ -148,9 +167,9 @@ LANSwitchPort::LANSwitchPort(const std::string_view deviceUPosition, const size_
 {
 }
 
-size_t LANSwitchPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& LANSwitchPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::LAN_SWITCH);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::LAN_SWITCH);
 }
 
 std::pair<std::string, std::string> LANSwitchPort::_getDeviceTypeDescriptionAndLabel() const
@@ -166,9 +185,9 @@ LANDirectorPort::LANDirectorPort(const std::string_view deviceUPosition, const s
 {
 }
 
-size_t LANDirectorPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& LANDirectorPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::LAN_DIRECTOR);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::LAN_DIRECTOR);
 }
 
 std::pair<std::string, std::string> LANDirectorPort::_getDeviceTypeDescriptionAndLabel() const
@@ -184,9 +203,9 @@ SANSwitchPort::SANSwitchPort(const std::string_view deviceUPosition, const size_
 {
 }
 
-size_t SANSwitchPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& SANSwitchPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::SAN_SWITCH);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::SAN_SWITCH);
 }
 
 std::pair<std::string, std::string> SANSwitchPort::_getDeviceTypeDescriptionAndLabel() const
@@ -202,9 +221,9 @@ SANDirectorPort::SANDirectorPort(const std::string_view deviceUPosition, const s
 {
 }
 
-size_t SANDirectorPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& SANDirectorPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::SAN_DIRECTOR);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::SAN_DIRECTOR);
 }
 
 std::pair<std::string, std::string> SANDirectorPort::_getDeviceTypeDescriptionAndLabel() const
@@ -220,9 +239,9 @@ InfinibandSwitchPort::InfinibandSwitchPort(const std::string_view deviceUPositio
 {
 }
 
-size_t InfinibandSwitchPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& InfinibandSwitchPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::INFINIBAND_SWITCH);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::INFINIBAND_SWITCH);
 }
 
 std::pair<std::string, std::string> InfinibandSwitchPort::_getDeviceTypeDescriptionAndLabel() const
@@ -238,9 +257,9 @@ KVMSwitchPort::KVMSwitchPort(const std::string_view deviceUPosition, const size_
 {
 }
 
-size_t KVMSwitchPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& KVMSwitchPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::KVM_SWITCH);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::KVM_SWITCH);
 }
 
 std::pair<std::string, std::string> KVMSwitchPort::_getDeviceTypeDescriptionAndLabel() const
@@ -255,9 +274,10 @@ ServerPort::ServerPort(const std::string_view deviceUPosition, const size_t file
 {
 }
 
-void ServerPort::updateDescriptionAndLabel()
+void ServerPort::_updateDescriptionAndLabel()
 {
     Core::convertStringCase(mPortType, true);
+    _setLabelFormatValue(Data::LabelFormatVariable::PORT_NUMBER, mPortNumber);
 
     if (Data::c_ServerDataPortTypes.find(mPortType) != Data::c_ServerDataPortTypes.cend() || Ports::isPowerPortType(mPortType))
     {
@@ -265,15 +285,13 @@ void ServerPort::updateDescriptionAndLabel()
     }
     else if ("K" == mPortType) // KVM port
     {
-        _appendDataToDescription(" - KVM port");
-        _appendDataToLabel("_KVM");
+        _applyLabelFormat(Data::LabelFormatID::SERVER_KVM_PORT);
     }
     else if ("-" == mPortType)
     {
         if(Ports::isManagementPortNumber(mPortNumber)) // management port
         {
-            _appendDataToDescription(" - management port");
-            _appendDataToLabel("_MGMT");
+            _applyLabelFormat(Data::LabelFormatID::SERVER_MANAGEMENT_PORT);
         }
         else
         {
@@ -288,15 +306,28 @@ void ServerPort::updateDescriptionAndLabel()
     _checkLabel();
 }
 
-void ServerPort::_registerRequiredParameters()
+std::string* ServerPort::_getRequiredParameter(const Data::PortParameterID parameterID)
 {
-    _registerRequiredParameter(&mPortType);
-    _registerRequiredParameter(&mPortNumber);
+    std::string* pRequiredParameter{nullptr};
+
+    switch(parameterID)
+    {
+    case Data::PortParameterID::PORT_TYPE:
+        pRequiredParameter = &mPortType;
+        break;
+    case Data::PortParameterID::PORT_NUMBER:
+        pRequiredParameter = &mPortNumber;
+        break;
+    default:
+        break;
+    }
+
+    return pRequiredParameter;
 }
 
-size_t ServerPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& ServerPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::RACK_SERVER);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::RACK_SERVER);
 }
 
 std::pair<std::string, std::string> ServerPort::_getDeviceTypeDescriptionAndLabel() const
@@ -310,13 +341,14 @@ void ServerPort::_handleNumberedPortType()
     {
         if (auto dataPortTypeIt{Data::c_ServerDataPortTypes.find(mPortType)}; Data::c_ServerDataPortTypes.cend() != dataPortTypeIt)
         {
-            const std::string c_DataPortTypeDescription{dataPortTypeIt->second.first};
-            const std::string c_DataPortTypeLabel{dataPortTypeIt->second.second};
+            const std::string& c_DataPortTypeDescription{dataPortTypeIt->second.first};
+            const std::string& c_DataPortTypeLabel{dataPortTypeIt->second.second};
 
             if (c_DataPortTypeDescription.size() > 0 && c_DataPortTypeLabel.size() > 0)
             {
-                _appendDataToDescription(" - " + c_DataPortTypeDescription + " port " + mPortNumber);
-                _appendDataToLabel("_" + c_DataPortTypeLabel + "_P" + mPortNumber);
+                _setLabelFormatValue(Data::LabelFormatVariable::PORT_TYPE_DESCRIPTION, c_DataPortTypeDescription);
+                _setLabelFormatValue(Data::LabelFormatVariable::PORT_TYPE_LABEL, c_DataPortTypeLabel);
+                _applyLabelFormat(Data::LabelFormatID::SERVER_DATA_PORT);
             }
             else
             {
@@ -326,8 +358,7 @@ void ServerPort::_handleNumberedPortType()
         }
         else if (Ports::isPowerPortType(mPortType))
         {
-            _appendDataToDescription(" - power supply " + mPortNumber);
-            _appendDataToLabel("_PS" + mPortNumber);
+            _applyLabelFormat(Data::LabelFormatID::SERVER_POWER_SUPPLY);
         }
         else
         {
@@ -348,14 +379,12 @@ ScalableServerPort::ScalableServerPort(const std::string_view deviceUPosition, c
 {
 }
 
-void ScalableServerPort::updateDescriptionAndLabel()
+void ScalableServerPort::_updateDescriptionAndLabel()
 {
     if (Core::isDigitString(mSlotNumber))
     {
-        _appendDataToDescription(" - slot " + mSlotNumber);
-        _appendDataToLabel("_S" + mSlotNumber);
-
-        ServerPort::updateDescriptionAndLabel();
+        _setLabelFormatValue(Data::LabelFormatVariable::SLOT_NUMBER, mSlotNumber);
+        ServerPort::_updateDescriptionAndLabel();
     }
     else
     {
@@ -363,17 +392,26 @@ void ScalableServerPort::updateDescriptionAndLabel()
     }
 }
 
-void ScalableServerPort::_registerRequiredParameters()
+std::string* ScalableServerPort::_getRequiredParameter(const Data::PortParameterID parameterID)
 {
-    // slot number comes in addition to the input params of the Server class (and precedes them in the csv input file)
-    _registerRequiredParameter(&mSlotNumber);
+    std::string* pRequiredParameter{nullptr};
+
+    switch(parameterID)
+    {
+    case Data::PortParameterID::SLOT_NUMBER:
+        pRequiredParameter = &mSlotNumber;
+        break;
+    default:
+        pRequiredParameter = ServerPort::_getRequiredParameter(parameterID);
+        break;
+    }
 
-    ServerPort::_registerRequiredParameters();
+    return pRequiredParameter;
 }
 
-size_t ScalableServerPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& ScalableServerPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::SCALABLE_SERVER);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::SCALABLE_SERVER);
 }
 
 std::pair<std::string, std::string> ScalableServerPort::_getDeviceTypeDescriptionAndLabel() const
@@ -388,23 +426,21 @@ StoragePort::StoragePort(const std::string_view deviceUPosition, const size_t fi
 {
 }
 
-void StoragePort::updateDescriptionAndLabel()
+void StoragePort::_updateDescriptionAndLabel()
 {
     Core::convertStringCase(mPortType, true);
+    _setLabelFormatValue(Data::LabelFormatVariable::CONTROLLER_NUMBER, mControllerNr);
+    _setLabelFormatValue(Data::LabelFormatVariable::PORT_NUMBER, mPortNumber);
 
     if (Core::isDigitString(mControllerNr))
     {
         if ("D" == mPortType) // data port (e.g. FC)
         {
-            _appendDataToDescription(" - controller " + mControllerNr + " - port ");
-            _appendDataToLabel("_C" + mControllerNr + "_P");
-            _handleNumberedPortType();
+            _handleNumberedPortType(Data::LabelFormatID::STORAGE_DATA_PORT);
         }
         else if ("-" == mPortType)
         {
-            _appendDataToDescription(" - controller " + mControllerNr);
-            _appendDataToLabel("_C" + mControllerNr);
-            _handleManagementPort(); // one management port per controller
+            _handleManagementPort(Data::LabelFormatID::STORAGE_CONTROLLER_MANAGEMENT_PORT); // one management port per controller
         }
         else
         {
@@ -415,7 +451,7 @@ void StoragePort::updateDescriptionAndLabel()
     {
         if ("-" == mPortType)
         {
-            _handleManagementPort(); // unified management port
+            _handleManagementPort(Data::LabelFormatID::STORAGE_MANAGEMENT_PORT); // unified management port
         }
         else
         {
@@ -426,9 +462,7 @@ void StoragePort::updateDescriptionAndLabel()
     {
         if (Ports::isPowerPortType(mPortType)) // power supply
         {
-            _appendDataToDescription(" - power supply ");
-            _appendDataToLabel("_PS");
-            _handleNumberedPortType();
+            _handleNumberedPortType(Data::LabelFormatID::STORAGE_POWER_SUPPLY);
         }
         else
         {
@@ -443,16 +477,31 @@ void StoragePort::updateDescriptionAndLabel()
     _checkLabel();
 }
 
-void StoragePort::_registerRequiredParameters()
+std::string* StoragePort::_getRequiredParameter(const Data::PortParameterID parameterID)
 {
-    _registerRequiredParameter(&mControllerNr);
-    _registerRequiredParameter(&mPortType);
-    _registerRequiredParameter(&mPortNumber);
+    std::string* pRequiredParameter{nullptr};
+
+    switch(parameterID)
+    {
+    case Data::PortParameterID::CONTROLLER_NUMBER:
+        pRequiredParameter = &mControllerNr;
+        break;
+    case Data::PortParameterID::PORT_TYPE:
+        pRequiredParameter = &mPortType;
+        break;
+    case Data::PortParameterID::PORT_NUMBER:
+        pRequiredParameter = &mPortNumber;
+        break;
+    default:
+        break;
+    }
+
+    return pRequiredParameter;
 }
 
-size_t StoragePort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& StoragePort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::STORAGE);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::STORAGE);
 }
 
 std::pair<std::string, std::string> StoragePort::_getDeviceTypeDescriptionAndLabel() const
@@ -460,12 +509,11 @@ std::pair<std::string, std::string> StoragePort::_getDeviceTypeDescriptionAndLab
     return Data::c_DeviceTypeDescriptionsAndLabels.at(Data::DeviceTypeID::STORAGE);
 }
 
-void StoragePort::_handleNumberedPortType()
+void StoragePort::_handleNumberedPortType(const Data::LabelFormatID formatID)
 {
     if (Core::isDigitString(mPortNumber))
     {
-        _appendDataToDescription(mPortNumber);
-        _appendDataToLabel(mPortNumber);
+        _applyLabelFormat(formatID);
     }
     else
     {
@@ -473,12 +521,11 @@ void StoragePort::_handleNumberedPortType()
     }
 }
 
-void StoragePort::_handleManagementPort()
+void StoragePort::_handleManagementPort(const Data::LabelFormatID formatID)
 {
     if (Ports::isManagementPortNumber(mPortNumber))
     {
-        _appendDataToDescription(" - management port");
-        _appendDataToLabel("_MGMT");
+        _applyLabelFormat(formatID);
     }
     else
     {
@@ -498,9 +545,11 @@ BladeServerPort::BladeServerPort(const std::string_view deviceUPosition, const s
 {
 }
 
-void BladeServerPort::updateDescriptionAndLabel()
+void BladeServerPort::_updateDescriptionAndLabel()
 {
     Core::convertStringCase(mModuleType, true);
+    _setLabelFormatValue(Data::LabelFormatVariable::MODULE_NUMBER, mModuleNumber);
+    _setLabelFormatValue(Data::LabelFormatVariable::PORT_NUMBER, mPortNumber);
 
     if ("DM" == mModuleType || "MG" == mModuleType || "P" == mModuleType)
     {
@@ -508,13 +557,11 @@ void BladeServerPort::updateDescriptionAndLabel()
     }
     else if ("UP" == mModuleType) // management uplink port (for daisy chaining multiple blade systems)
     {
-        _appendDataToDescription(" - management uplink port");
-        _appendDataToLabel("_MG_UP");
+        _applyLabelFormat(Data::LabelFormatID::BLADE_MANAGEMENT_UPLINK_PORT);
     }
     else if ("DO" == mModuleType) // management downlink port (for daisy chaining multiple blade systems)
     {
-        _appendDataToDescription(" - management downlink port");
-        _appendDataToLabel("_MG_DO");
+        _applyLabelFormat(Data::LabelFormatID::BLADE_MANAGEMENT_DOWNLINK_PORT);
     }
     else
     {
@@ -524,16 +571,31 @@ void BladeServerPort::updateDescriptionAndLabel()
     _checkLabel();
 }
 
-void BladeServerPort::_registerRequiredParameters()
+std::string* BladeServerPort::_getRequiredParameter(const Data::PortParameterID parameterID)
 {
-    _registerRequiredParameter(&mModuleType);
-    _registerRequiredParameter(&mModuleNumber);
-    _registerRequiredParameter(&mPortNumber);
+    std::string* pRequiredParameter{nullptr};
+
+    switch(parameterID)
+    {
+    case Data::PortParameterID::MODULE_TYPE:
+        pRequiredParameter = &mModuleType;
+        break;
+    case Data::PortParameterID::MODULE_NUMBER:
+        pRequiredParameter = &mModuleNumber;
+        break;
+    case Data::PortParameterID::PORT_NUMBER:
+        pRequiredParameter = &mPortNumber;
+        break;
+    default:
+        break;
+    }
+
+    return pRequiredParameter;
 }
 
-size_t BladeServerPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& BladeServerPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::BLADE_SERVER);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::BLADE_SERVER);
 }
 
 std::pair<std::string, std::string> BladeServerPort::_getDeviceTypeDescriptionAndLabel() const
@@ -549,8 +611,7 @@ void BladeServerPort::_handleNumberedModuleType()
         {
             if (Core::isDigitString(mPortNumber))
             {
-                _appendDataToDescription(" - data module " + mModuleNumber + " - port " + mPortNumber);
-                _appendDataToLabel("_DMO" + mModuleNumber + "_P" + mPortNumber);
+                _applyLabelFormat(Data::LabelFormatID::BLADE_DATA_MODULE_PORT);
             }
             else
             {
@@ -559,13 +620,11 @@ void BladeServerPort::_handleNumberedModuleType()
         }
         else if ("MG" == mModuleType) // management module
         {
-            _appendDataToDescription(" - management module " + mModuleNumber);
-            _appendDataToLabel("_MGMT" + mModuleNumber);
+            _applyLabelFormat(Data::LabelFormatID::BLADE_MANAGEMENT_MODULE);
         }
         else if ("P" == mModuleType) // power supply
         {
-            _appendDataToDescription(" - power supply " + mModuleNumber);
-            _appendDataToLabel("_PS" + mModuleNumber);
+            _applyLabelFormat(Data::LabelFormatID::BLADE_POWER_SUPPLY);
         }
         else
         {
@@ -10,13 +10,12 @@ class SwitchPort : public DevicePort
 public:
     SwitchPort() = delete;
 
-    virtual void updateDescriptionAndLabel() override;
-
 protected:
     // constructor needs to be protected as this class is a switch abstraction (derived classes are the concrete switches for which labels are being created)
     SwitchPort(const std::string_view deviceUPosition, const Data::DevicePortTypesInfo_t& switchPortTypesInfo, const size_t fileRowNumber, const bool isSourceDevice);
 
-    virtual void _registerRequiredParameters() override;
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
     std::string _getPortType() const;
 
 private:
@@ -35,13 +34,12 @@ class DirectorPort : public SwitchPort
 public:
     DirectorPort() = delete;
 
-    virtual void updateDescriptionAndLabel() override;
-
 protected:
     // constructor needs to be protected as this class is a director abstraction (derived classes are the concrete directors for which labels are being created)
     DirectorPort(const std::string_view deviceUPosition, const Data::AllowedDataPortTypes_t& directorDataPortTypesInfo, const size_t fileRowNumber, const bool isSourceDevice);
 
-    virtual void _registerRequiredParameters() override;
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
 
 private:
     std::string mBladeNumber;
@@ -55,7 +53,7 @@ public:
     LANSwitchPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
 protected:
-    virtual size_t _getInputParametersCount() const override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 };
 
@@ -67,7 +65,7 @@ public:
     LANDirectorPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
 protected:
-    virtual size_t _getInputParametersCount() const override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 };
 
@@ -79,7 +77,7 @@ public:
     SANSwitchPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
 protected:
-    virtual size_t _getInputParametersCount() const override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 };
 
@@ -91,7 +89,7 @@ public:
     SANDirectorPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
 protected:
-    virtual size_t _getInputParametersCount() const override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 };
 
@@ -103,7 +101,7 @@ public:
     InfinibandSwitchPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
 protected:
-    virtual size_t _getInputParametersCount() const override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 };
 
@@ -115,7 +113,7 @@ public:
     KVMSwitchPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
 protected:
-    virtual size_t _getInputParametersCount() const override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 };
 
@@ -126,11 +124,10 @@ public:
     ServerPort() = delete;
     ServerPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
-    virtual void updateDescriptionAndLabel() override;
-
 protected:
-    virtual void _registerRequiredParameters() override;
-    virtual size_t _getInputParametersCount() const override;
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
     void _handleNumberedPortType();
 
@@ -146,11 +143,10 @@ public:
     ScalableServerPort() = delete;
     ScalableServerPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
-    virtual void updateDescriptionAndLabel() override;
-
 protected:
-    virtual void _registerRequiredParameters() override;
-    virtual size_t _getInputParametersCount() const override;
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 
     std::string mSlotNumber;
@@ -163,15 +159,14 @@ public:
     StoragePort() = delete;
     StoragePort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
-    virtual void updateDescriptionAndLabel() override;
-
 protected:
-    virtual void _registerRequiredParameters() override;
-    virtual size_t _getInputParametersCount() const override;
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 
-    void _handleNumberedPortType();
-    void _handleManagementPort();
+    void _handleNumberedPortType(const Data::LabelFormatID formatID);
+    void _handleManagementPort(const Data::LabelFormatID formatID);
 
 private:
     std::string mControllerNr; // can be the controller number (for FC storage) or IO module number (for JBODs)
@@ -186,11 +181,10 @@ public:
     BladeServerPort() = delete;
     BladeServerPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
-    virtual void updateDescriptionAndLabel() override;
-
 protected:
-    virtual void _registerRequiredParameters() override;
-    virtual size_t _getInputParametersCount() const override;
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
     void _handleNumberedModuleType();
 
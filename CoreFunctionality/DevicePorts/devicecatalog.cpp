@@ -0,0 +1,277 @@
+#include <algorithm>
+#include <cstdio>
+
+#include "appsettings.h"
+#include "deviceportdata.h"
+#include "devicecatalog.h"
+
+DeviceCatalog::DeviceCatalog(const Core::Path_t& deviceCatalogFile)
+    : mContentHash{0u}
+    , mFormatVariableNames{Data::c_LabelFormatVariableNames.cbegin(), Data::c_LabelFormatVariableNames.cend()}
+{
+    const bool c_AreDefaultFormatsValid{mDefaultDescriptionFormat.compile(scDefaultDescriptionFormat, mFormatVariableNames) &&
+                                        mDefaultLabelFormat.compile(scDefaultLabelFormat, mFormatVariableNames)};
+
+    ASSERT(c_AreDefaultFormatsValid, "Invalid default device catalog format");
+
+    _init(deviceCatalogFile);
+}
+
+std::shared_ptr<DeviceCatalog> DeviceCatalog::getInstance()
+{
+    if (!s_pDeviceCatalog)
+    {
+        s_pDeviceCatalog = std::make_shared<DeviceCatalog>(AppSettings::getInstance()->getDeviceCatalogFile());
+    }
+
+    return s_pDeviceCatalog;
+}
+
+Data::DeviceTypeID DeviceCatalog::getDeviceTypeID(const std::string_view keyword) const
+{
+    Data::DeviceTypeID deviceTypeID{Data::DeviceTypeID::UNKNOWN_DEVICE};
+
+    if (const auto c_KeywordIt{std::lower_bound(mKeywordIndex.cbegin(),
+                                                mKeywordIndex.cend(),
+                                                keyword,
+                                                [](const std::pair<std::string_view, size_t>& element, const std::string_view value) {return element.first < value;})};
+        mKeywordIndex.cend() != c_KeywordIt && keyword == c_KeywordIt->first)
+    {
+        deviceTypeID = static_cast<Data::DeviceTypeID>(static_cast<int>(Data::DeviceTypeID::FIRST_CATALOG_DEVICE) + static_cast<int>(c_KeywordIt->second));
+    }
+
+    return deviceTypeID;
+}
+
+const DeviceCatalog::DeviceTypeInfo_t* DeviceCatalog::getDeviceTypeInfo(const Data::DeviceTypeID deviceTypeID) const
+{
+    const DeviceTypeInfo_t* pDeviceTypeInfo{nullptr};
+
+    if (const int c_DeviceTypeIndex{static_cast<int>(deviceTypeID) - static_cast<int>(Data::DeviceTypeID::FIRST_CATALOG_DEVICE)};
+        c_DeviceTypeIndex >= 0 && static_cast<size_t>(c_DeviceTypeIndex) < mDeviceTypes.size())
+    {
+        pDeviceTypeInfo = &mDeviceTypes[static_cast<size_t>(c_DeviceTypeIndex)];
+    }
+
+    return pDeviceTypeInfo;
+}
+
+const DeviceCatalog::ParameterInfo_t* DeviceCatalog::getParameterInfo(const Data::PortParameterID parameterID)
+{
+    const auto c_ParameterIt{std::find_if(scParameters.cbegin(), scParameters.cend(), [parameterID](const ParameterInfo_t& element) {return parameterID == element.mParameterID;})};
+
+    return scParameters.cend() != c_ParameterIt ? &*c_ParameterIt : nullptr;
+}
+
+std::uint64_t DeviceCatalog::getContentHash() const
+{
+    return mContentHash;
+}
+
+void DeviceCatalog::_init(const Core::Path_t& deviceCatalogFile)
+{
+    if (!deviceCatalogFile.empty() && std::filesystem::exists(deviceCatalogFile))
+    {
+        std::ifstream deviceCatalogStream{deviceCatalogFile};
+        std::string currentRow;
+
+        getline(deviceCatalogStream, currentRow); // header is discarded
+        mContentHash = Core::getHash64(currentRow);
+
+        while (getline(deviceCatalogStream, currentRow))
+        {
+            mContentHash = Core::getHash64(currentRow, mContentHash);
+
+            if (!Core::areParseableCharactersContained(currentRow))
+            {
+                continue;
+            }
+
+            DeviceTypeInfo_t deviceTypeInfo;
+
+            if (!_parseDeviceType(currentRow, deviceTypeInfo))
+            {
+                fprintf(stderr, "Warning! Invalid device catalog entry discarded: %s\n", currentRow.c_str());
+            }
+            else if (Data::c_DeviceTypeTextToIDMapping.cend() != Data::c_DeviceTypeTextToIDMapping.find(deviceTypeInfo.mKeyword))
+            {
+                fprintf(stderr, "Warning! Duplicate device type discarded: %s\n", deviceTypeInfo.mKeyword.c_str());
+            }
+            else
+            {
+                mDeviceTypes.push_back(std::move(deviceTypeInfo));
+            }
+        }
+    }
+
+    // the index is built only after all device types have been read (so the keywords are no longer moved)
+    _buildKeywordIndex();
+
+    // the device types sharing a keyword are adjacent within the index, sorted in the order they have been read (only the first one is kept)
+    std::vector<bool> areDuplicateDeviceTypes(mDeviceTypes.size(), false);
+    bool duplicatesFound{false};
+
+    for (size_t keywordIndexPos{1u}; keywordIndexPos < mKeywordIndex.size(); ++keywordIndexPos)
+    {
+        if (mKeywordIndex[keywordIndexPos].first == mKeywordIndex[keywordIndexPos - 1].first)
+        {
+            fprintf(stderr, "Warning! Duplicate device type discarded: %s\n", mDeviceTypes[mKeywordIndex[keywordIndexPos].second].mKeyword.c_str());
+            areDuplicateDeviceTypes[mKeywordIndex[keywordIndexPos].second] = true;
+            duplicatesFound = true;
+        }
+    }
+
+    if (duplicatesFound)
+    {
+        size_t keptDeviceTypesCount{0u};
+
+        for (size_t deviceTypeIndex{0u}; deviceTypeIndex < mDeviceTypes.size(); ++deviceTypeIndex)
+        {
+            if (!areDuplicateDeviceTypes[deviceTypeIndex])
+            {
+                if (keptDeviceTypesCount != deviceTypeIndex)
+                {
+                    mDeviceTypes[keptDeviceTypesCount] = std::move(mDeviceTypes[deviceTypeIndex]);
+                }
+
+                ++keptDeviceTypesCount;
+            }
+        }
+
+        mDeviceTypes.resize(keptDeviceTypesCount);
+        _buildKeywordIndex();
+    }
+}
+
+void DeviceCatalog::_buildKeywordIndex()
+{
+    mKeywordIndex.clear();
+    mKeywordIndex.reserve(mDeviceTypes.size());
+
+    for (size_t deviceTypeIndex{0u}; deviceTypeIndex < mDeviceTypes.size(); ++deviceTypeIndex)
+    {
+        mKeywordIndex.emplace_back(mDeviceTypes[deviceTypeIndex].mKeyword, deviceTypeIndex);
+    }
+
+    std::sort(mKeywordIndex.begin(), mKeywordIndex.end());
+}
+
+bool DeviceCatalog::_parseDeviceType(const std::string& row, DeviceTypeInfo_t& deviceTypeInfo) const
+{
+    std::string parameters;
+    std::string portTypes;
+    std::string descriptionFormat;
+    std::string labelFormat;
+
+    Core::Index_t currentPosition{Core::readDataField(row, deviceTypeInfo.mKeyword, 0)};
+    currentPosition = Core::readDataField(row, deviceTypeInfo.mDescription, currentPosition);
+    currentPosition = Core::readDataField(row, deviceTypeInfo.mLabel, currentPosition);
+    currentPosition = Core::readDataField(row, parameters, currentPosition);
+    currentPosition = Core::readDataField(row, portTypes, currentPosition);
+    currentPosition = Core::readDataField(row, descriptionFormat, currentPosition);
+    (void)Core::readDataField(row, labelFormat, currentPosition);
+
+    Core::convertStringCase(deviceTypeInfo.mKeyword, false);
+
+    bool isValid{!deviceTypeInfo.mKeyword.empty() &&
+                 !Core::areInvalidCharactersContained(deviceTypeInfo.mKeyword) &&
+                 !deviceTypeInfo.mDescription.empty() &&
+                 _parseParameters(parameters, deviceTypeInfo) &&
+                 _parsePortTypes(portTypes, deviceTypeInfo)};
+
+    if (isValid && descriptionFormat.empty())
+    {
+        deviceTypeInfo.mDescriptionFormat = mDefaultDescriptionFormat;
+    }
+    else if (isValid)
+    {
+        isValid = deviceTypeInfo.mDescriptionFormat.compile(descriptionFormat, mFormatVariableNames);
+    }
+
+    if (isValid && labelFormat.empty())
+    {
+        deviceTypeInfo.mLabelFormat = mDefaultLabelFormat;
+    }
+    else if (isValid)
+    {
+        isValid = deviceTypeInfo.mLabelFormat.compile(labelFormat, mFormatVariableNames);
+    }
+
+    return isValid;
+}
+
+// parameters are separated by semicolon, e.g. "slot;portType;port" (the port number is mandatory)
+bool DeviceCatalog::_parseParameters(std::string_view parameters, DeviceTypeInfo_t& deviceTypeInfo) const
+{
+    bool isValid{true};
+
+    deviceTypeInfo.mSchema = {};
+
+    while (isValid && !parameters.empty())
+    {
+        const size_t c_SeparatorIndex{parameters.find(';')};
+        const std::string_view c_ParameterName{parameters.substr(0, c_SeparatorIndex)};
+
+        parameters = std::string_view::npos != c_SeparatorIndex ? parameters.substr(c_SeparatorIndex + 1) : std::string_view{};
+
+        if (const auto c_ParameterIt{std::find_if(scParameters.cbegin(), scParameters.cend(), [c_ParameterName](const ParameterInfo_t& element) {return c_ParameterName == element.mName;})};
+            scParameters.cend() != c_ParameterIt && deviceTypeInfo.mSchema.mParametersCount < Data::c_MaxPortInputParametersCount)
+        {
+            deviceTypeInfo.mSchema.mParameters[deviceTypeInfo.mSchema.mParametersCount++] = c_ParameterIt->mParameterID;
+        }
+        else
+        {
+            isValid = false; // unknown or too many parameters
+        }
+    }
+
+    // duplicate parameters are rejected by the schema check
+    return isValid &&
+           Data::isValidDevicePortSchema(deviceTypeInfo.mSchema) &&
+           _isParameterRequired(deviceTypeInfo, Data::PortParameterID::PORT_NUMBER);
+}
+
+// port types are separated by semicolon, each one having the format: type=description/label, e.g. "N=Ethernet/ETH;F=Fibre Channel/FC"
+bool DeviceCatalog::_parsePortTypes(std::string_view portTypes, DeviceTypeInfo_t& deviceTypeInfo) const
+{
+    bool isValid{true};
+
+    deviceTypeInfo.mPortTypes.clear();
+
+    while (isValid && !portTypes.empty())
+    {
+        const size_t c_SeparatorIndex{portTypes.find(';')};
+        const std::string_view c_PortTypeInfo{portTypes.substr(0, c_SeparatorIndex)};
+
+        portTypes = std::string_view::npos != c_SeparatorIndex ? portTypes.substr(c_SeparatorIndex + 1) : std::string_view{};
+
+        const size_t c_EqualCharIndex{c_PortTypeInfo.find('=')};
+        const size_t c_SlashCharIndex{c_PortTypeInfo.find('/', std::string_view::npos != c_EqualCharIndex ? c_EqualCharIndex : 0u)};
+
+        if (std::string_view::npos != c_EqualCharIndex && c_EqualCharIndex > 0u && std::string_view::npos != c_SlashCharIndex)
+        {
+            std::string portType{c_PortTypeInfo.substr(0, c_EqualCharIndex)};
+            Core::convertStringCase(portType, true);
+
+            isValid = !Core::areInvalidCharactersContained(portType) &&
+                      deviceTypeInfo.mPortTypes.emplace(portType, std::pair<std::string, std::string>{c_PortTypeInfo.substr(c_EqualCharIndex + 1, c_SlashCharIndex - c_EqualCharIndex - 1),
+                                                                                                       c_PortTypeInfo.substr(c_SlashCharIndex + 1)}).second;
+        }
+        else
+        {
+            isValid = false;
+        }
+    }
+
+    // port types should be provided if and only if the port type is a required parameter
+    return isValid && (_isParameterRequired(deviceTypeInfo, Data::PortParameterID::PORT_TYPE) == !deviceTypeInfo.mPortTypes.empty());
+}
+
+bool DeviceCatalog::_isParameterRequired(const DeviceTypeInfo_t& deviceTypeInfo, const Data::PortParameterID parameterID) const
+{
+    const auto c_ParametersEndIt{deviceTypeInfo.mSchema.mParameters.cbegin() + deviceTypeInfo.mSchema.mParametersCount};
+
+    return c_ParametersEndIt != std::find(deviceTypeInfo.mSchema.mParameters.cbegin(), c_ParametersEndIt, parameterID);
+}
+
+std::shared_ptr<DeviceCatalog> DeviceCatalog::s_pDeviceCatalog{nullptr};
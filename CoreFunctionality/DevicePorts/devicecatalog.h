@@ -0,0 +1,115 @@
+#ifndef DEVICECATALOG_H
+#define DEVICECATALOG_H
+
+#include <vector>
+#include <array>
+
+#include "applicationdata.h"
+#include "deviceportdata.h"
+#include "formattemplate.h"
+#include "coreutils.h"
+
+namespace Core = Utilities::Core;
+
+/* This class stores the device types defined by user in the device catalog file (in addition to the built-in ones)
+   The catalog is read and compiled once (when first requesting the instance) into flat tables that are subsequently used for:
+    - converting the device type keyword entered by user into a device type ID (and back)
+    - creating the device ports (generic, table driven, see CatalogDevicePort)
+    - creating the placeholders for the connection input template file (based on the device port schema, same as for built-in device types)
+*/
+class DeviceCatalog
+{
+public:
+    // input parameter that can be requested by a catalog device port
+    struct ParameterInfo_t
+    {
+        std::string_view mName;                 // name used in the catalog file
+        Data::PortParameterID mParameterID;
+        Data::LabelFormatVariable mVariable;    // label format variable that receives the parameter value
+    };
+
+    struct DeviceTypeInfo_t
+    {
+        std::string mKeyword;                               // device type as entered in the connection definitions/input files (lower case)
+        std::string mDescription;
+        std::string mLabel;
+        Data::DevicePortSchema_t mSchema;                   // required input parameters, in the order they are entered in the connection input file
+        Data::AllowedDataPortTypes_t mPortTypes;            // only used if a port type parameter is required
+        Core::FormatTemplate mDescriptionFormat;
+        Core::FormatTemplate mLabelFormat;
+    };
+
+    /* The instance reads the device catalog file from the application data directory
+    */
+    static std::shared_ptr<DeviceCatalog> getInstance();
+
+    /* Catalog read from the given file, independently of the instance (e.g. for checking a catalog file before putting it into the application data directory)
+    */
+    explicit DeviceCatalog(const Core::Path_t& deviceCatalogFile);
+
+    /* Returns UNKNOWN_DEVICE if no catalog device type matches the (lower case) keyword
+    */
+    Data::DeviceTypeID getDeviceTypeID(const std::string_view keyword) const;
+
+    /* Returns nullptr if the device type ID does not belong to a catalog device
+    */
+    const DeviceTypeInfo_t* getDeviceTypeInfo(const Data::DeviceTypeID deviceTypeID) const;
+
+    /* Returns nullptr if the parameter is not supported for catalog device types
+    */
+    static const ParameterInfo_t* getParameterInfo(const Data::PortParameterID parameterID);
+
+    /* Hash of the device catalog file content (0 if no file), used for detecting that the previously calculated labels might no longer be valid
+    */
+    std::uint64_t getContentHash() const;
+
+    // the port type parameter is the only one that is not numeric (its value should be contained in the allowed port types of the device)
+    static constexpr std::array<ParameterInfo_t, 7> scParameters
+    {{
+        {   "portType",         Data::PortParameterID::PORT_TYPE,               Data::LabelFormatVariable::PORT_TYPE_LABEL      },
+        {   "port",             Data::PortParameterID::PORT_NUMBER,             Data::LabelFormatVariable::PORT_NUMBER          },
+        {   "slot",             Data::PortParameterID::SLOT_NUMBER,             Data::LabelFormatVariable::SLOT_NUMBER          },
+        {   "blade",            Data::PortParameterID::BLADE_NUMBER,            Data::LabelFormatVariable::BLADE_NUMBER         },
+        {   "controller",       Data::PortParameterID::CONTROLLER_NUMBER,       Data::LabelFormatVariable::CONTROLLER_NUMBER    },
+        {   "module",           Data::PortParameterID::MODULE_NUMBER,           Data::LabelFormatVariable::MODULE_NUMBER        },
+        {   "loadSegment",      Data::PortParameterID::LOAD_SEGMENT_NUMBER,     Data::LabelFormatVariable::LOAD_SEGMENT_NUMBER  }
+    }};
+
+    // formats used when the catalog entry doesn't provide its own (the variables of the parameters not required by the device are empty so their sections are skipped)
+    static constexpr std::string_view scDefaultDescriptionFormat{"{device} placed at U{u}[ - slot {slot}][ - blade {blade}][ - controller {controller}][ - module {module}]"
+                                                                 "[ - load segment {loadSegment}] - [{portTypeDescription} ]port {port}"};
+    static constexpr std::string_view scDefaultLabelFormat{"U{u}[_{deviceLabel}][_S{slot}][_B{blade}][_C{controller}][_M{module}][_L{loadSegment}][_{portTypeLabel}]_P{port}"};
+
+private:
+    /* Reads the device catalog file (if any). Each row (except the header) should contain:
+       device type keyword, description, label, parameters, port types, description format, label format
+       Invalid rows are discarded with a warning, as are the ones using an already defined keyword (the first row using it being kept)
+    */
+    void _init(const Core::Path_t& deviceCatalogFile);
+
+    /* The keywords of the device types are referenced by the index so it should be rebuilt whenever the device types are moved
+    */
+    void _buildKeywordIndex();
+
+    bool _parseDeviceType(const std::string& row, DeviceTypeInfo_t& deviceTypeInfo) const;
+    bool _parseParameters(std::string_view parameters, DeviceTypeInfo_t& deviceTypeInfo) const;
+    bool _parsePortTypes(std::string_view portTypes, DeviceTypeInfo_t& deviceTypeInfo) const;
+    bool _isParameterRequired(const DeviceTypeInfo_t& deviceTypeInfo, const Data::PortParameterID parameterID) const;
+
+    static std::shared_ptr<DeviceCatalog> s_pDeviceCatalog;
+
+    // index within table is: device type ID - FIRST_CATALOG_DEVICE
+    std::vector<DeviceTypeInfo_t> mDeviceTypes;
+
+    // keyword - index (in mDeviceTypes) pairs, sorted by keyword
+    std::vector<std::pair<std::string_view, size_t>> mKeywordIndex;
+
+    std::uint64_t mContentHash;
+
+    // the default formats are compiled once, being copied to each device type that doesn't provide its own ones
+    const std::vector<std::string_view> mFormatVariableNames;
+    Core::FormatTemplate mDefaultDescriptionFormat;
+    Core::FormatTemplate mDefaultLabelFormat;
+};
+
+#endif // DEVICECATALOG_H
@@ -1,6 +1,6 @@
 #include <algorithm>
+#include <cctype>
 
-#include "isubparserobserver.h"
 #include "errorcodes.h"
 #include "deviceportdata.h"
 #include "deviceportutils.h"
@@ -10,13 +10,14 @@ namespace Ports = Utilities::DevicePorts;
 
 DevicePort::DevicePort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice, const bool parseFromRowStart)
     : mDeviceUPosition{deviceUPosition}
+    , mIsPowerPort{false}
+    , mpLabelFormatValues{nullptr}
     , mFileRowNumber{fileRowNumber}
     , mFileColumnNumber{1u}
     , mInputParametersCount{0u} // should be updated by init() method
     , mIsSourceDevice{isSourceDevice}
     , mIsInitialized{false}
     , mpErrorHandler{nullptr}
-    , m_pISubParserObserver{nullptr}
     , mParseFromRowStart{parseFromRowStart}
 {
 }
@@ -36,8 +37,28 @@ void DevicePort::init()
     }
 }
 
-void DevicePort::parseInputData(std::vector<ErrorPtr>& parsingErrors)
+void DevicePort::updateDescriptionAndLabel()
 {
+    LabelFormatValues_t labelFormatValues{};
+    mpLabelFormatValues = &labelFormatValues;
+
+    _setLabelFormatValue(Data::LabelFormatVariable::U_POSITION, mDeviceUPosition);
+    _setLabelFormatValue(Data::LabelFormatVariable::DEVICE_DESCRIPTION, mDeviceTypeDescription);
+    _setLabelFormatValue(Data::LabelFormatVariable::DEVICE_LABEL, mDeviceTypeLabel);
+
+    _updateDescriptionAndLabel();
+
+    mpLabelFormatValues = nullptr;
+}
+
+SubParsingResult_t DevicePort::parseInputData(const std::string_view rawInputData, const size_t fileColumnNumber)
+{
+    SubParsingResult_t result;
+    std::vector<ErrorPtr>& parsingErrors{result.mParsingErrors};
+
+    _setRawInputData(rawInputData);
+    mFileColumnNumber = fileColumnNumber;
+
     if (_isCurrentPositionAllowed() &&
         mInputParametersCount == mInputData.size() &&
         mInputParametersCount > 0u &&
@@ -48,8 +69,6 @@ void DevicePort::parseInputData(std::vector<ErrorPtr>& parsingErrors)
         bool fewerCellsProvided{false};       // for checking if the "fewer cells" error occurred
         ErrorPtr lastError{nullptr};          // last found error
 
-        parsingErrors.clear();
-
         while(currentParameter < mInputParametersCount) // check the "useful" fields (required input parameters for the device)
         {
             if (!mCurrentPosition.has_value()) // check if characters are available for current (required) field
@@ -101,31 +120,11 @@ void DevicePort::parseInputData(std::vector<ErrorPtr>& parsingErrors)
         }
     }
 
-    if (m_pISubParserObserver) // notify parser no matter the (sub)parsing outcome
-    {
-        m_pISubParserObserver->subParserFinished(this);
-    }
-}
-
-Core::Index_t DevicePort::getCurrentPosition() const
-{
-    Core::Index_t currentPosition{mCurrentPosition};
+    // returned no matter the (sub)parsing outcome
+    result.mCurrentPosition = _getRelativeCurrentPosition();
+    result.mFileColumnNumber = mFileColumnNumber;
 
-    if (mCurrentPosition.has_value() && !mParseFromRowStart)
-    {
-        if (const size_t c_CurrentPosition{mCurrentPosition.value()}, c_PaddingSize{Data::c_Padding.size()};
-            c_CurrentPosition >= c_PaddingSize)
-        {
-            currentPosition = c_CurrentPosition - c_PaddingSize;
-        }
-        else
-        {
-            currentPosition.reset();
-            ASSERT(false, "Invalid string index provided for device port data");
-        }
-    }
-
-    return currentPosition;
+    return result;
 }
 
 size_t DevicePort::getFileRowNumber() const
@@ -133,11 +132,6 @@ size_t DevicePort::getFileRowNumber() const
     return mFileRowNumber;
 }
 
-size_t DevicePort::getFileColumnNumber() const
-{
-    return mFileColumnNumber;
-}
-
 std::string DevicePort::getDescription() const
 {
     return mDescription;
@@ -148,62 +142,105 @@ std::string DevicePort::getLabel() const
     return mLabel;
 }
 
-void DevicePort::setSubParserObserver(ISubParserObserver* const pISubParserObserver)
+std::string DevicePort::getDeviceUPosition() const
 {
-    m_pISubParserObserver = pISubParserObserver;
+    return mDeviceUPosition;
 }
 
-void DevicePort::setErrorHandler(const ErrorHandlerPtr pErrorHandler)
+std::string DevicePort::getDeviceDescription() const
 {
-    if (!mpErrorHandler && pErrorHandler)
-    {
-        mpErrorHandler = pErrorHandler;
-    }
+    return mDeviceTypeDescription;
 }
 
-void DevicePort::setFileColumnNumber(const size_t fileColumnNumber)
+bool DevicePort::isPowerPort() const
 {
-    mFileColumnNumber = fileColumnNumber;
+    return mIsPowerPort;
 }
 
-void DevicePort::setRawInputData(const std::string_view rawInputData)
+bool DevicePort::isValidLabel() const
 {
-    mRawInputData.clear();
-    mCurrentPosition.reset();
+    return std::string::npos == mLabel.find(Ports::c_LabelErrorText);
+}
 
-    if (!rawInputData.empty())
+std::uint64_t DevicePort::getPortHash() const
+{
+    std::uint64_t portHash{Core::getHash64(mDeviceTypeLabel, Core::getHash64(mDeviceTypeDescription))};
+
+    // each value is hashed separately (chained by seed) so the boundaries between values are kept; a copy is only made for the values containing lower case letters
+    const auto c_HashNormalizedValue{[&portHash](const std::string_view value) {
+        if (Core::isDigitString(value) && value.size() > 0u)
+        {
+            const size_t c_FirstNonZeroIndex{value.find_first_not_of('0')};
+            portHash = Core::getHash64(std::string::npos != c_FirstNonZeroIndex ? value.substr(c_FirstNonZeroIndex) : value.substr(value.size() - 1), portHash);
+        }
+        else if (value.cend() != std::find_if(value.cbegin(), value.cend(), [](const char c) {return std::islower(static_cast<unsigned char>(c));}))
+        {
+            std::string upperCaseValue{value};
+            Core::convertStringCase(upperCaseValue, true);
+            portHash = Core::getHash64(upperCaseValue, portHash);
+        }
+        else
+        {
+            portHash = Core::getHash64(value, portHash);
+        }
+    }};
+
+    c_HashNormalizedValue(mDeviceUPosition);
+
+    for (const auto c_pValue : mInputData)
     {
-        if (!mParseFromRowStart)
+        if (c_pValue)
         {
-            mRawInputData.append(Data::c_Padding);
+            c_HashNormalizedValue(*c_pValue);
         }
+    }
 
-        mCurrentPosition = mRawInputData.size();
-        mRawInputData.append(rawInputData);
+    return portHash;
+}
+
+void DevicePort::setErrorHandler(const ErrorHandlerPtr pErrorHandler)
+{
+    if (!mpErrorHandler && pErrorHandler)
+    {
+        mpErrorHandler = pErrorHandler;
     }
 }
 
-void DevicePort::_registerRequiredParameter(std::string* const pRequiredParameter)
+void DevicePort::setCheckInputFileText(const std::string_view checkInputFileText)
+{
+    mCheckInputFileText = checkInputFileText;
+}
+
+void DevicePort::_setLabelFormatValue(const Data::LabelFormatVariable variable, const std::string_view value)
 {
-    if (pRequiredParameter)
+    if (const size_t c_VariableIndex{static_cast<size_t>(variable)}; mpLabelFormatValues && c_VariableIndex < mpLabelFormatValues->size())
+    {
+        (*mpLabelFormatValues)[c_VariableIndex] = value;
+    }
+    else
     {
-        mInputData.push_back(pRequiredParameter);
+        ASSERT(false, "Invalid label format variable or label format values not available");
     }
 }
 
-void DevicePort::_appendDataToDescription(const std::string_view data)
+void DevicePort::_applyLabelFormat(const Data::LabelFormatID formatID)
 {
-    if (mIsInitialized)
+    if (mIsInitialized && mpLabelFormatValues)
     {
-        mDescription += data;
+        LabelFormats::getInstance()->render(formatID, *mpLabelFormatValues, mDescription, mLabel);
+        mIsPowerPort = Data::c_PowerPortLabelFormats.cend() != std::find(Data::c_PowerPortLabelFormats.cbegin(), Data::c_PowerPortLabelFormats.cend(), formatID);
     }
 }
 
-void DevicePort::_appendDataToLabel(const std::string_view data)
+void DevicePort::_applyLabelFormat(const Core::FormatTemplate& descriptionFormat, const Core::FormatTemplate& labelFormat)
 {
-    if (mIsInitialized)
+    if (mIsInitialized && mpLabelFormatValues)
     {
-        mLabel += data;
+        mDescription.clear();
+        mLabel.clear();
+
+        descriptionFormat.render(mDescription, *mpLabelFormatValues);
+        labelFormat.render(mLabel, *mpLabelFormatValues);
     }
 }
 
@@ -224,12 +261,13 @@ void DevicePort::_setInvalidDescriptionAndLabel(const std::string_view descripti
         }
         else
         {
-            const std::string c_CheckConnectionInputFileText{Ports::getCheckConnectionInputFileText()};
+            const std::string c_CheckConnectionInputFileText{mCheckInputFileText.empty() ? Ports::getCheckConnectionInputFileText({}) : std::string{}};
+            const std::string_view c_CheckInputFileText{mCheckInputFileText.empty() ? c_CheckConnectionInputFileText : mCheckInputFileText};
 
             mLabel.clear();
-            mLabel.reserve(Ports::c_LabelErrorText.size() + c_CheckConnectionInputFileText.size());
+            mLabel.reserve(Ports::c_LabelErrorText.size() + c_CheckInputFileText.size());
             mLabel.append(Ports::c_LabelErrorText);
-            mLabel.append(c_CheckConnectionInputFileText);
+            mLabel.append(c_CheckInputFileText);
         }
     }
 }
@@ -278,13 +316,21 @@ void DevicePort::_initializeRequiredParameters()
     {
         if (mFileRowNumber > 0u && mFileColumnNumber > 0u)
         {
-            mInputParametersCount = _getInputParametersCount();
+            const Data::DevicePortSchema_t& c_Schema{_getSchema()};
+            mInputParametersCount = c_Schema.mParametersCount;
 
             // there should be at least one parameter (port number))
             if (mInputParametersCount > 0u && mInputParametersCount <= Data::c_MaxPortInputParametersCount)
             {
                 mInputData.reserve(mInputParametersCount);
-                _registerRequiredParameters();
+
+                for (size_t parameterIndex{0u}; parameterIndex < mInputParametersCount; ++parameterIndex)
+                {
+                    if (std::string* const pRequiredParameter{_getRequiredParameter(c_Schema.mParameters[parameterIndex])}; pRequiredParameter)
+                    {
+                        mInputData.push_back(pRequiredParameter);
+                    }
+                }
 
                 ASSERT(mInputParametersCount == mInputData.size(), "Incorrect registration of device port input parameters detected");
             }
@@ -306,16 +352,45 @@ void DevicePort::_initializeDescriptionAndLabel()
     {
         const auto[deviceTypeDescription, deviceTypeLabel]{_getDeviceTypeDescriptionAndLabel()};
 
-        mDescription = deviceTypeDescription.size() > 0 ? deviceTypeDescription : "Device";
-        mDescription += " placed at U";
-        mDescription += mDeviceUPosition;
+        mDeviceTypeDescription = deviceTypeDescription.size() > 0 ? deviceTypeDescription : "Device";
+        mDeviceTypeLabel = deviceTypeLabel;
+    }
+}
 
-        mLabel = "U" + mDeviceUPosition;
+Core::Index_t DevicePort::_getRelativeCurrentPosition() const
+{
+    Core::Index_t currentPosition{mCurrentPosition};
 
-        if (deviceTypeLabel.size() > 0)
+    if (mCurrentPosition.has_value() && !mParseFromRowStart)
+    {
+        if (const size_t c_CurrentPosition{mCurrentPosition.value()}, c_PaddingSize{Data::c_Padding.size()};
+            c_CurrentPosition >= c_PaddingSize)
+        {
+            currentPosition = c_CurrentPosition - c_PaddingSize;
+        }
+        else
         {
-            mLabel += "_";
-            mLabel += deviceTypeLabel;
+            currentPosition.reset();
+            ASSERT(false, "Invalid string index provided for device port data");
         }
     }
+
+    return currentPosition;
+}
+
+void DevicePort::_setRawInputData(const std::string_view rawInputData)
+{
+    mRawInputData.clear();
+    mCurrentPosition.reset();
+
+    if (!rawInputData.empty())
+    {
+        if (!mParseFromRowStart)
+        {
+            mRawInputData.append(Data::c_Padding);
+        }
+
+        mCurrentPosition = mRawInputData.size();
+        mRawInputData.append(rawInputData);
+    }
 }
@@ -3,15 +3,16 @@
 
 #include <vector>
 #include <utility>
+#include <cstdint>
 
 #include "isubparser.h"
+#include "labelformats.h"
+#include "deviceportdata.h"
 
 #ifdef _WIN32
 #include "auxdata.h"
 #endif
 
-class ISubParserObserver;
-
 class DevicePort : public ISubParser
 {
 public:
@@ -24,55 +25,78 @@ public:
 
     /* Initialization function that fulfills two purposes:
       - initialize description and label
-      - register required parameters
+      - register required parameters (as defined by the device port schema)
     */
     virtual void init() override;
 
     /* Updates the description and label fields for each device port
-       These two had been previously initialized by the base class (e.g. by writing the rack U position of the device)
        The updated data will subsequently be used for building the final labelling table
+       The label format values only exist during the update (they are not stored by the port, which is kept until the labelling table is built)
     */
-    virtual void updateDescriptionAndLabel() = 0;
+    void updateDescriptionAndLabel();
 
-    /* reads and parses the input fields for the device port from string starting position pos (which is subsequently updated)
-       uses the ofstream for logging any errors in the corresponding file and the boolean to report the occurence of these errors
+    /* reads and parses the input fields for the device port from the raw input data, starting with the given csv column
+       the errors are returned together with the position and column number following the parsed fields
     */
-    virtual void parseInputData(std::vector<ErrorPtr>& parsingErrors) override;
+    virtual SubParsingResult_t parseInputData(const std::string_view rawInputData, const size_t fileColumnNumber) override;
 
     // getters
-    virtual Core::Index_t getCurrentPosition() const override final;
     virtual size_t getFileRowNumber() const override final;
-    virtual size_t getFileColumnNumber() const override final;
     std::string getDescription() const;
     std::string getLabel() const;
+    std::string getDeviceUPosition() const;
+    std::string getDeviceDescription() const;
+
+    /* True if the port carries power (e.g. power supply or PDU port), as determined by the label format applied to it
+    */
+    bool isPowerPort() const;
+
+    /* False if the label has been replaced by a "soft" parsing error message (see _setInvalidDescriptionAndLabel())
+    */
+    bool isValidLabel() const;
+
+    /* Hash identifying the port regardless of the row it has been entered on: device type, U position and input parameter values
+       The values are normalized first (numbers without leading zeros, text in upper case) so the same port is identified even if entered differently
+    */
+    std::uint64_t getPortHash() const;
 
     // setters
-    virtual void setSubParserObserver(ISubParserObserver* const pISubParserObserver) override final;
     virtual void setErrorHandler(const ErrorHandlerPtr pErrorHandler) override final;
-    virtual void setFileColumnNumber(const size_t fileColumnNumber) override final;
-    virtual void setRawInputData(const std::string_view rawInputData) override final;
+
+    /* Text appended to the invalid labels for pointing the user to the parsed input (see Utilities::DevicePorts::getCheckConnectionInputFileText())
+       The text is not copied so it should remain valid as long as the port (e.g. owned by the parent parser)
+    */
+    void setCheckInputFileText(const std::string_view checkInputFileText);
 
 protected:
-    /* Registers the required parameters; these are subsequently requested (parsed) from the connection input file:
-       - the registration order should match the order in which parameters are given within file for the specific device port
-       - the number of registered parameters should match the mInputParametersCount
-       - needs to be implemented by derived classes, each class having its own specifics regarding required input parameters
+    /* Device specific update of the description and label, the parameter values being checked by each device port
+       These two are built from the label format matching the port parameters (the device type and rack U position had been previously setup by the base class)
+    */
+    virtual void _updateDescriptionAndLabel() = 0;
+
+    /* Retrieves the schema of the device port: the number and order of the required input parameters
     */
-    virtual void _registerRequiredParameters() = 0;
+    virtual const Data::DevicePortSchema_t& _getSchema() const = 0;
 
-    /* Registers each required input parameter so it can be subsequently requested from the connection input file (used by the _registerRequiredParameters() method)
+    /* Returns the string storing the value of the parameter (nullptr if the parameter is not used by the device port)
+       Used for registering the parameters in the order defined by the schema; these are subsequently requested (parsed) from the connection input file
     */
-    void _registerRequiredParameter(std::string* const pRequiredParameter);
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) = 0;
 
-    /* This function is used for appending data calculated based on the parsed input parameters
-       (other than the ones used for initializing description and label) to device port description
+    /* This function is used for passing data calculated based on the parsed input parameters
+       (other than the ones used for initializing description and label) to the label format
+       The value should remain valid until the label format is applied (e.g. a data member of the device port)
+       Should only be called from _updateDescriptionAndLabel()
     */
-    void _appendDataToDescription(const std::string_view data);
+    void _setLabelFormatValue(const Data::LabelFormatVariable variable, const std::string_view value);
 
-    /* This function is used for appending data calculated based on the parsed input parameters
-       (other than the ones used for initializing description and label) to device port label
+    /* This function writes the device port description and label by running the requested (compiled) label format on the previously set values
     */
-    void _appendDataToLabel(const std::string_view data);
+    void _applyLabelFormat(const Data::LabelFormatID formatID);
+
+    /* Same as above, the formats being provided by the device port (e.g. the ones of the catalog device types) instead of the label formats table
+    */
+    void _applyLabelFormat(const Core::FormatTemplate& descriptionFormat, const Core::FormatTemplate& labelFormat);
 
     /* This function is used for replacing port description and label with a "soft" parsing error message
        "Hard" parsing errors are being logged within error file by using the error handling functionality (see ErrorHandling directory)
@@ -84,10 +108,6 @@ protected:
     */
     void _checkLabel();
 
-    /* Retrieves the number of input parameters required for each device port. Each port is responsible for determining the number of required params
-    */
-    virtual size_t _getInputParametersCount() const = 0;
-
     /* Required for initializing the device port description and label
     */
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const;
@@ -101,10 +121,18 @@ private:
     */
     void _initializeRequiredParameters();
 
-    /* This function is used for setting initial data (device U position, device type) into device port description and label
+    /* This function is used for retrieving the device type description and label
     */
     void _initializeDescriptionAndLabel();
 
+    /* Stores the data to be parsed (prepended by padding if required) and sets the current position to its beginning
+    */
+    void _setRawInputData(const std::string_view rawInputData);
+
+    /* Converts the current position into a position relative to the raw input data received from parser (padding excluded)
+    */
+    Core::Index_t _getRelativeCurrentPosition() const;
+
     // string passed to the device port object for parsing; the device port might parse part or the whole content (padding prefix data might also be required)
     std::string mRawInputData;
 
@@ -117,6 +145,16 @@ private:
     // text to be written in the source (first device) / destination (second device) field of the labelling table (device port label)
     std::string mLabel;
 
+    // device type description and label (e.g. "Extension bar" / "EXT") used for building the device port description and label
+    std::string mDeviceTypeDescription;
+    std::string mDeviceTypeLabel;
+
+    // set when applying one of the power port label formats
+    bool mIsPowerPort;
+
+    // values of the variables used by label formats (U position, port number etc), only available while updating the description and label
+    LabelFormatValues_t* mpLabelFormatValues;
+
     // input CSV file row from which the device info is being parsed, used for error reporting
     size_t mFileRowNumber;
 
@@ -141,8 +179,8 @@ private:
     // error handler (should be received from parent parser)
     std::shared_ptr<ErrorHandler> mpErrorHandler;
 
-    // parent parser (used for passing data via callback after subparser finishes the parsing job)
-    ISubParserObserver* m_pISubParserObserver;
+    // text appended to the invalid labels (if not set the input data is mentioned instead of the parsed input file)
+    std::string_view mCheckInputFileText;
 
     // flag that signals that parsing begins from start of row (if false: some padding needs to be prepended to raw input data, otherwise first cell is always considered empty)
     const bool mParseFromRowStart;
@@ -1,5 +1,6 @@
 #include "datadeviceport.h"
 #include "powerdeviceport.h"
+#include "catalogdeviceport.h"
 #include "deviceportsfactory.h"
 
 DevicePort* DevicePortsFactory::createDevicePort(const Data::DeviceTypeID deviceTypeID,
@@ -51,7 +52,15 @@ DevicePort* DevicePortsFactory::createDevicePort(const Data::DeviceTypeID device
         pDevicePort = new BladeServerPort(deviceUPosition, fileRowNumber, isSourceDevice);
         break;
     default:
-        ASSERT(false, "Cannot create device port");
+        // device types beyond the built-in ones are defined within the device catalog file
+        if (const DeviceCatalog::DeviceTypeInfo_t* const c_pDeviceTypeInfo{DeviceCatalog::getInstance()->getDeviceTypeInfo(deviceTypeID)}; c_pDeviceTypeInfo)
+        {
+            pDevicePort = new CatalogDevicePort(*c_pDeviceTypeInfo, deviceUPosition, fileRowNumber, isSourceDevice);
+        }
+        else
+        {
+            ASSERT(false, "Cannot create device port");
+        }
     }
 
     return pDevicePort;
@@ -1,10 +1,9 @@
-#include "appsettings.h"
 #include "deviceportutils.h"
 
-std::string Utilities::DevicePorts::getCheckConnectionInputFileText()
+std::string Utilities::DevicePorts::getCheckConnectionInputFileText(const std::string_view inputFile)
 {
-    std::string promptCheckingFileText{"PLEASE REVIEW INPUT FILE: "};
-    promptCheckingFileText += AppSettings::getInstance()->getConnectionInputFile().string();
+    std::string promptCheckingFileText{inputFile.empty() ? "PLEASE REVIEW INPUT DATA" : "PLEASE REVIEW INPUT FILE: "};
+    promptCheckingFileText += inputFile;
 
     return  promptCheckingFileText;
 }
@@ -18,3 +17,8 @@ bool Utilities::DevicePorts::isPowerPortType(const std::string_view portType)
 {
     return ("p" == portType || "P" == portType);
 }
+
+bool Utilities::DevicePorts::isInPortNumber(const std::string_view portNumber)
+{
+    return ("in" == portNumber || "IN" == portNumber || "In" == portNumber || "iN" == portNumber);
+}
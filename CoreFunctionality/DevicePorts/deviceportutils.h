@@ -3,6 +3,9 @@
 
 #include <string_view>
 #include <string>
+#include <array>
+
+#include "deviceporttypes.h"
 
 namespace Utilities::DevicePorts
 {
@@ -18,9 +21,26 @@ namespace Utilities::DevicePorts
     inline constexpr std::string_view c_MaxLabelCharsCountExceededErrorText{"LABELLING ERROR: MAXIMUM CHARACTERS COUNT EXCEEDED BY: "};
     inline constexpr std::string_view c_LabelErrorText{"INVALID LABEL! "};
 
-    std::string getCheckConnectionInputFileText();
+    // errors written by the catalog device ports when a parameter value is invalid (same order as the PortParameterID enumerators)
+    inline constexpr std::array<std::string_view, static_cast<size_t>(Data::PortParameterID::PortParametersCount)> c_InvalidPortParameterErrorTexts
+    {
+        c_InvalidPlacementErrorText,
+        c_InvalidLoadSegmentNumberErrorText,
+        c_InvalidPortTypeErrorText,
+        c_InvalidPortNumberErrorText,
+        c_InvalidBladeNumberErrorText,
+        c_InvalidSlotNumberErrorText,
+        c_InvalidControllerNumberErrorText,
+        c_InvalidModuleTypeErrorText,
+        c_InvalidModuleNumberErrorText
+    };
+
+    /* The input data is mentioned instead of a file if no input file is provided (e.g. labelling service requests)
+    */
+    std::string getCheckConnectionInputFileText(const std::string_view inputFile);
     bool isManagementPortNumber(const std::string_view portNumber);
     bool isPowerPortType(const std::string_view portType);
+    bool isInPortNumber(const std::string_view portNumber);
 }
 
 #endif // DEVICEPORTUTILS_H
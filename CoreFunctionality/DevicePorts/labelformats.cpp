@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cstdio>
+
+#include "appsettings.h"
+#include "deviceportdata.h"
+#include "labelformats.h"
+
+LabelFormats::LabelFormats()
+    : mContentHash{0u}
+{
+    _init();
+}
+
+std::shared_ptr<LabelFormats> LabelFormats::getInstance()
+{
+    if (!s_pLabelFormats)
+    {
+        s_pLabelFormats.reset(new LabelFormats);
+    }
+
+    return s_pLabelFormats;
+}
+
+void LabelFormats::render(const Data::LabelFormatID formatID, const LabelFormatValues_t& values, std::string& description, std::string& label) const
+{
+    description.clear();
+    label.clear();
+
+    if (const size_t c_FormatIndex{static_cast<size_t>(formatID)}; c_FormatIndex < mCompiledFormats.size())
+    {
+        mCompiledFormats[c_FormatIndex].mDescriptionFormat.render(description, values);
+        mCompiledFormats[c_FormatIndex].mLabelFormat.render(label, values);
+    }
+    else
+    {
+        ASSERT(false, "Invalid label format requested");
+    }
+}
+
+std::uint64_t LabelFormats::getContentHash() const
+{
+    return mContentHash;
+}
+
+void LabelFormats::_init()
+{
+    for (size_t formatIndex{0u}; formatIndex < Data::c_DefaultLabelFormats.size(); ++formatIndex)
+    {
+        const bool c_IsValidFormat{_compileFormat(formatIndex, Data::c_DefaultLabelFormats[formatIndex].mDescriptionFormat, Data::c_DefaultLabelFormats[formatIndex].mLabelFormat)};
+        ASSERT(c_IsValidFormat, "Invalid built-in label format");
+    }
+
+    if (const Core::Path_t c_LabelFormatsFile{AppSettings::getInstance()->getLabelFormatsFile()};
+        !c_LabelFormatsFile.empty() && std::filesystem::exists(c_LabelFormatsFile))
+    {
+        _loadCustomFormats(c_LabelFormatsFile);
+    }
+}
+
+void LabelFormats::_loadCustomFormats(const Core::Path_t& labelFormatsFile)
+{
+    std::ifstream labelFormatsStream{labelFormatsFile};
+    std::string currentRow;
+
+    getline(labelFormatsStream, currentRow); // header is discarded
+    mContentHash = Core::getHash64(currentRow);
+
+    while (getline(labelFormatsStream, currentRow))
+    {
+        mContentHash = Core::getHash64(currentRow, mContentHash);
+
+        if (!Core::areParseableCharactersContained(currentRow))
+        {
+            continue;
+        }
+
+        std::string formatName;
+        std::string descriptionFormat;
+        std::string labelFormat;
+
+        Core::Index_t currentPosition{Core::readDataField(currentRow, formatName, 0)};
+        currentPosition = Core::readDataField(currentRow, descriptionFormat, currentPosition);
+        (void)Core::readDataField(currentRow, labelFormat, currentPosition);
+
+        const auto c_FormatIt{std::find_if(Data::c_DefaultLabelFormats.cbegin(),
+                                           Data::c_DefaultLabelFormats.cend(),
+                                           [&formatName](const Data::LabelFormatInfo_t& formatInfo) {return formatName == formatInfo.mKey;})};
+
+        if (Data::c_DefaultLabelFormats.cend() != c_FormatIt)
+        {
+            const size_t c_FormatIndex{static_cast<size_t>(std::distance(Data::c_DefaultLabelFormats.cbegin(), c_FormatIt))};
+
+            // empty cells: keep the built-in format
+            const std::string_view c_DescriptionFormat{descriptionFormat.empty() ? c_FormatIt->mDescriptionFormat : descriptionFormat};
+            const std::string_view c_LabelFormat{labelFormat.empty() ? c_FormatIt->mLabelFormat : labelFormat};
+
+            if (!_compileFormat(c_FormatIndex, c_DescriptionFormat, c_LabelFormat))
+            {
+                fprintf(stderr, "Warning! Invalid label format discarded: %s\n", formatName.c_str());
+                (void)_compileFormat(c_FormatIndex, c_FormatIt->mDescriptionFormat, c_FormatIt->mLabelFormat);
+            }
+        }
+        else
+        {
+            fprintf(stderr, "Warning! Unknown label format discarded: %s\n", formatName.c_str());
+        }
+    }
+}
+
+bool LabelFormats::_compileFormat(const size_t formatIndex, const std::string_view descriptionFormat, const std::string_view labelFormat)
+{
+    bool success{false};
+
+    if (formatIndex < mCompiledFormats.size())
+    {
+        const std::vector<std::string_view> c_VariableNames{Data::c_LabelFormatVariableNames.cbegin(), Data::c_LabelFormatVariableNames.cend()};
+
+        success = mCompiledFormats[formatIndex].mDescriptionFormat.compile(descriptionFormat, c_VariableNames);
+        success = mCompiledFormats[formatIndex].mLabelFormat.compile(labelFormat, c_VariableNames) && success;
+    }
+
+    return success;
+}
+
+std::shared_ptr<LabelFormats> LabelFormats::s_pLabelFormats{nullptr};
@@ -0,0 +1,58 @@
+#ifndef LABELFORMATS_H
+#define LABELFORMATS_H
+
+#include "formattemplate.h"
+#include "deviceporttypes.h"
+#include "coreutils.h"
+
+namespace Core = Utilities::Core;
+
+using LabelFormatValues_t = std::array<std::string_view, static_cast<size_t>(Data::LabelFormatVariable::LabelFormatVariablesCount)>;
+
+/* This class stores the compiled description and label formats of all device port types
+   The built-in formats are compiled once (when first requesting the instance) and then (if available) the custom ones from the label formats file are applied on top of them
+*/
+class LabelFormats
+{
+public:
+    static std::shared_ptr<LabelFormats> getInstance();
+
+    /* Writes the description and label of a device port by running the compiled formats on the provided values
+       The previous content of the two strings is discarded
+    */
+    void render(const Data::LabelFormatID formatID, const LabelFormatValues_t& values, std::string& description, std::string& label) const;
+
+    /* Hash of the label formats file content (0 if no file), used for detecting that the previously calculated labels might no longer be valid
+    */
+    std::uint64_t getContentHash() const;
+
+private:
+    /* Private constructor (singleton)
+    */
+    LabelFormats();
+
+    /* Compiles the built-in formats and then the custom formats (if any)
+    */
+    void _init();
+
+    /* Reads the label formats file. Each row (except the header) should contain: format name, description format, label format
+       An empty format cell means the built-in format is kept. Invalid formats are discarded with a warning (built-in format kept as well)
+    */
+    void _loadCustomFormats(const Core::Path_t& labelFormatsFile);
+
+    bool _compileFormat(const size_t formatIndex, const std::string_view descriptionFormat, const std::string_view labelFormat);
+
+    struct CompiledLabelFormat
+    {
+        Core::FormatTemplate mDescriptionFormat;
+        Core::FormatTemplate mLabelFormat;
+    };
+
+    static std::shared_ptr<LabelFormats> s_pLabelFormats;
+
+    std::array<CompiledLabelFormat, static_cast<size_t>(Data::LabelFormatID::LabelFormatsCount)> mCompiledFormats;
+
+    std::uint64_t mContentHash;
+};
+
+#endif // LABELFORMATS_H
@@ -11,13 +11,18 @@ PDUPort::PDUPort(const std::string_view deviceUPosition, const size_t fileRowNum
 {
 }
 
-void PDUPort::updateDescriptionAndLabel()
+void PDUPort::_updateDescriptionAndLabel()
 {
     Core::convertStringCase(mDevicePlacementType, true);
 
     if (auto devicePlacementTypeIt{Data::c_DevicePlacementIdentifiers.find(mDevicePlacementType)}; Data::c_DevicePlacementIdentifiers.cend() != devicePlacementTypeIt)
     {
-        const std::string c_DevicePlacementTypeDescription{"H" == devicePlacementTypeIt->first ? " in horizontal position" : " on the " + devicePlacementTypeIt->second + " side"};
+        mDevicePlacementDescription = "H" == devicePlacementTypeIt->first ? "in horizontal position" : "on the " + devicePlacementTypeIt->second + " side";
+
+        _setLabelFormatValue(Data::LabelFormatVariable::PLACEMENT, mDevicePlacementType);
+        _setLabelFormatValue(Data::LabelFormatVariable::PLACEMENT_DESCRIPTION, mDevicePlacementDescription);
+        _setLabelFormatValue(Data::LabelFormatVariable::LOAD_SEGMENT_NUMBER, mLoadSegmentNumber);
+        _setLabelFormatValue(Data::LabelFormatVariable::PORT_NUMBER, mPortNumber);
 
         Core::convertStringCase(mPortNumber, true);
 
@@ -25,8 +30,7 @@ void PDUPort::updateDescriptionAndLabel()
         {
             if (Core::isDigitString(mPortNumber))
             {
-                _appendDataToDescription(c_DevicePlacementTypeDescription + " - load segment number " + mLoadSegmentNumber + " - port number " + mPortNumber);
-                _appendDataToLabel("_" + mDevicePlacementType + "_P" + mLoadSegmentNumber + "." + mPortNumber);
+                _applyLabelFormat(Data::LabelFormatID::PDU_LOAD_SEGMENT_PORT);
             }
             else
             {
@@ -37,18 +41,15 @@ void PDUPort::updateDescriptionAndLabel()
         {
             if (Core::isDigitString(mPortNumber))
             {
-                _appendDataToDescription(c_DevicePlacementTypeDescription + " - port number " + mPortNumber);
-                _appendDataToLabel("_" + mDevicePlacementType + "_P" + mPortNumber);
+                _applyLabelFormat(Data::LabelFormatID::PDU_PORT);
             }
             else if (Ports::isManagementPortNumber(mPortNumber)) // management port
             {
-                _appendDataToDescription(c_DevicePlacementTypeDescription + " - management port");
-                _appendDataToLabel("_" + mDevicePlacementType + "_MGMT");
+                _applyLabelFormat(Data::LabelFormatID::PDU_MANAGEMENT_PORT);
             }
             else if ("IN" == mPortNumber)
             {
-                _appendDataToDescription(c_DevicePlacementTypeDescription + " - port number IN");
-                _appendDataToLabel("_" + mDevicePlacementType + "_IN");
+                _applyLabelFormat(Data::LabelFormatID::PDU_IN_PORT);
             }
             else
             {
@@ -68,16 +69,31 @@ void PDUPort::updateDescriptionAndLabel()
     _checkLabel();
 }
 
-void PDUPort::_registerRequiredParameters()
+std::string* PDUPort::_getRequiredParameter(const Data::PortParameterID parameterID)
 {
-    _registerRequiredParameter(&mDevicePlacementType);
-    _registerRequiredParameter(&mLoadSegmentNumber);
-    _registerRequiredParameter(&mPortNumber);
+    std::string* pRequiredParameter{nullptr};
+
+    switch(parameterID)
+    {
+    case Data::PortParameterID::PLACEMENT:
+        pRequiredParameter = &mDevicePlacementType;
+        break;
+    case Data::PortParameterID::LOAD_SEGMENT_NUMBER:
+        pRequiredParameter = &mLoadSegmentNumber;
+        break;
+    case Data::PortParameterID::PORT_NUMBER:
+        pRequiredParameter = &mPortNumber;
+        break;
+    default:
+        break;
+    }
+
+    return pRequiredParameter;
 }
 
-size_t PDUPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& PDUPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::PDU);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::PDU);
 }
 
 std::pair<std::string, std::string> PDUPort::_getDeviceTypeDescriptionAndLabel() const
@@ -92,7 +108,7 @@ ExtensionBarPort::ExtensionBarPort(const std::string_view deviceUPosition, const
 {
 }
 
-void ExtensionBarPort::updateDescriptionAndLabel()
+void ExtensionBarPort::_updateDescriptionAndLabel()
 {
     Core::convertStringCase(mDevicePlacementType, true);
 
@@ -100,19 +116,21 @@ void ExtensionBarPort::updateDescriptionAndLabel()
     {
         if (auto devicePlacementTypeIt{Data::c_DevicePlacementIdentifiers.find(mDevicePlacementType)}; Data::c_DevicePlacementIdentifiers.cend() != devicePlacementTypeIt)
         {
-            const std::string c_DevicePlacementTypeDescription{" on the " + devicePlacementTypeIt->second + " side"};
+            mDevicePlacementDescription = "on the " + devicePlacementTypeIt->second + " side";
+
+            _setLabelFormatValue(Data::LabelFormatVariable::PLACEMENT, mDevicePlacementType);
+            _setLabelFormatValue(Data::LabelFormatVariable::PLACEMENT_DESCRIPTION, mDevicePlacementDescription);
+            _setLabelFormatValue(Data::LabelFormatVariable::PORT_NUMBER, mPortNumber);
 
             Core::convertStringCase(mPortNumber, true);
 
             if (Core::isDigitString(mPortNumber))
             {
-                _appendDataToDescription(c_DevicePlacementTypeDescription + " - port number " + mPortNumber);
-                _appendDataToLabel("_" + mDevicePlacementType + "_P" + mPortNumber);
+                _applyLabelFormat(Data::LabelFormatID::EXTENSION_BAR_PORT);
             }
             else if ("IN" == mPortNumber)
             {
-                _appendDataToDescription(c_DevicePlacementTypeDescription + " - port number IN");
-                _appendDataToLabel("_" + mDevicePlacementType + "_IN");
+                _applyLabelFormat(Data::LabelFormatID::EXTENSION_BAR_IN_PORT);
             }
             else
             {
@@ -132,15 +150,28 @@ void ExtensionBarPort::updateDescriptionAndLabel()
     _checkLabel();
 }
 
-void ExtensionBarPort::_registerRequiredParameters()
+std::string* ExtensionBarPort::_getRequiredParameter(const Data::PortParameterID parameterID)
 {
-    _registerRequiredParameter(&mDevicePlacementType);
-    _registerRequiredParameter(&mPortNumber);
+    std::string* pRequiredParameter{nullptr};
+
+    switch(parameterID)
+    {
+    case Data::PortParameterID::PLACEMENT:
+        pRequiredParameter = &mDevicePlacementType;
+        break;
+    case Data::PortParameterID::PORT_NUMBER:
+        pRequiredParameter = &mPortNumber;
+        break;
+    default:
+        break;
+    }
+
+    return pRequiredParameter;
 }
 
-size_t ExtensionBarPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& ExtensionBarPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::EXTENSION_BAR);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::EXTENSION_BAR);
 }
 
 std::pair<std::string, std::string> ExtensionBarPort::_getDeviceTypeDescriptionAndLabel() const
@@ -155,14 +186,16 @@ UPSPort::UPSPort(const std::string_view deviceUPosition, const size_t fileRowNum
 {
 }
 
-void UPSPort::updateDescriptionAndLabel()
+void UPSPort::_updateDescriptionAndLabel()
 {
+    _setLabelFormatValue(Data::LabelFormatVariable::LOAD_SEGMENT_NUMBER, mLoadSegmentNumber);
+    _setLabelFormatValue(Data::LabelFormatVariable::PORT_NUMBER, mPortNumber);
+
     if (Core::isDigitString(mLoadSegmentNumber))
     {
         if (Core::isDigitString(mPortNumber)) // power port
         {
-            _appendDataToDescription(" - load segment " + mLoadSegmentNumber + " - port " + mPortNumber);
-            _appendDataToLabel("_P" + mLoadSegmentNumber + "." + mPortNumber);
+            _applyLabelFormat(Data::LabelFormatID::UPS_PORT);
         }
         else
         {
@@ -173,8 +206,7 @@ void UPSPort::updateDescriptionAndLabel()
     {
         if (Ports::isManagementPortNumber(mPortNumber)) // management port
         {
-            _appendDataToDescription(" - management port");
-            _appendDataToLabel("_MGMT");
+            _applyLabelFormat(Data::LabelFormatID::UPS_MANAGEMENT_PORT);
         }
         else
         {
@@ -189,15 +221,28 @@ void UPSPort::updateDescriptionAndLabel()
     _checkLabel();
 }
 
-void UPSPort::_registerRequiredParameters()
+std::string* UPSPort::_getRequiredParameter(const Data::PortParameterID parameterID)
 {
-    _registerRequiredParameter(&mLoadSegmentNumber);
-    _registerRequiredParameter(&mPortNumber);
+    std::string* pRequiredParameter{nullptr};
+
+    switch(parameterID)
+    {
+    case Data::PortParameterID::LOAD_SEGMENT_NUMBER:
+        pRequiredParameter = &mLoadSegmentNumber;
+        break;
+    case Data::PortParameterID::PORT_NUMBER:
+        pRequiredParameter = &mPortNumber;
+        break;
+    default:
+        break;
+    }
+
+    return pRequiredParameter;
 }
 
-size_t UPSPort::_getInputParametersCount() const
+const Data::DevicePortSchema_t& UPSPort::_getSchema() const
 {
-    return Data::c_RequiredInputParamsCount.at(Data::DeviceTypeID::UPS);
+    return Data::getDevicePortSchema(Data::DeviceTypeID::UPS);
 }
 
 std::pair<std::string, std::string> UPSPort::_getDeviceTypeDescriptionAndLabel() const
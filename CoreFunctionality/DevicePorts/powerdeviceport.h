@@ -10,15 +10,15 @@ public:
     PDUPort() = delete;
     PDUPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
-    virtual void updateDescriptionAndLabel() override;
-
 protected:
-    virtual void _registerRequiredParameters() override;
-    virtual size_t _getInputParametersCount() const override;
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 
 private:
     std::string mDevicePlacementType; // rack placement (vertical left/right, horizontal)
+    std::string mDevicePlacementDescription;
     std::string mLoadSegmentNumber;
     std::string mPortNumber;
 };
@@ -30,15 +30,15 @@ public:
     ExtensionBarPort() = delete;
     ExtensionBarPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
-    virtual void updateDescriptionAndLabel() override;
-
 protected:
-    virtual void _registerRequiredParameters() override;
-    virtual size_t _getInputParametersCount() const override;
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 
 private:
     std::string mDevicePlacementType; // rack placement (left/right)
+    std::string mDevicePlacementDescription;
     std::string mPortNumber;
 };
 
@@ -49,11 +49,10 @@ public:
     UPSPort() = delete;
     UPSPort(const std::string_view deviceUPosition, const size_t fileRowNumber, const bool isSourceDevice);
 
-    virtual void updateDescriptionAndLabel() override;
-
 protected:
-    virtual void _registerRequiredParameters() override;
-    virtual size_t _getInputParametersCount() const override;
+    virtual void _updateDescriptionAndLabel() override;
+    virtual std::string* _getRequiredParameter(const Data::PortParameterID parameterID) override;
+    virtual const Data::DevicePortSchema_t& _getSchema() const override;
     virtual std::pair<std::string, std::string> _getDeviceTypeDescriptionAndLabel() const override;
 
 private:
@@ -0,0 +1,119 @@
+#include "errorhandler.h"
+#include "aggregatederrorreport.h"
+
+AggregatedErrorReport::AggregatedErrorReport(const Core::ErrorStreamPtr pErrorStream)
+    : mpErrorStream{pErrorStream}
+    , mErrorsCount{0u}
+{
+    ASSERT(mpErrorStream && mpErrorStream->good(), "");
+}
+
+void AggregatedErrorReport::addError(const ErrorPtr pError)
+{
+    if (pError)
+    {
+        const Core::Error_t c_ErrorCode{pError->getErrorCode()};
+        const size_t c_FileColumnNumber{pError->getFileColumnNumber()};
+        const auto [c_It, c_IsNewGroup]{mErrorGroupIndexes.try_emplace(_getErrorGroupKey(c_ErrorCode, c_FileColumnNumber), mErrorGroups.size())};
+
+        if (c_IsNewGroup)
+        {
+            mErrorGroups.push_back({c_ErrorCode, c_FileColumnNumber, 0u, {}, 0u, 0u, {}});
+        }
+
+        ErrorGroup_t& errorGroup{mErrorGroups[c_It->second]};
+
+        _addRowNumber(errorGroup, pError->getFileRowNumber());
+        ++errorGroup.mErrorsCount;
+
+        if (errorGroup.mExamples.size() < scExamplesCount)
+        {
+            errorGroup.mExamples.push_back(pError);
+        }
+
+        ++mErrorsCountPerCode[c_ErrorCode];
+        ++mErrorsCount;
+    }
+}
+
+void AggregatedErrorReport::write()
+{
+    if (mpErrorStream && mpErrorStream->good() && mErrorsCount > 0u)
+    {
+        *mpErrorStream << "Aggregated error report: " << mErrorsCount << (1u == mErrorsCount ? " error" : " errors") << ", "
+                       << mErrorGroups.size() << (1u == mErrorGroups.size() ? " distinct problem" : " distinct problems") << " (error code and column)\n\n";
+
+        *mpErrorStream << "Errors per error code:\n";
+
+        for (const auto& [c_ErrorCode, c_ErrorsCount] : mErrorsCountPerCode)
+        {
+            *mpErrorStream << "Error code " << c_ErrorCode << " (" << ErrorHandler::getErrorName(c_ErrorCode) << "): " << c_ErrorsCount << "\n";
+        }
+
+        *mpErrorStream << "\n";
+
+        for (size_t groupIndex{0u}; groupIndex < mErrorGroups.size(); ++groupIndex)
+        {
+            _writeErrorGroup(groupIndex + 1, mErrorGroups[groupIndex]);
+        }
+    }
+}
+
+void AggregatedErrorReport::_addRowNumber(ErrorGroup_t& errorGroup, const size_t fileRowNumber)
+{
+    const bool c_IsRangeContinued{errorGroup.mErrorsCount > 0u && fileRowNumber >= errorGroup.mLastRowNumber && fileRowNumber <= errorGroup.mLastRowNumber + 1};
+
+    // once the listed ranges are exhausted the following ones are only counted
+    if (c_IsRangeContinued && 0u == errorGroup.mUnlistedRowRangesCount)
+    {
+        errorGroup.mRowRanges.back().mLastRowNumber = fileRowNumber;
+    }
+    else if (!c_IsRangeContinued && errorGroup.mRowRanges.size() < scMaxListedRowRangesCount)
+    {
+        errorGroup.mRowRanges.push_back({fileRowNumber, fileRowNumber});
+    }
+    else if (!c_IsRangeContinued)
+    {
+        ++errorGroup.mUnlistedRowRangesCount;
+    }
+
+    errorGroup.mLastRowNumber = fileRowNumber;
+}
+
+void AggregatedErrorReport::_writeErrorGroup(const size_t groupNumber, const ErrorGroup_t& errorGroup)
+{
+    *mpErrorStream << "Problem " << groupNumber << ": error code " << errorGroup.mErrorCode << " (" << ErrorHandler::getErrorName(errorGroup.mErrorCode) << "), column "
+                   << errorGroup.mFileColumnNumber << ", " << errorGroup.mErrorsCount << (1u == errorGroup.mErrorsCount ? " error" : " errors") << "\n";
+
+    *mpErrorStream << (1u == errorGroup.mRowRanges.size() && errorGroup.mRowRanges[0].mFirstRowNumber == errorGroup.mRowRanges[0].mLastRowNumber ? "Row: " : "Rows: ");
+
+    for (size_t rangeIndex{0u}; rangeIndex < errorGroup.mRowRanges.size(); ++rangeIndex)
+    {
+        const RowRange_t& c_RowRange{errorGroup.mRowRanges[rangeIndex]};
+
+        *mpErrorStream << (rangeIndex > 0u ? ", " : "") << c_RowRange.mFirstRowNumber;
+
+        if (c_RowRange.mLastRowNumber > c_RowRange.mFirstRowNumber)
+        {
+            *mpErrorStream << "-" << c_RowRange.mLastRowNumber;
+        }
+    }
+
+    if (errorGroup.mUnlistedRowRangesCount > 0u)
+    {
+        *mpErrorStream << " and " << errorGroup.mUnlistedRowRangesCount << " more " << (1u == errorGroup.mUnlistedRowRangesCount ? "range" : "ranges");
+    }
+
+    *mpErrorStream << "\n" << (errorGroup.mErrorsCount > errorGroup.mExamples.size() ? "First errors:" : "Errors:") << "\n\n";
+
+    for (const auto& c_pExample : errorGroup.mExamples)
+    {
+        c_pExample->execute();
+    }
+}
+
+std::uint64_t AggregatedErrorReport::_getErrorGroupKey(const Core::Error_t errorCode, const size_t fileColumnNumber)
+{
+    // the error code fits into the upper bits (the column number is far below 2^48)
+    return (static_cast<std::uint64_t>(errorCode) << 48u) | static_cast<std::uint64_t>(fileColumnNumber);
+}
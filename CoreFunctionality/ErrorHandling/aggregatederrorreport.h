@@ -0,0 +1,66 @@
+#ifndef AGGREGATEDERRORREPORT_H
+#define AGGREGATEDERRORREPORT_H
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "error.h"
+
+/* Error report grouping the errors by error code and column (each group being a distinct problem, e.g. a missing padding column on each row) instead of logging each error separately
+   The errors are grouped in a single pass (hashed by error code and column), the consecutive rows of each group being compressed into ranges (e.g. rows 2-40512)
+   For each group only the number of errors, the row ranges and the first few errors (examples) are logged, so the report size depends on the number of distinct problems, not on the number of errors
+*/
+class AggregatedErrorReport
+{
+public:
+    AggregatedErrorReport() = delete;
+    explicit AggregatedErrorReport(const Core::ErrorStreamPtr pErrorStream);
+
+    AggregatedErrorReport(const AggregatedErrorReport&) = delete;
+    AggregatedErrorReport& operator=(const AggregatedErrorReport&) = delete;
+
+    /* The errors are expected in file order (rows that are not consecutive start a new range)
+    */
+    void addError(const ErrorPtr pError);
+
+    /* Logs the number of errors per error code followed by the groups, in the order of their first error
+    */
+    void write();
+
+private:
+    struct RowRange_t
+    {
+        size_t mFirstRowNumber;
+        size_t mLastRowNumber;
+    };
+
+    struct ErrorGroup_t
+    {
+        Core::Error_t mErrorCode;
+        size_t mFileColumnNumber;
+        size_t mErrorsCount;
+        std::vector<RowRange_t> mRowRanges;     // listed ranges (at most scMaxListedRowRangesCount)
+        size_t mUnlistedRowRangesCount;
+        size_t mLastRowNumber;                  // row of the last error added to the group (whether its range is listed or not)
+        std::vector<ErrorPtr> mExamples;        // first errors of the group (at most scExamplesCount)
+    };
+
+    void _addRowNumber(ErrorGroup_t& errorGroup, const size_t fileRowNumber);
+    void _writeErrorGroup(const size_t groupNumber, const ErrorGroup_t& errorGroup);
+
+    static std::uint64_t _getErrorGroupKey(const Core::Error_t errorCode, const size_t fileColumnNumber);
+
+    const Core::ErrorStreamPtr mpErrorStream;
+
+    std::vector<ErrorGroup_t> mErrorGroups;
+    std::unordered_map<std::uint64_t, size_t> mErrorGroupIndexes;   // key: error code and column
+    std::map<Core::Error_t, size_t> mErrorsCountPerCode;
+    size_t mErrorsCount;
+
+    static constexpr size_t scExamplesCount{3u};
+    static constexpr size_t scMaxListedRowRangesCount{100u};
+};
+
+#endif // AGGREGATEDERRORREPORT_H
@@ -11,7 +11,7 @@ Error::Error(Core::Error_t errorCode, const size_t fileRowNumber, const size_t f
 
     ASSERT(c_ErrorCode > 0u && c_ErrorCode < static_cast<Core::Error_t>(ErrorCode::ErrorCodesUpperBound), "");
     ASSERT(mFileRowNumber > 0u && mFileColumnNumber > 0u, "");
-    ASSERT(mpErrorStream && mpErrorStream->is_open(), "");
+    ASSERT(mpErrorStream && mpErrorStream->good(), "");
 }
 
 Error::~Error()
@@ -20,7 +20,7 @@ Error::~Error()
 
 void Error::execute()
 {
-    if (mpErrorStream && mpErrorStream->is_open())
+    if (mpErrorStream && mpErrorStream->good())
     {
         *mpErrorStream << "Error code: " << mErrorCode << "\n\n";
     }
@@ -32,9 +32,19 @@ Core::Error_t Error::getErrorCode() const
     return mErrorCode;
 }
 
+size_t Error::getFileRowNumber() const
+{
+    return mFileRowNumber;
+}
+
+size_t Error::getFileColumnNumber() const
+{
+    return mFileColumnNumber;
+}
+
 void Error::_logMessage(std::string_view message, bool shouldPrependErrorLabel)
 {
-    if (mpErrorStream && mpErrorStream->is_open())
+    if (mpErrorStream && mpErrorStream->good())
     {
         if (shouldPrependErrorLabel)
         {
@@ -47,7 +57,7 @@ void Error::_logMessage(std::string_view message, bool shouldPrependErrorLabel)
 
 void Error::_logRowAndColumnNumber()
 {
-    if (mpErrorStream && mpErrorStream->is_open())
+    if (mpErrorStream && mpErrorStream->good())
     {
         *mpErrorStream << "Row number: " << mFileRowNumber << "    " << "Column number: " << mFileColumnNumber << "\n";
     }
@@ -55,7 +65,7 @@ void Error::_logRowAndColumnNumber()
 
 void Error::_logRowNumber()
 {
-    if (mpErrorStream && mpErrorStream->is_open())
+    if (mpErrorStream && mpErrorStream->good())
     {
         *mpErrorStream << "Row number: " << mFileRowNumber << "\n";
     }
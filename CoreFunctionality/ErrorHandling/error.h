@@ -14,6 +14,8 @@ public:
     virtual void execute();
 
     Core::Error_t getErrorCode() const;
+    size_t getFileRowNumber() const;
+    size_t getFileColumnNumber() const;
 
 protected:
     void _logMessage(std::string_view message, bool shouldPrependErrorLabel = false);
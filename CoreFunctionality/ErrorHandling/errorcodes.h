@@ -15,6 +15,8 @@ enum class ErrorCode : unsigned short
     INVALID_U_POSITION_VALUE,
     EMPTY_CONNECTION_INPUT_FILE,
     NO_CONNECTIONS_DEFINED,
+    DUPLICATE_DEVICE_PORT,
+    DUPLICATE_LABEL,
     ErrorCodesUpperBound
 };
 
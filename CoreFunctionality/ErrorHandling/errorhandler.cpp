@@ -5,16 +5,17 @@
 ErrorHandler::ErrorHandler(const Core::ErrorStreamPtr pErrorStream)
     : mpErrorStream{pErrorStream}
 {
-    ASSERT(mpErrorStream && mpErrorStream->is_open(), "");
+    ASSERT(mpErrorStream && mpErrorStream->good(), "");
 }
 
 ErrorPtr ErrorHandler::logError(const Core::Error_t errorCode,
                                 const size_t fileRowNumber,
-                                const size_t fileColumnNumber)
+                                const size_t fileColumnNumber,
+                                const size_t relatedFileRowNumber)
 {
     ErrorPtr pError{nullptr};
 
-    if (mpErrorStream && mpErrorStream->is_open())
+    if (mpErrorStream && mpErrorStream->good())
     {
         switch(static_cast<ErrorCode>(errorCode))
         {
@@ -54,6 +55,12 @@ ErrorPtr ErrorHandler::logError(const Core::Error_t errorCode,
         case ErrorCode::NO_CONNECTIONS_DEFINED:
             pError = std::make_shared<NoConnectionsDefinedError>(mpErrorStream);
             break;
+        case ErrorCode::DUPLICATE_DEVICE_PORT:
+            pError = std::make_shared<DuplicateDevicePortError>(fileRowNumber, fileColumnNumber, relatedFileRowNumber, mpErrorStream);
+            break;
+        case ErrorCode::DUPLICATE_LABEL:
+            pError = std::make_shared<DuplicateLabelError>(fileRowNumber, fileColumnNumber, relatedFileRowNumber, mpErrorStream);
+            break;
         default:
             ASSERT(false, "");
         }
@@ -61,3 +68,58 @@ ErrorPtr ErrorHandler::logError(const Core::Error_t errorCode,
 
     return pError;
 }
+
+std::string_view ErrorHandler::getErrorName(const Core::Error_t errorCode)
+{
+    std::string_view errorName;
+
+    switch(static_cast<ErrorCode>(errorCode))
+    {
+    case ErrorCode::EMPTY_CELL:
+        errorName = "empty cell";
+        break;
+    case ErrorCode::UNKNOWN_DEVICE:
+        errorName = "unknown device";
+        break;
+    case ErrorCode::FEWER_CELLS:
+        errorName = "fewer cells";
+        break;
+    case ErrorCode::INVALID_CONNECTION_FORMAT:
+        errorName = "invalid connection format";
+        break;
+    case ErrorCode::DEVICE_U_POSITION_OUT_OF_RANGE:
+        errorName = "device U position out of range";
+        break;
+    case ErrorCode::TARGET_DEVICE_NOT_FOUND:
+        errorName = "target device not found";
+        break;
+    case ErrorCode::DEVICE_CONNECTED_TO_ITSELF:
+        errorName = "device connected to itself";
+        break;
+    case ErrorCode::NULL_NR_OF_CONNECTIONS:
+        errorName = "null number of connections";
+        break;
+    case ErrorCode::INVALID_CHARACTERS:
+        errorName = "invalid characters";
+        break;
+    case ErrorCode::INVALID_U_POSITION_VALUE:
+        errorName = "invalid U position value";
+        break;
+    case ErrorCode::EMPTY_CONNECTION_INPUT_FILE:
+        errorName = "empty connection input file";
+        break;
+    case ErrorCode::NO_CONNECTIONS_DEFINED:
+        errorName = "no connections defined";
+        break;
+    case ErrorCode::DUPLICATE_DEVICE_PORT:
+        errorName = "duplicate device port";
+        break;
+    case ErrorCode::DUPLICATE_LABEL:
+        errorName = "duplicate label";
+        break;
+    default:
+        break;
+    }
+
+    return errorName;
+}
@@ -12,8 +12,13 @@ public:
     /* This function is responsible for creating the actual error objects which are then used for logging parsing errors into error file
        An additional info string parameter could be added in case passing additional information to error objects is needed in the future
        Data items passed through this parameter should be separated by comma (',') similar to CSV cells
+       The related row is only used by the errors referring to another row (e.g. the row where a duplicate device port has been used first)
     */
-    ErrorPtr logError(const Core::Error_t errorCode, const size_t fileRowNumber, const size_t fileColumnNumber);
+    ErrorPtr logError(const Core::Error_t errorCode, const size_t fileRowNumber, const size_t fileColumnNumber, const size_t relatedFileRowNumber = 0u);
+
+    /* Short description of the error code (e.g. for error summaries), empty for an unknown code
+    */
+    static std::string_view getErrorName(const Core::Error_t errorCode);
 
 private:
     const Core::ErrorStreamPtr mpErrorStream;
@@ -173,3 +173,35 @@ void NoConnectionsDefinedError::execute()
 
     Error::execute();
 }
+
+DuplicateDevicePortError::DuplicateDevicePortError(const size_t fileRowNumber, const size_t fileColumnNumber, const size_t firstFileRowNumber, const Core::ErrorStreamPtr pErrorStream)
+    : Error{static_cast<Core::Error_t>(ErrorCode::DUPLICATE_DEVICE_PORT), fileRowNumber, fileColumnNumber, pErrorStream}
+    , mFirstFileRowNumber{firstFileRowNumber}
+{
+}
+
+void DuplicateDevicePortError::execute()
+{
+    _logMessage("the device port is connected more than once.", true);
+    _logMessage("The same port (device type, U position and port parameters) has already been used on row " + std::to_string(mFirstFileRowNumber) + ".");
+    _logMessage("Each device port should only be used by one connection.");
+    _logRowAndColumnNumber();
+
+    Error::execute();
+}
+
+DuplicateLabelError::DuplicateLabelError(const size_t fileRowNumber, const size_t fileColumnNumber, const size_t firstFileRowNumber, const Core::ErrorStreamPtr pErrorStream)
+    : Error{static_cast<Core::Error_t>(ErrorCode::DUPLICATE_LABEL), fileRowNumber, fileColumnNumber, pErrorStream}
+    , mFirstFileRowNumber{firstFileRowNumber}
+{
+}
+
+void DuplicateLabelError::execute()
+{
+    _logMessage("the label of the device port is not unique.", true);
+    _logMessage("The same label has already been calculated for another device port on row " + std::to_string(mFirstFileRowNumber) + ".");
+    _logMessage("Please check the port parameters and the label formats (each label format should distinguish the ports it applies to).");
+    _logRowAndColumnNumber();
+
+    Error::execute();
+}
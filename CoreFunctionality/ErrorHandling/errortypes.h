@@ -96,4 +96,26 @@ public:
     virtual void execute() override;
 };
 
+// device port connected on more than one row of the connection input file (or connected to itself)
+class DuplicateDevicePortError final : public Error
+{
+public:
+    DuplicateDevicePortError(const size_t fileRowNumber, const size_t fileColumnNumber, const size_t firstFileRowNumber, const Core::ErrorStreamPtr pErrorStream);
+    virtual void execute() override;
+
+private:
+    const size_t mFirstFileRowNumber;   // row where the device port has been used first
+};
+
+// same label calculated for two different device ports of the connection input file
+class DuplicateLabelError final : public Error
+{
+public:
+    DuplicateLabelError(const size_t fileRowNumber, const size_t fileColumnNumber, const size_t firstFileRowNumber, const Core::ErrorStreamPtr pErrorStream);
+    virtual void execute() override;
+
+private:
+    const size_t mFirstFileRowNumber;   // row where the label has been calculated first
+};
+
 #endif // ERRORTYPES_H
@@ -0,0 +1,82 @@
+#include "connectionconflictdetector.h"
+
+ConnectionConflictDetector::ConnectionConflictDetector()
+{
+    clear();
+}
+
+size_t ConnectionConflictDetector::addDevicePort(const std::uint64_t portHash, const size_t fileRowNumber)
+{
+    return _addHash(mDevicePortsIndex, portHash, fileRowNumber);
+}
+
+size_t ConnectionConflictDetector::addLabel(const std::string_view label, const size_t fileRowNumber)
+{
+    return _addHash(mLabelsIndex, Core::getHash64(label), fileRowNumber);
+}
+
+void ConnectionConflictDetector::clear()
+{
+    for (auto pHashIndex : {&mDevicePortsIndex, &mLabelsIndex})
+    {
+        pHashIndex->mEntries.assign(scInitialHashIndexSize, {0u, 0u});
+        pHashIndex->mUsedEntriesCount = 0u;
+    }
+}
+
+size_t ConnectionConflictDetector::_addHash(HashIndex_t& hashIndex, const std::uint64_t hash, const size_t fileRowNumber)
+{
+    size_t firstFileRowNumber{0u};
+
+    if (fileRowNumber > 0u)
+    {
+        // at most half of the entries are used so a free entry is always found after a few probes
+        if (2 * (hashIndex.mUsedEntriesCount + 1) > hashIndex.mEntries.size())
+        {
+            _growHashIndex(hashIndex);
+        }
+
+        const size_t c_IndexMask{hashIndex.mEntries.size() - 1};
+        size_t entryIndex{static_cast<size_t>(hash) & c_IndexMask};
+
+        while (0u != hashIndex.mEntries[entryIndex].mFirstFileRowNumber && hash != hashIndex.mEntries[entryIndex].mHash)
+        {
+            entryIndex = (entryIndex + 1) & c_IndexMask;
+        }
+
+        if (HashIndexEntry_t& entry{hashIndex.mEntries[entryIndex]}; 0u == entry.mFirstFileRowNumber)
+        {
+            entry = {hash, fileRowNumber};
+            ++hashIndex.mUsedEntriesCount;
+        }
+        else
+        {
+            firstFileRowNumber = entry.mFirstFileRowNumber;
+        }
+    }
+
+    return firstFileRowNumber;
+}
+
+void ConnectionConflictDetector::_growHashIndex(HashIndex_t& hashIndex)
+{
+    std::vector<HashIndexEntry_t> entries(2 * hashIndex.mEntries.size(), {0u, 0u});
+    const size_t c_IndexMask{entries.size() - 1};
+
+    for (const auto& c_Entry : hashIndex.mEntries)
+    {
+        if (0u != c_Entry.mFirstFileRowNumber)
+        {
+            size_t entryIndex{static_cast<size_t>(c_Entry.mHash) & c_IndexMask};
+
+            while (0u != entries[entryIndex].mFirstFileRowNumber)
+            {
+                entryIndex = (entryIndex + 1) & c_IndexMask;
+            }
+
+            entries[entryIndex] = c_Entry;
+        }
+    }
+
+    hashIndex.mEntries = std::move(entries);
+}
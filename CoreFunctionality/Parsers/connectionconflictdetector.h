@@ -0,0 +1,61 @@
+#ifndef CONNECTIONCONFLICTDETECTOR_H
+#define CONNECTIONCONFLICTDETECTOR_H
+
+#include <vector>
+
+#include "coreutils.h"
+
+namespace Core = Utilities::Core;
+
+/* This class detects the device ports used by more than one connection (connection input row) and the labels calculated for more than one device port
+   Each device port is identified by its (normalized) port hash (see DevicePort::getPortHash()) and each label by the hash of its text, the hashes being indexed together with the row they first occurred on
+   The check is done in a single pass, each device port requiring a constant number of index operations and a fixed amount of memory (no port data or label text is stored)
+*/
+class ConnectionConflictDetector
+{
+public:
+    ConnectionConflictDetector();
+
+    ConnectionConflictDetector(const ConnectionConflictDetector&) = delete;
+    ConnectionConflictDetector& operator=(const ConnectionConflictDetector&) = delete;
+
+    /* Returns the row the device port has been first used on, or 0 if not used before (in which case it is recorded for the given row)
+    */
+    size_t addDevicePort(const std::uint64_t portHash, const size_t fileRowNumber);
+
+    /* Returns the row the label has been first calculated on, or 0 if not calculated before (in which case it is recorded for the given row)
+    */
+    size_t addLabel(const std::string_view label, const size_t fileRowNumber);
+
+    /* The recorded device ports and labels are discarded (required before checking another input file)
+    */
+    void clear();
+
+private:
+    struct HashIndexEntry_t
+    {
+        std::uint64_t mHash;
+        size_t mFirstFileRowNumber;             // 0: free entry (the file rows start at 1)
+    };
+
+    /* Open addressing (linear probing) in a flat table: no allocation per entry, 16 bytes per entry and at most half of the entries used
+       This keeps the index compact and cache friendly for a million connections (std::unordered_map allocates a node per entry)
+    */
+    struct HashIndex_t
+    {
+        std::vector<HashIndexEntry_t> mEntries; // the size is a power of 2
+        size_t mUsedEntriesCount;
+    };
+
+    static size_t _addHash(HashIndex_t& hashIndex, const std::uint64_t hash, const size_t fileRowNumber);
+    static void _growHashIndex(HashIndex_t& hashIndex);
+
+    HashIndex_t mDevicePortsIndex;
+    HashIndex_t mLabelsIndex;
+
+    static constexpr size_t scInitialHashIndexSize{1024u};
+};
+
+using ConnectionConflictDetectorPtr = std::shared_ptr<ConnectionConflictDetector>;
+
+#endif // CONNECTIONCONFLICTDETECTOR_H
@@ -13,27 +13,16 @@ ConnectionDefinitionParser::ConnectionDefinitionParser(const Core::InputStreamPt
     mRackPositionToDeviceDataMapping.resize(Data::c_MaxRackUnitsCount); // initial value: no device
 }
 
-// Maximum 50 lines to be read from connection definition file (the rack can have maximum 50U)
+/* Maximum 50 lines to be read from connection definition file (the rack can have maximum 50U)
+   The payload rows are read one by one while being parsed (see _parseInput()) so no more input is read once the maximum number of errors is reached
+*/
 void ConnectionDefinitionParser::_readPayload()
 {
-    size_t connectionDefinitionRowsCount{0u};
-
-    while (!_isInputStreamConsumed() && connectionDefinitionRowsCount < Data::c_MaxRackUnitsCount)
-    {
-        const bool c_Success{_readLineAndAppendToInput()};
-
-        if (c_Success)
-        {
-            ++connectionDefinitionRowsCount;
-        }
-    }
 }
 
 bool ConnectionDefinitionParser::_parseInput()
 {
-    const size_t c_ConnectionDefinitionRowsCount{_getInputRowsCount()};
-
-    for (size_t rowIndex{0u}; rowIndex < c_ConnectionDefinitionRowsCount; ++rowIndex)
+    for (size_t rowIndex{0u}; rowIndex < Data::c_MaxRackUnitsCount && !_isErrorsLimitReached() && _readPayloadRow(); ++rowIndex)
     {
         _moveToInputRowStart(rowIndex);
         std::string currentCell;
@@ -51,6 +40,12 @@ bool ConnectionDefinitionParser::_parseInput()
         }
     }
 
+    // the rows exceeding the rack size are ignored anyway
+    if (_isErrorsLimitReached() && _getInputRowsCount() < Data::c_MaxRackUnitsCount && _isPayloadRowRemaining())
+    {
+        _setParsingStopped();
+    }
+
     // if no parsing errors occurred, check whether this happened because there are actually no connected devices
     if (!_parsingErrorsExist())
     {
@@ -82,7 +77,7 @@ void ConnectionDefinitionParser::_buildOutput()
 {
     _buildDeviceOutputData();
 
-    std::vector<std::pair<std::string, size_t>> outputRowsAndAppends; // each output row and number of times to append it to output
+    std::vector<std::pair<Core::Row_t, size_t>> outputRowsAndAppends; // each output row and number of times to append it to output
     size_t validSourceDevicesCount{0u};
 
     // traverse the rack from top to bottom and check if each discovered device is connected to devices placed at upper U positions
@@ -94,15 +89,18 @@ void ConnectionDefinitionParser::_buildOutput()
         // connected (destination) device U position starts at 1
         for (auto connectedDevIter{connectedDevices.cbegin()}; connectedDevIter != connectedDevices.cend() && connectedDevIter->first > 0u; ++connectedDevIter)
         {
-            /* The output string per connection row is calculated by adding following substrings: cable part number placeholder and the template parameters for each connected device
+            /* The output fields per connection row are: cable part number placeholder and the template parameters for each connected device
                The decrease by 1 is necessary due to vector indexing (which starts at 0)
             */
-            std::string output{Data::c_CablePartNumberPlaceholder};
-            output.push_back(Data::c_CSVSeparator);
-            output.append(mRackPositionToDeviceDataMapping[sourceDevIter->mSourceDevice - 1].mDeviceOutputData); // source device U position starts at 1 (already checked above)
-            output.push_back(Data::c_CSVSeparator);
-            output.append(mRackPositionToDeviceDataMapping[connectedDevIter->first - 1].mDeviceOutputData); // destination (connected) device U position starts at 1 (already checked above)
-            outputRowsAndAppends.push_back({output, connectedDevIter->second});
+            const std::vector<std::string>& c_SourceDeviceFields{mRackPositionToDeviceDataMapping[sourceDevIter->mSourceDevice - 1].mDeviceOutputFields}; // source device U position starts at 1 (already checked above)
+            const std::vector<std::string>& c_DestinationDeviceFields{mRackPositionToDeviceDataMapping[connectedDevIter->first - 1].mDeviceOutputFields}; // destination (connected) device U position starts at 1 (already checked above)
+
+            Core::Row_t output;
+            output.reserve(1 + c_SourceDeviceFields.size() + c_DestinationDeviceFields.size());
+            output.emplace_back(Data::c_CablePartNumberPlaceholder);
+            output.insert(output.cend(), c_SourceDeviceFields.cbegin(), c_SourceDeviceFields.cend());
+            output.insert(output.cend(), c_DestinationDeviceFields.cbegin(), c_DestinationDeviceFields.cend());
+            outputRowsAndAppends.push_back({std::move(output), connectedDevIter->second});
             ++validConnectedDevicesCount;
         }
 
@@ -199,7 +197,7 @@ void ConnectionDefinitionParser::_parseDeviceConnections(const size_t rowIndex)
     {
         std::string currentCell; // read next cell (new current cell)
 
-        while(_readCurrentCell(rowIndex, currentCell))
+        while(!_isErrorsLimitReached() && _readCurrentCell(rowIndex, currentCell))
         {
             const size_t c_FileRowNumber{rowIndex + Parsers::c_RowNumberOffset};
             ErrorPtr pError{nullptr};
@@ -208,7 +206,7 @@ void ConnectionDefinitionParser::_parseDeviceConnections(const size_t rowIndex)
             if (currentCell.empty())
             {
                 // trigger error but continue parsing the next cells from the row
-                if (Core::areParseableCharactersContained(_getUnparsedCellsContent(rowIndex)))
+                if (_isParseableContentRemaining(rowIndex))
                 {
                     pError = _logError(static_cast<Core::Error_t>(ErrorCode::EMPTY_CELL), c_FileRowNumber);
                     _storeParsingError(pError);
@@ -252,6 +250,12 @@ void ConnectionDefinitionParser::_parseDeviceConnections(const size_t rowIndex)
             _moveToNextInputColumn(rowIndex);
             currentCell.clear();
         }
+
+        // the remaining connections of the row are no longer checked
+        if (_isErrorsLimitReached() && _isParseableContentRemaining(rowIndex))
+        {
+            _setParsingStopped();
+        }
     }
 }
 
@@ -323,14 +327,15 @@ void ConnectionDefinitionParser::_buildDeviceOutputData()
             // in mapping vector numbering starts at 0 so it is necessary to decrease the U number by 1
             if (const size_t c_CurrentDeviceUPositionAsIndex{sourceDevice - 1}; c_CurrentDeviceUPositionAsIndex < mRackPositionToDeviceDataMapping.size())
             {
-                auto&[deviceTypeID, deviceOutputData]{mRackPositionToDeviceDataMapping[c_CurrentDeviceUPositionAsIndex]};
+                auto&[deviceTypeID, deviceOutputFields]{mRackPositionToDeviceDataMapping[c_CurrentDeviceUPositionAsIndex]};
 
                 // append device type and U position
-                deviceOutputData += Parsers::getDeviceTypeAsString(deviceTypeID) + Data::c_CSVSeparator;
-                deviceOutputData += std::to_string(sourceDevice) + Data::c_CSVSeparator;
+                deviceOutputFields.push_back(Parsers::getDeviceTypeAsString(deviceTypeID));
+                deviceOutputFields.push_back(std::to_string(sourceDevice));
 
                 // append the placeholders for the device parameters (to be filled in the next step (option 2) in connectioninput.csv so the final table can be calculated)
-                deviceOutputData += Data::c_ConnectionInputPlaceholders.at(deviceTypeID);
+                const std::vector<std::string> c_Placeholders{Parsers::getConnectionInputPlaceholders(deviceTypeID)};
+                deviceOutputFields.insert(deviceOutputFields.cend(), c_Placeholders.cbegin(), c_Placeholders.cend());
             }
         }
     }
@@ -65,7 +65,7 @@ private:
         DeviceData();
 
         Data::DeviceTypeID mDeviceTypeID;
-        std::string mDeviceOutputData; // data to be written into csv file for the device wherever there is a connection between it and another device
+        std::vector<std::string> mDeviceOutputFields; // fields to be written into csv file for the device wherever there is a connection between it and another device
     };
 
     struct DeviceConnections
@@ -79,7 +79,7 @@ private:
 
     /* Stores data for the devices contained within rack:
        - device type ID
-       - a string containing the computed output data for the device (including device type as string, U position, other (template) parameters that should later be filled-in by user)
+       - the computed output fields for the device (including device type as string, U position, other (template) parameters that should later be filled-in by user)
        Each array element is mapped to a rack U position (e.g. element at index 3 to rack position U4) so the array size equals the maximum number of units within a rack.
        For each device only the lowest U position should be marked within array (all other positions are marked "empty" (a.k.a. NO_DEVICE) although they might actually be occupied by physical devices).
     */
@@ -4,52 +4,73 @@
 #include "parserutils.h"
 #include "deviceportsfactory.h"
 #include "deviceport.h"
+#include "deviceportutils.h"
 #include "connectioninputparser.h"
 
 namespace Parsers = Utilities::Parsers;
+namespace Ports = Utilities::DevicePorts;
 
-ConnectionInputParser::ConnectionInputParser(const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream)
+ConnectionInputParser::ConnectionInputParser(const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream,
+                                             const LabellingIndexPtr pLabellingIndex, const ConnectionReportsPtr pConnectionReports,
+                                             const ConnectionConflictDetectorPtr pConnectionConflictDetector)
     : Parser(pInputStream, pOutputStream, pErrorStream, Data::c_LabellingTableHeader)
+    , mpLabellingIndex{pLabellingIndex}
+    , mpConnectionReports{pConnectionReports}
+    , mpConnectionConflictDetector{pConnectionConflictDetector}
 {
 }
 
-// It is assumed that the user has already filled in the placeholders with useful connection data.
+/* It is assumed that the user has already filled in the placeholders with useful connection data.
+   The payload rows are read one by one while being parsed (see _parseInput()) so no more input is read once the maximum number of errors is reached
+*/
 void ConnectionInputParser::_readPayload()
 {
-    while (!_isInputStreamConsumed())
-    {
-        _readLineAndAppendToInput();
-    }
+    // computed once per parsing session (instead of once per invalid label), the device ports referring to it
+    mCheckInputFileText = Ports::getCheckConnectionInputFileText(_getInputFile().string());
 }
 
 bool ConnectionInputParser::_parseInput()
 {
-    if (const size_t c_ConnectionInputRowsCount{_getInputRowsCount()}; c_ConnectionInputRowsCount > 0u)
+    for (size_t rowIndex{0u}; !_isErrorsLimitReached() && _readPayloadRow(); ++rowIndex)
     {
-        mParsedRowsInfo.resize(c_ConnectionInputRowsCount);
+        mParsedRowsInfo.emplace_back();
+        _moveToInputRowStart(rowIndex);
 
-        for (size_t rowIndex{0u}; rowIndex < c_ConnectionInputRowsCount; ++rowIndex)
-        {
-            _moveToInputRowStart(rowIndex);
+        // the cable field should only be parsed before parsing any device on the row
+        // (it is also parsed for the reused rows as their cable part number might be carried forward to the next rows)
+        _parseCablePartNumber(rowIndex);
 
-            // the cable field should only be parsed before parsing any device on the row
-            _parseCablePartNumber(rowIndex);
+        if (_isLabelledRowReusable(rowIndex))
+        {
+            continue;
+        }
 
-            int& unparsedPortsCount{mParsedRowsInfo[rowIndex].mUnparsedPortsCount};
-            unparsedPortsCount = Parsers::c_DevicesPerConnectionInputRowCount; // devices that haven't been fully parsed on the current input csv row (maximum 2 - one connection)
+        int& unparsedPortsCount{mParsedRowsInfo[rowIndex].mUnparsedPortsCount};
+        unparsedPortsCount = Parsers::c_DevicesPerConnectionInputRowCount; // devices that haven't been fully parsed on the current input csv row (maximum 2 - one connection)
 
-            while (unparsedPortsCount > 0)
+        while (unparsedPortsCount > 0)
+        {
+            if (const bool c_CanContinueRowParsing{_parseDevicePort(rowIndex)}; !c_CanContinueRowParsing)
             {
-                if (const bool c_CanContinueRowParsing{_parseDevicePort(rowIndex)}; !c_CanContinueRowParsing)
-                {
-                    break;
-                }
-
-                --unparsedPortsCount;
+                break;
             }
+
+            --unparsedPortsCount;
+        }
+
+        if (mpConnectionConflictDetector)
+        {
+            _checkConnectionConflicts(rowIndex);
         }
     }
-    else
+
+    // the maximum number of errors might have been reached on the last row, in which case no errors have been suppressed
+    if (_isErrorsLimitReached() && _isPayloadRowRemaining())
+    {
+        _setParsingStopped();
+    }
+
+    if (0u == _getInputRowsCount())
     {
         ErrorPtr pEmptyConnectionInputFileError{_logError(static_cast<Core::Error_t>(ErrorCode::EMPTY_CONNECTION_INPUT_FILE), 1, true)};
         _storeParsingError(pEmptyConnectionInputFileError);
@@ -64,14 +85,47 @@ void ConnectionInputParser::_buildOutput()
 {
     if (const size_t c_ConnectionInputRowsCount{_getInputRowsCount()}; mParsedRowsInfo.size() == c_ConnectionInputRowsCount)
     {
+        Core::Row_t outputRow; // reused for each row
+
         for (size_t rowIndex{0u}; rowIndex < c_ConnectionInputRowsCount; ++rowIndex)
         {
-            std::string outputRow;
+            const Core::Index_t c_ReusedOutputRowIndex{mParsedRowsInfo[rowIndex].mReusedOutputRowIndex};
 
-            if (const bool c_IsValidConnection{_buildOutputRow(rowIndex, outputRow)}; c_IsValidConnection)
+            // partial output: the invalid rows are marked (not indexed or reported) so the connection numbers of the valid rows are not changed
+            if (_areParsingErrorsContained(rowIndex))
+            {
+                _buildInvalidOutputRow(rowIndex, outputRow);
+                _appendRowToOutput(outputRow);
+            }
+            else if (c_ReusedOutputRowIndex.has_value())
             {
+                // the connection number depends on the row position so it is not stored by the index
+                outputRow.assign(1u, std::to_string(rowIndex + 1));
+                mpLabellingIndex->appendOutputRowFields(*c_ReusedOutputRowIndex, outputRow);
+
+                mpLabellingIndex->addOutputRow(mParsedRowsInfo[rowIndex].mInputRowHash, outputRow);
                 _appendRowToOutput(outputRow);
             }
+            else if (_buildOutputRow(rowIndex, outputRow))
+            {
+                if (mpLabellingIndex)
+                {
+                    mpLabellingIndex->addOutputRow(mParsedRowsInfo[rowIndex].mInputRowHash, outputRow);
+                }
+
+                if (mpConnectionReports)
+                {
+                    _addConnectionToReports(rowIndex);
+                }
+
+                _appendRowToOutput(outputRow);
+            }
+        }
+
+        // each report is written by its own thread
+        if (mpConnectionReports)
+        {
+            (void)mpConnectionReports->write();
         }
     }
     else
@@ -83,9 +137,20 @@ void ConnectionInputParser::_buildOutput()
 void ConnectionInputParser::_reset()
 {
     mParsedRowsInfo.clear();
+
+    if (mpConnectionConflictDetector)
+    {
+        mpConnectionConflictDetector->clear();
+    }
+
     Parser::_reset();
 }
 
+bool ConnectionInputParser::_isPartialOutputSupported() const
+{
+    return true;
+}
+
 void ConnectionInputParser::_parseCablePartNumber(const size_t rowIndex)
 {
     if (rowIndex < mParsedRowsInfo.size())
@@ -113,6 +178,73 @@ void ConnectionInputParser::_parseCablePartNumber(const size_t rowIndex)
     }
 }
 
+bool ConnectionInputParser::_isLabelledRowReusable(const size_t rowIndex)
+{
+    bool isReusable{false};
+
+    if (mpLabellingIndex && rowIndex < mParsedRowsInfo.size())
+    {
+        ParsedRowInfo& parsedRowInfo{mParsedRowsInfo[rowIndex]};
+
+        parsedRowInfo.mInputRowHash = LabellingIndex::getInputRowHash(_getParseableRowContent(rowIndex), parsedRowInfo.mCablePartNumber);
+
+        // the reports and the conflict detection need the parsed device ports (the index is still updated with the current rows)
+        parsedRowInfo.mReusedOutputRowIndex = !mpConnectionReports && !mpConnectionConflictDetector ? mpLabellingIndex->findOutputRow(parsedRowInfo.mInputRowHash) : std::nullopt;
+
+        isReusable = parsedRowInfo.mReusedOutputRowIndex.has_value();
+    }
+
+    return isReusable;
+}
+
+void ConnectionInputParser::_checkConnectionConflicts(const size_t rowIndex)
+{
+    // the device ports of a row containing errors might not be (completely) parsed
+    if (rowIndex < mParsedRowsInfo.size() && !_areParsingErrorsContained(rowIndex))
+    {
+        const size_t c_FileRowNumber{rowIndex + Parsers::c_RowNumberOffset};
+
+        _updateDescriptionsAndLabels(rowIndex);
+
+        for (size_t portIndex{0u}; portIndex < static_cast<size_t>(Parsers::c_DevicesPerConnectionInputRowCount); ++portIndex)
+        {
+            if (const DevicePort* const c_pDevicePort{dynamic_cast<DevicePort*>(_getSubParser(rowIndex, portIndex))}; c_pDevicePort)
+            {
+                // the errors are located at the device type column of the port (the first one follows the cable part number, the second one the padded parameters of the first port)
+                const size_t c_FileColumnNumber{2u + portIndex * (Parsers::c_DevicePortParamsColumnOffset + Data::c_MaxPortInputParametersCount)};
+
+                // a duplicate device port also gets a duplicate label so only the port is reported
+                if (const size_t c_FirstFileRowNumber{mpConnectionConflictDetector->addDevicePort(c_pDevicePort->getPortHash(), c_FileRowNumber)}; c_FirstFileRowNumber > 0u)
+                {
+                    _storeParsingError(_logError(static_cast<Core::Error_t>(ErrorCode::DUPLICATE_DEVICE_PORT), c_FileRowNumber, c_FileColumnNumber, c_FirstFileRowNumber));
+                }
+                // the labels replaced by "soft" error messages are already marked in the labelling table
+                else if (const size_t c_FirstLabelFileRowNumber{c_pDevicePort->isValidLabel() ? mpConnectionConflictDetector->addLabel(c_pDevicePort->getLabel(), c_FileRowNumber) : 0u};
+                         c_FirstLabelFileRowNumber > 0u)
+                {
+                    _storeParsingError(_logError(static_cast<Core::Error_t>(ErrorCode::DUPLICATE_LABEL), c_FileRowNumber, c_FileColumnNumber, c_FirstLabelFileRowNumber));
+                }
+            }
+        }
+    }
+}
+
+void ConnectionInputParser::_updateDescriptionsAndLabels(const size_t rowIndex)
+{
+    if (rowIndex < mParsedRowsInfo.size() && !mParsedRowsInfo[rowIndex].mAreDescriptionsAndLabelsUpdated)
+    {
+        for (size_t portIndex{0u}; portIndex < static_cast<size_t>(Parsers::c_DevicesPerConnectionInputRowCount); ++portIndex)
+        {
+            if (DevicePort* const pDevicePort{dynamic_cast<DevicePort*>(_getSubParser(rowIndex, portIndex))}; pDevicePort)
+            {
+                pDevicePort->updateDescriptionAndLabel();
+            }
+        }
+
+        mParsedRowsInfo[rowIndex].mAreDescriptionsAndLabelsUpdated = true;
+    }
+}
+
 bool ConnectionInputParser::_parseDevicePort(const size_t rowIndex)
 {
     bool canContinueRowParsing{rowIndex < mParsedRowsInfo.size()};
@@ -140,7 +272,14 @@ bool ConnectionInputParser::_parseDevicePort(const size_t rowIndex)
         const size_t c_FileRowNumber{rowIndex + Parsers::c_RowNumberOffset};
         const bool c_IsSourceDevice{0 == unparsedPortsCount % Parsers::c_DevicesPerConnectionInputRowCount};
 
-        _registerSubParser(DevicePortsFactory::createDevicePort(deviceTypeID, deviceUPosition, c_FileRowNumber, c_IsSourceDevice));
+        DevicePort* const c_pDevicePort{DevicePortsFactory::createDevicePort(deviceTypeID, deviceUPosition, c_FileRowNumber, c_IsSourceDevice)};
+
+        if (c_pDevicePort)
+        {
+            c_pDevicePort->setCheckInputFileText(mCheckInputFileText);
+        }
+
+        _registerSubParser(c_pDevicePort);
 
         std::vector<ErrorPtr> parsingErrors;
         _doSubParsing(rowIndex, unparsedPortsCount % Parsers::c_DevicesPerConnectionInputRowCount, parsingErrors);
@@ -230,7 +369,7 @@ bool ConnectionInputParser::_parseDeviceUPosition(const size_t rowIndex, std::st
     return isDeviceUPositionValid;
 }
 
-bool ConnectionInputParser::_buildOutputRow(const size_t rowIndex, std::string& currentRow)
+bool ConnectionInputParser::_buildOutputRow(const size_t rowIndex, Core::Row_t& currentRow)
 {
     DevicePort* pFirstDevicePort{nullptr};
     DevicePort* pSecondDevicePort{nullptr};
@@ -248,28 +387,18 @@ bool ConnectionInputParser::_buildOutputRow(const size_t rowIndex, std::string&
 
         if (pSecondDevicePort)
         {
-            pFirstDevicePort->updateDescriptionAndLabel();
-            pSecondDevicePort->updateDescriptionAndLabel();
+            _updateDescriptionsAndLabels(rowIndex);
 
-            std::stringstream str;
+            currentRow.clear();
+            currentRow.reserve(scOutputRowFieldsCount);
 
             // number of the connection to be written on each row of the output file
-            const size_t c_ConnectionNumber{rowIndex + 1};
-
-            currentRow.clear();
-            str << c_ConnectionNumber;
-            str >> currentRow;
-
-            currentRow += Data::c_CSVSeparator;
-            currentRow += mParsedRowsInfo[rowIndex].mCablePartNumber;
-            currentRow += Data::c_CSVSeparator;
-            currentRow += pFirstDevicePort->getDescription();
-            currentRow += Data::c_CSVSeparator;
-            currentRow += pFirstDevicePort->getLabel();
-            currentRow += Data::c_CSVSeparator;
-            currentRow += pSecondDevicePort->getDescription();
-            currentRow += Data::c_CSVSeparator;
-            currentRow += pSecondDevicePort->getLabel();
+            currentRow.push_back(std::to_string(rowIndex + 1));
+            currentRow.push_back(mParsedRowsInfo[rowIndex].mCablePartNumber);
+            currentRow.push_back(pFirstDevicePort->getDescription());
+            currentRow.push_back(pFirstDevicePort->getLabel());
+            currentRow.push_back(pSecondDevicePort->getDescription());
+            currentRow.push_back(pSecondDevicePort->getLabel());
 
             success = true;
         }
@@ -278,7 +407,49 @@ bool ConnectionInputParser::_buildOutputRow(const size_t rowIndex, std::string&
     return success;
 }
 
+void ConnectionInputParser::_buildInvalidOutputRow(const size_t rowIndex, Core::Row_t& currentRow) const
+{
+    if (rowIndex < mParsedRowsInfo.size())
+    {
+        const std::string c_ErrorText{Parsers::c_InvalidConnectionInputRowErrorText + std::to_string(rowIndex + Parsers::c_RowNumberOffset)};
+
+        currentRow.clear();
+        currentRow.reserve(scOutputRowFieldsCount);
+        currentRow.push_back(std::to_string(rowIndex + 1));
+        currentRow.push_back(mParsedRowsInfo[rowIndex].mCablePartNumber);
+
+        for (int portIndex{0}; portIndex < Parsers::c_DevicesPerConnectionInputRowCount; ++portIndex)
+        {
+            currentRow.push_back(c_ErrorText); // description
+            currentRow.push_back(c_ErrorText); // label
+        }
+    }
+}
+
+void ConnectionInputParser::_addConnectionToReports(const size_t rowIndex)
+{
+    if (rowIndex < mParsedRowsInfo.size())
+    {
+        Connection_t connection{rowIndex + 1, mParsedRowsInfo[rowIndex].mCablePartNumber, {}};
+
+        for (size_t portIndex{0u}; portIndex < connection.mPorts.size(); ++portIndex)
+        {
+            // the device ports exist as the output row has been built from them
+            if (const DevicePort* const c_pDevicePort{dynamic_cast<DevicePort*>(_getSubParser(rowIndex, portIndex))}; c_pDevicePort)
+            {
+                connection.mPorts[portIndex] = {c_pDevicePort->getDeviceUPosition(), c_pDevicePort->getDeviceDescription(), c_pDevicePort->getDescription(),
+                                                c_pDevicePort->getLabel(), c_pDevicePort->isPowerPort()};
+            }
+        }
+
+        mpConnectionReports->addConnection(connection);
+    }
+}
+
 ConnectionInputParser::ParsedRowInfo::ParsedRowInfo()
     : mUnparsedPortsCount{2}
+    , mInputRowHash{0u}
+    , mReusedOutputRowIndex{std::nullopt}
+    , mAreDescriptionsAndLabelsUpdated{false}
 {
 }
@@ -3,11 +3,21 @@
 
 #include "applicationdata.h"
 #include "parser.h"
+#include "labellingindex.h"
+#include "connectionreports.h"
+#include "connectionconflictdetector.h"
 
 class ConnectionInputParser final : public Parser
 {
 public:
-    ConnectionInputParser(const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream);
+    /* If a labelling index is provided, the rows already labelled in the previous run are reused (only the changed rows are parsed) and the index is updated with the current rows
+       If reports are provided, each labelled connection is also passed to them and the reports are written together with the labelling table
+       (all rows are parsed in this case as the reports require the port details, which are not stored by the index)
+       If a conflict detector is provided, the device ports used on more than one row and the labels calculated more than once are reported as parsing errors (all rows are parsed in this case too)
+    */
+    ConnectionInputParser(const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream,
+                          const LabellingIndexPtr pLabellingIndex = nullptr, const ConnectionReportsPtr pConnectionReports = nullptr,
+                          const ConnectionConflictDetectorPtr pConnectionConflictDetector = nullptr);
 
     ConnectionInputParser() = delete;
     ConnectionInputParser(const ConnectionInputParser&) = delete;
@@ -18,6 +28,7 @@ protected:
     virtual bool _parseInput() override;
     virtual void _buildOutput() override;
     virtual void _reset() override;
+    virtual bool _isPartialOutputSupported() const override;
 
 private:
     /* Used for processing the cable PN cell for each CSV row
@@ -36,10 +47,31 @@ private:
     */
     bool _parseDeviceUPosition(const size_t rowIndex, std::string& deviceUPosition);
 
-    /* This function creates an entry for a connection between two devices.
-       String is written to the labelling table in a subsequent operation.
+    /* Checks the device ports of a row without parsing errors against the ones of the previous rows (same port or same label)
+       The descriptions and labels are calculated at this point so they are not calculated again when building the output
+    */
+    void _checkConnectionConflicts(const size_t rowIndex);
+
+    /* Calculates the descriptions and labels of the device ports of the row (once)
+    */
+    void _updateDescriptionsAndLabels(const size_t rowIndex);
+
+    /* Checks if the row has been labelled in the previous run (same content and cable part number), in which case it doesn't need to be parsed again
+    */
+    bool _isLabelledRowReusable(const size_t rowIndex);
+
+    /* This function creates an entry for a connection between two devices (connection number, cable part number, description and label of each device port).
+       The row is written to the labelling table in a subsequent operation.
+    */
+    bool _buildOutputRow(const size_t rowIndex, Core::Row_t& currentRow);
+
+    /* Used for the rows containing parsing errors when building a partial output: the cable part number is kept while the descriptions and labels are replaced by an error text
+    */
+    void _buildInvalidOutputRow(const size_t rowIndex, Core::Row_t& currentRow) const;
+
+    /* Passes the connection of a labelled row to the reports (once the output row has been built)
     */
-    bool _buildOutputRow(const size_t rowIndex, std::string& currentRow);
+    void _addConnectionToReports(const size_t rowIndex);
 
     struct ParsedRowInfo
     {
@@ -47,12 +79,30 @@ private:
 
         std::string mCablePartNumber; // the cable part number of each connection
         int mUnparsedPortsCount; // number of device ports still not parsed on current row
+        std::uint64_t mInputRowHash; // only calculated if a labelling index is used
+        Core::Index_t mReusedOutputRowIndex; // labelling table row from the previous run, as stored by the labelling index (if the input row is unchanged)
+        bool mAreDescriptionsAndLabelsUpdated; // the descriptions and labels of the device ports have been calculated
     };
 
     using ParsedRowsInfo = std::vector<ParsedRowInfo>;
 
+    // connection number, cable part number, description and label of each device port
+    static constexpr size_t scOutputRowFieldsCount{6u};
+
     /* Information used for or obtained from parsing input rows */
     ParsedRowsInfo mParsedRowsInfo;
+
+    /* Labelling table rows of the previous run (optional) */
+    const LabellingIndexPtr mpLabellingIndex;
+
+    /* Reports produced from the labelled connections (optional) */
+    const ConnectionReportsPtr mpConnectionReports;
+
+    /* Duplicate device ports and labels detection (optional) */
+    const ConnectionConflictDetectorPtr mpConnectionConflictDetector;
+
+    /* Appended to the invalid labels of the device ports, names the parsed input file */
+    std::string mCheckInputFileText;
 };
 
 #endif // CONNECTIONINPUTPARSER_H
@@ -0,0 +1,120 @@
+#include <algorithm>
+
+#include "applicationdata.h"
+#include "connectionreport.h"
+
+ConnectionReport::ConnectionReport()
+{
+}
+
+ConnectionReport::~ConnectionReport()
+{
+}
+
+bool ConnectionReport::write(Core::OutputSink& outputSink) const
+{
+    std::vector<std::string_view> columnNames;
+    Core::splitDataFields(_getHeader(), columnNames);
+
+    return outputSink.writeHeader(columnNames) && _writeRows(outputSink);
+}
+
+void BillOfMaterialsReport::addConnection(const Connection_t& connection)
+{
+    ++mCablesCount[connection.mCablePartNumber];
+}
+
+std::string_view BillOfMaterialsReport::_getHeader() const
+{
+    return Data::c_BillOfMaterialsHeader;
+}
+
+bool BillOfMaterialsReport::_writeRows(Core::OutputSink& outputSink) const
+{
+    bool success{true};
+
+    for (auto c_It{mCablesCount.cbegin()}; success && mCablesCount.cend() != c_It; ++c_It)
+    {
+        const std::string c_Quantity{std::to_string(c_It->second)};
+        success = outputSink.writeRow({c_It->first, c_Quantity});
+    }
+
+    return success;
+}
+
+void PortMapReport::addConnection(const Connection_t& connection)
+{
+    const size_t c_ConnectionIndex{mConnections.size()};
+
+    mConnections.push_back(connection);
+
+    for (size_t portIndex{0u}; portIndex < connection.mPorts.size(); ++portIndex)
+    {
+        // the U position has been validated when parsing the connection
+        const std::string& c_DeviceUPosition{connection.mPorts[portIndex].mDeviceUPosition};
+        const size_t c_UPosition{Core::isDigitString(c_DeviceUPosition) && !c_DeviceUPosition.empty() ? std::stoul(c_DeviceUPosition) : 0u};
+
+        mPortEntries.push_back({c_UPosition, c_ConnectionIndex, portIndex});
+    }
+}
+
+std::string_view PortMapReport::_getHeader() const
+{
+    return Data::c_PortMapHeader;
+}
+
+/* The ports are grouped by device (U position, then device type), the stable sort keeping the labelling table order of the ports of each device
+*/
+bool PortMapReport::_writeRows(Core::OutputSink& outputSink) const
+{
+    std::vector<PortEntry_t> sortedPortEntries{mPortEntries};
+
+    std::stable_sort(sortedPortEntries.begin(), sortedPortEntries.end(), [this](const PortEntry_t& firstEntry, const PortEntry_t& secondEntry) {
+        return firstEntry.mUPosition != secondEntry.mUPosition ? firstEntry.mUPosition < secondEntry.mUPosition
+                                                               : mConnections[firstEntry.mConnectionIndex].mPorts[firstEntry.mPortIndex].mDeviceDescription <
+                                                                 mConnections[secondEntry.mConnectionIndex].mPorts[secondEntry.mPortIndex].mDeviceDescription;
+    });
+
+    bool success{true};
+
+    for (auto c_It{sortedPortEntries.cbegin()}; success && sortedPortEntries.cend() != c_It; ++c_It)
+    {
+        const Connection_t& c_Connection{mConnections[c_It->mConnectionIndex]};
+        const ConnectionPort_t& c_Port{c_Connection.mPorts[c_It->mPortIndex]};
+        const ConnectionPort_t& c_RemotePort{c_Connection.mPorts[1u - c_It->mPortIndex]};
+        const std::string c_ItemNumber{std::to_string(c_Connection.mNumber)};
+
+        success = outputSink.writeRow({c_Port.mDeviceUPosition, c_Port.mDeviceDescription, c_Port.mDescription, c_Port.mLabel,
+                                       c_RemotePort.mDescription, c_RemotePort.mLabel, c_Connection.mCablePartNumber, c_ItemNumber});
+    }
+
+    return success;
+}
+
+void PowerConnectionsReport::addConnection(const Connection_t& connection)
+{
+    if (connection.mPorts[0].mIsPowerPort || connection.mPorts[1].mIsPowerPort)
+    {
+        mPowerConnections.push_back(connection);
+    }
+}
+
+std::string_view PowerConnectionsReport::_getHeader() const
+{
+    return Data::c_LabellingTableHeader;
+}
+
+bool PowerConnectionsReport::_writeRows(Core::OutputSink& outputSink) const
+{
+    bool success{true};
+
+    for (auto c_It{mPowerConnections.cbegin()}; success && mPowerConnections.cend() != c_It; ++c_It)
+    {
+        const std::string c_ItemNumber{std::to_string(c_It->mNumber)};
+
+        success = outputSink.writeRow({c_ItemNumber, c_It->mCablePartNumber, c_It->mPorts[0].mDescription, c_It->mPorts[0].mLabel,
+                                       c_It->mPorts[1].mDescription, c_It->mPorts[1].mLabel});
+    }
+
+    return success;
+}
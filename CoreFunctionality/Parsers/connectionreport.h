@@ -0,0 +1,112 @@
+#ifndef CONNECTIONREPORT_H
+#define CONNECTIONREPORT_H
+
+#include <array>
+#include <map>
+#include <vector>
+
+#include "outputsink.h"
+
+namespace Core = Utilities::Core;
+
+/* Connection end, as labelled by option 2 */
+struct ConnectionPort_t
+{
+    std::string mDeviceUPosition;
+    std::string mDeviceDescription; // device type (e.g. Switch), the device being identified by its U position
+    std::string mDescription;
+    std::string mLabel;
+    bool mIsPowerPort;
+};
+
+/* Labelled connection (one labelling table row) */
+struct Connection_t
+{
+    size_t mNumber; // item number within the labelling table
+    std::string mCablePartNumber;
+    std::array<ConnectionPort_t, 2> mPorts; // source and destination
+};
+
+/* Base class of the reports produced from the labelled connections in the same run as the labelling table (e.g. cable bill of materials)
+   Each report collects the data it needs from the connections it receives and writes its table once all connections are known
+*/
+class ConnectionReport
+{
+public:
+    ConnectionReport();
+    virtual ~ConnectionReport();
+
+    ConnectionReport(const ConnectionReport&) = delete;
+    ConnectionReport& operator=(const ConnectionReport&) = delete;
+
+    virtual void addConnection(const Connection_t& connection) = 0;
+
+    /* Writes the header and all rows to the sink (finishing it is up to the caller)
+    */
+    bool write(Core::OutputSink& outputSink) const;
+
+protected:
+    /* The header (.csv row) of the report table
+    */
+    virtual std::string_view _getHeader() const = 0;
+
+    virtual bool _writeRows(Core::OutputSink& outputSink) const = 0;
+};
+
+/* Cable bill of materials: the number of connections per cable part number, ordered by part number
+*/
+class BillOfMaterialsReport final : public ConnectionReport
+{
+public:
+    virtual void addConnection(const Connection_t& connection) override;
+
+protected:
+    virtual std::string_view _getHeader() const override;
+    virtual bool _writeRows(Core::OutputSink& outputSink) const override;
+
+private:
+    std::map<std::string, size_t> mCablesCount;
+};
+
+/* Port map: one row per connection end, grouped by device (ordered by U position) so each device (e.g. switch) lists all its connected ports
+   Each row contains the port, the port it is connected to and the connection item number. The ports of a device keep the labelling table order
+*/
+class PortMapReport final : public ConnectionReport
+{
+public:
+    virtual void addConnection(const Connection_t& connection) override;
+
+protected:
+    virtual std::string_view _getHeader() const override;
+    virtual bool _writeRows(Core::OutputSink& outputSink) const override;
+
+private:
+    struct PortEntry_t
+    {
+        size_t mUPosition;
+        size_t mConnectionIndex;
+        size_t mPortIndex;
+    };
+
+    std::vector<Connection_t> mConnections;
+    std::vector<PortEntry_t> mPortEntries;
+};
+
+/* Power sheet: the labelling table rows of the connections having a power port at (at least) one end
+*/
+class PowerConnectionsReport final : public ConnectionReport
+{
+public:
+    virtual void addConnection(const Connection_t& connection) override;
+
+protected:
+    virtual std::string_view _getHeader() const override;
+    virtual bool _writeRows(Core::OutputSink& outputSink) const override;
+
+private:
+    std::vector<Connection_t> mPowerConnections;
+};
+
+using ConnectionReportPtr = std::unique_ptr<ConnectionReport>;
+
+#endif // CONNECTIONREPORT_H
@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <thread>
+
+#include "compressedfilestream.h"
+#include "connectionreports.h"
+
+ConnectionReports::ConnectionReports(const Core::Path_t& labellingOutputFile)
+    : mLabellingOutputFile{labellingOutputFile}
+    , mOutputFormat{Parser::getOutputFormat(labellingOutputFile)}
+    , mIsWritingFailed{false}
+{
+}
+
+void ConnectionReports::addReport(const ReportType reportType)
+{
+    if (mReports.cend() == std::find_if(mReports.cbegin(), mReports.cend(), [reportType](const Report_t& report) {return reportType == report.mReportType;}))
+    {
+        mReports.push_back({reportType, _createReport(reportType)});
+    }
+}
+
+void ConnectionReports::addConnection(const Connection_t& connection)
+{
+    for (auto& report : mReports)
+    {
+        report.mpReport->addConnection(connection);
+    }
+}
+
+/* The calling thread writes the first report while the other threads write the remaining ones
+*/
+bool ConnectionReports::write()
+{
+    std::vector<std::thread> threads;
+    std::vector<char> reportsWritten(mReports.size(), false);
+
+    for (size_t reportIndex{1u}; reportIndex < mReports.size(); ++reportIndex)
+    {
+        threads.emplace_back([this, &reportsWritten, reportIndex]() {
+            reportsWritten[reportIndex] = _writeReport(mReports[reportIndex]);
+        });
+    }
+
+    if (!mReports.empty())
+    {
+        reportsWritten[0] = _writeReport(mReports[0]);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    mIsWritingFailed = reportsWritten.cend() != std::find(reportsWritten.cbegin(), reportsWritten.cend(), false);
+
+    // the reports are not reused across parsing sessions
+    for (auto& report : mReports)
+    {
+        report.mpReport = _createReport(report.mReportType);
+    }
+
+    return !mIsWritingFailed;
+}
+
+bool ConnectionReports::isWritingFailed() const
+{
+    return mIsWritingFailed;
+}
+
+bool ConnectionReports::getReportType(const std::string_view reportName, ReportType& reportType)
+{
+    bool isKnownReport{true};
+
+    if (_getReportName(ReportType::BILL_OF_MATERIALS) == reportName)
+    {
+        reportType = ReportType::BILL_OF_MATERIALS;
+    }
+    else if (_getReportName(ReportType::PORT_MAP) == reportName)
+    {
+        reportType = ReportType::PORT_MAP;
+    }
+    else if (_getReportName(ReportType::POWER_CONNECTIONS) == reportName)
+    {
+        reportType = ReportType::POWER_CONNECTIONS;
+    }
+    else
+    {
+        isKnownReport = false;
+    }
+
+    return isKnownReport;
+}
+
+/* E.g. rack01_labellingtable_portmap.csv.gz for rack01_labellingtable.csv.gz
+*/
+Core::Path_t ConnectionReports::getReportFile(const Core::Path_t& labellingOutputFile, const ReportType reportType)
+{
+    const bool c_IsCompressed{Core::CompressionFormat::NONE != Core::getCompressionFormat(labellingOutputFile)};
+    const Core::Path_t c_UncompressedOutputFile{c_IsCompressed ? labellingOutputFile.stem() : labellingOutputFile.filename()};
+
+    Parser::OutputFormat reportFormat{Parser::getOutputFormat(labellingOutputFile)};
+
+    if (Parser::OutputFormat::ZPL == reportFormat || Parser::OutputFormat::EPL == reportFormat)
+    {
+        reportFormat = Parser::OutputFormat::CSV;
+    }
+
+    std::string reportFilename{c_UncompressedOutputFile.stem().string()};
+    reportFilename += "_";
+    reportFilename += _getReportName(reportType);
+    reportFilename += Parser::getFileExtension(reportFormat);
+    reportFilename += c_IsCompressed ? labellingOutputFile.extension().string() : "";
+
+    return labellingOutputFile.parent_path() / reportFilename;
+}
+
+bool ConnectionReports::_writeReport(const Report_t& report) const
+{
+    const Core::Path_t c_ReportFile{getReportFile(mLabellingOutputFile, report.mReportType)};
+    const Core::CompressingOutputStreamPtr c_pReportStream{std::make_shared<Core::CompressingOutputStream>()};
+
+    bool success{false};
+
+    c_pReportStream->open(c_ReportFile);
+
+    if (c_pReportStream->isOpen())
+    {
+        const Core::OutputSinkPtr c_pOutputSink{Parser::createOutputSink(mOutputFormat, c_pReportStream)};
+
+        success = report.mpReport->write(*c_pOutputSink);
+        success = c_pOutputSink->finish() && success;
+
+        c_pReportStream->close();
+        success = success && !c_pReportStream->fail();
+
+        if (!success)
+        {
+            std::error_code errorCode;
+            (void)std::filesystem::remove(c_ReportFile, errorCode);
+        }
+    }
+
+    return success;
+}
+
+ConnectionReportPtr ConnectionReports::_createReport(const ReportType reportType)
+{
+    ConnectionReportPtr pReport;
+
+    switch(reportType)
+    {
+    case ReportType::BILL_OF_MATERIALS:
+        pReport = std::make_unique<BillOfMaterialsReport>();
+        break;
+    case ReportType::PORT_MAP:
+        pReport = std::make_unique<PortMapReport>();
+        break;
+    case ReportType::POWER_CONNECTIONS:
+        pReport = std::make_unique<PowerConnectionsReport>();
+        break;
+    }
+
+    return pReport;
+}
+
+std::string_view ConnectionReports::_getReportName(const ReportType reportType)
+{
+    std::string_view reportName;
+
+    switch(reportType)
+    {
+    case ReportType::BILL_OF_MATERIALS:
+        reportName = "bom";
+        break;
+    case ReportType::PORT_MAP:
+        reportName = "portmap";
+        break;
+    case ReportType::POWER_CONNECTIONS:
+        reportName = "power";
+        break;
+    }
+
+    return reportName;
+}
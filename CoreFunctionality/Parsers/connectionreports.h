@@ -0,0 +1,65 @@
+#ifndef CONNECTIONREPORTS_H
+#define CONNECTIONREPORTS_H
+
+#include "parser.h"
+#include "connectionreport.h"
+
+/* This class fans the labelled connections out to the reports requested for the run (tee), so the connections are built once and each of them is routed to all reports
+   Once all connections are received, the reports are written concurrently (one thread per report) into files placed next to the labelling table
+   Each report file is named after the labelling table and uses the same format and compression (e.g. labellingtable_bom.jsonl.gz), csv being used for the label printer formats
+*/
+class ConnectionReports
+{
+public:
+    enum class ReportType
+    {
+        BILL_OF_MATERIALS,                      // cable part numbers and quantities
+        PORT_MAP,                               // connected ports of each device
+        POWER_CONNECTIONS                       // labelling table rows of the power connections
+    };
+
+    explicit ConnectionReports(const Core::Path_t& labellingOutputFile);
+
+    ConnectionReports(const ConnectionReports&) = delete;
+    ConnectionReports& operator=(const ConnectionReports&) = delete;
+
+    /* Requesting the same report again has no effect
+    */
+    void addReport(const ReportType reportType);
+
+    void addConnection(const Connection_t& connection);
+
+    /* Writes all reports (a report that cannot be completely written is removed). The collected connections are discarded afterwards
+    */
+    bool write();
+
+    bool isWritingFailed() const;
+
+    /* Report names used on the command line: bom, portmap, power. Returns false for any other name
+    */
+    static bool getReportType(const std::string_view reportName, ReportType& reportType);
+
+    static Core::Path_t getReportFile(const Core::Path_t& labellingOutputFile, const ReportType reportType);
+
+private:
+    struct Report_t
+    {
+        ReportType mReportType;
+        ConnectionReportPtr mpReport;
+    };
+
+    bool _writeReport(const Report_t& report) const;
+
+    static ConnectionReportPtr _createReport(const ReportType reportType);
+    static std::string_view _getReportName(const ReportType reportType);
+
+    const Core::Path_t mLabellingOutputFile;
+    const Parser::OutputFormat mOutputFormat;
+
+    std::vector<Report_t> mReports;
+    bool mIsWritingFailed;
+};
+
+using ConnectionReportsPtr = std::shared_ptr<ConnectionReports>;
+
+#endif // CONNECTIONREPORTS_H
@@ -1,9 +1,19 @@
 #ifndef ISUBPARSER_H
 #define ISUBPARSER_H
 
+#include <vector>
+
 #include "errorhandler.h"
 
-class ISubParserObserver;
+/* Outcome of a sub-parsing session, returned to the parser that launched it
+   The parser applies it to its own row state (current position, column number) and stores the errors
+*/
+struct SubParsingResult_t
+{
+    Core::Index_t mCurrentPosition;         // position following the parsed fields, relative to the data passed to the sub-parser (no value if the data has been entirely consumed)
+    size_t mFileColumnNumber;               // csv column number following the parsed fields
+    std::vector<ErrorPtr> mParsingErrors;
+};
 
 class ISubParser
 {
@@ -13,16 +23,14 @@ public:
     // used for performing specific initializations that cannot be handled within constructor
     virtual void init() {};
 
-    virtual void parseInputData(std::vector<ErrorPtr>& parsingErrors) = 0;
+    /* Parses the (remaining) row data starting at the given csv column number
+       The sub-parser should not get access to any data parsed before it came into action
+    */
+    virtual SubParsingResult_t parseInputData(const std::string_view rawInputData, const size_t fileColumnNumber) = 0;
 
-    virtual void setSubParserObserver(ISubParserObserver* const pISubParserObserver) = 0;
     virtual void setErrorHandler(const ErrorHandlerPtr pErrorHandler) = 0;
-    virtual void setFileColumnNumber(const size_t fileColumnNumber) = 0;
-    virtual void setRawInputData(const std::string_view rawInputData) = 0;
 
-    virtual Core::Index_t getCurrentPosition() const = 0;
     virtual size_t getFileRowNumber() const = 0;
-    virtual size_t getFileColumnNumber() const = 0;
 };
 
 #endif // ISUBPARSER_H
@@ -0,0 +1,217 @@
+#include <charconv>
+
+#include "applicationdata.h"
+#include "parserutils.h"
+#include "labellingindex.h"
+
+LabellingIndex::LabellingIndex(const Core::Path_t& indexFile)
+    : mIndexFile{indexFile}
+    , mReusedRowsCount{0u}
+{
+}
+
+/* Index file format: header row (format name, configuration hash) followed by one row per labelling table row (input row hash, labelling table row without connection number)
+   All hashes are written as hexadecimal numbers, the fields of the labelling table rows being escaped. Reading stops at the first invalid row (the rows read until then are kept)
+*/
+bool LabellingIndex::load()
+{
+    mPreviousOutputRows.clear();
+    mPreviousOutputRowIndexes.clear();
+
+    bool success{false};
+
+    if (std::ifstream indexStream{mIndexFile}; indexStream.is_open())
+    {
+        std::string currentRow;
+        Core::Row_t outputRow;
+        std::uint64_t configurationHash{0u};
+
+        getline(indexStream, currentRow);
+
+        if (const std::string_view c_Header{currentRow}; c_Header.size() == scIndexFileHeader.size() + 1 + scHashDigitsCount &&
+                                                         0 == c_Header.compare(0, scIndexFileHeader.size(), scIndexFileHeader) &&
+                                                         Data::c_CSVSeparator == c_Header[scIndexFileHeader.size()])
+        {
+            const char* const c_pHashBegin{c_Header.data() + scIndexFileHeader.size() + 1};
+            const auto c_Result{std::from_chars(c_pHashBegin, c_pHashBegin + scHashDigitsCount, configurationHash, 16)};
+
+            success = std::errc{} == c_Result.ec && _getConfigurationHash() == configurationHash;
+        }
+
+        for (bool isValidRow{success}; isValidRow && getline(indexStream, currentRow);)
+        {
+            std::uint64_t inputRowHash{0u};
+
+            isValidRow = currentRow.size() > scHashDigitsCount && Data::c_CSVSeparator == currentRow[scHashDigitsCount] &&
+                         std::errc{} == std::from_chars(currentRow.data(), currentRow.data() + scHashDigitsCount, inputRowHash, 16).ec &&
+                         _splitEscapedRow(std::string_view{currentRow}.substr(scHashDigitsCount + 1), outputRow);
+
+            // a row stored more than once (duplicate input rows) is only kept once
+            if (isValidRow && mPreviousOutputRowIndexes.emplace(inputRowHash, mPreviousOutputRows.getRowsCount()).second)
+            {
+                mPreviousOutputRows.appendRow(outputRow);
+            }
+        }
+    }
+
+    return success;
+}
+
+Core::Index_t LabellingIndex::findOutputRow(const std::uint64_t inputRowHash)
+{
+    Core::Index_t outputRowIndex;
+
+    if (const auto c_OutputRowIndexIt{mPreviousOutputRowIndexes.find(inputRowHash)}; mPreviousOutputRowIndexes.cend() != c_OutputRowIndexIt)
+    {
+        outputRowIndex = c_OutputRowIndexIt->second;
+        ++mReusedRowsCount;
+    }
+
+    return outputRowIndex;
+}
+
+void LabellingIndex::appendOutputRowFields(const size_t outputRowIndex, Core::Row_t& outputRow) const
+{
+    std::vector<std::string_view> fields;
+    mPreviousOutputRows.getRow(outputRowIndex, fields);
+
+    outputRow.insert(outputRow.cend(), fields.cbegin(), fields.cend());
+}
+
+void LabellingIndex::addOutputRow(const std::uint64_t inputRowHash, const Core::Row_t& outputRow)
+{
+    std::string indexRow;
+    size_t indexRowSize{0u};
+
+    // an escaped field might need more space, in which case the row still grows
+    for (size_t fieldIndex{1u}; fieldIndex < outputRow.size(); ++fieldIndex)
+    {
+        indexRowSize += outputRow[fieldIndex].size() + 1;
+    }
+
+    indexRow.reserve(indexRowSize);
+
+    for (size_t fieldIndex{1u}; fieldIndex < outputRow.size(); ++fieldIndex)
+    {
+        if (fieldIndex > 1u)
+        {
+            indexRow += Data::c_CSVSeparator;
+        }
+
+        _appendEscapedField(indexRow, outputRow[fieldIndex]);
+    }
+
+    mCurrentOutputRows.emplace_back(inputRowHash, std::move(indexRow));
+}
+
+/* The index is written to a temporary file first so an interrupted run doesn't leave a truncated index behind (and concurrent runs don't write to the same file)
+*/
+bool LabellingIndex::save() const
+{
+    bool success{false};
+
+    const Core::Path_t c_TemporaryIndexFile{Core::getTemporaryFile(mIndexFile)};
+
+    if (std::ofstream indexStream{c_TemporaryIndexFile}; indexStream.is_open())
+    {
+        indexStream << std::hex << std::setfill('0');
+        indexStream << scIndexFileHeader << Data::c_CSVSeparator << std::setw(scHashDigitsCount) << _getConfigurationHash() << "\n";
+
+        for (const auto& [c_InputRowHash, c_OutputRow] : mCurrentOutputRows)
+        {
+            indexStream << std::setw(scHashDigitsCount) << c_InputRowHash << Data::c_CSVSeparator << c_OutputRow << "\n";
+        }
+
+        indexStream.close();
+        success = !indexStream.fail();
+    }
+
+    std::error_code errorCode;
+
+    if (success)
+    {
+        std::filesystem::rename(c_TemporaryIndexFile, mIndexFile, errorCode);
+        success = !errorCode;
+    }
+
+    if (!success)
+    {
+        (void)std::filesystem::remove(c_TemporaryIndexFile, errorCode);
+    }
+
+    return success;
+}
+
+size_t LabellingIndex::getReusedRowsCount() const
+{
+    return mReusedRowsCount;
+}
+
+std::uint64_t LabellingIndex::getInputRowHash(const std::string_view inputRow, const std::string_view cablePartNumber)
+{
+    return Core::getHash64(inputRow, Core::getHash64(cablePartNumber));
+}
+
+Core::Path_t LabellingIndex::getIndexFile(const Core::Path_t& labellingOutputFile)
+{
+    return labellingOutputFile.parent_path() / ("." + labellingOutputFile.filename().string() + ".index");
+}
+
+std::uint64_t LabellingIndex::_getConfigurationHash()
+{
+    return Core::getHash64(scIndexFileHeader, Utilities::Parsers::getConfigurationHash());
+}
+
+void LabellingIndex::_appendEscapedField(std::string& output, const std::string_view field)
+{
+    constexpr char c_EscapedCharacters[]{Data::c_CSVSeparator, scEscapeCharacter, '\0'};
+
+    // most fields contain no characters to escape so they are appended at once
+    if (std::string_view::npos == field.find_first_of(c_EscapedCharacters))
+    {
+        output += field;
+    }
+    else
+    {
+        for (const char c_Character : field)
+        {
+            if (Data::c_CSVSeparator == c_Character || scEscapeCharacter == c_Character)
+            {
+                output += scEscapeCharacter;
+            }
+
+            output += c_Character;
+        }
+    }
+}
+
+bool LabellingIndex::_splitEscapedRow(const std::string_view row, Core::Row_t& fields)
+{
+    bool isEscaped{false};
+
+    fields.clear();
+    fields.emplace_back();
+
+    for (const char c_Character : row)
+    {
+        if (isEscaped)
+        {
+            fields.back() += c_Character;
+            isEscaped = false;
+        }
+        else if (scEscapeCharacter == c_Character)
+        {
+            isEscaped = true;
+        }
+        else if (Data::c_CSVSeparator == c_Character)
+        {
+            fields.emplace_back();
+        }
+        else
+        {
+            fields.back() += c_Character;
+        }
+    }
+
+    return !isEscaped;
+}
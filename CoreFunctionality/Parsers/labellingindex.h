@@ -0,0 +1,84 @@
+#ifndef LABELLINGINDEX_H
+#define LABELLINGINDEX_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "tablerows.h"
+
+namespace Core = Utilities::Core;
+
+/* This class stores the labelling table rows calculated by option 2, each one together with the hash of the connection input row it was calculated from
+   It is saved to a small sidecar file next to the labelling table so the next run only needs to parse and label the connection input rows that changed in the meantime
+   The stored rows are discarded if the label formats or the device catalog changed (the labels calculated with them might be different)
+*/
+class LabellingIndex
+{
+public:
+    explicit LabellingIndex(const Core::Path_t& indexFile);
+
+    LabellingIndex(const LabellingIndex&) = delete;
+    LabellingIndex& operator=(const LabellingIndex&) = delete;
+
+    /* Reads the rows stored by the previous run. Returns false if no (valid) index is available, in which case all connection input rows get labelled
+    */
+    bool load();
+
+    /* Returns the index of the labelling table row stored for the connection input row hash (empty if none is stored)
+    */
+    Core::Index_t findOutputRow(const std::uint64_t inputRowHash);
+
+    /* Appends the fields of a stored labelling table row, which don't include the connection number (it depends on the row position, which might have changed)
+    */
+    void appendOutputRowFields(const size_t outputRowIndex, Core::Row_t& outputRow) const;
+
+    /* Records a labelling table row calculated (or reused) by the current run, the connection number (first field) not being stored
+    */
+    void addOutputRow(const std::uint64_t inputRowHash, const Core::Row_t& outputRow);
+
+    /* Replaces the index file with the rows recorded by the current run (should only be done once the labelling table has been successfully written)
+    */
+    bool save() const;
+
+    size_t getReusedRowsCount() const;
+
+    /* The effective cable part number is part of the hash as it might be carried forward from the previous rows (empty cable part number cell)
+    */
+    static std::uint64_t getInputRowHash(const std::string_view inputRow, const std::string_view cablePartNumber);
+
+    /* The index file is hidden and placed in the same directory as the labelling table (e.g. .labellingtable.csv.index)
+    */
+    static Core::Path_t getIndexFile(const Core::Path_t& labellingOutputFile);
+
+private:
+    /* The stored rows are only valid for the label formats, device catalog and connection input file path they have been calculated with (and for the same index format)
+    */
+    static std::uint64_t _getConfigurationHash();
+
+    /* The fields are joined by the csv separator, the separators and escape characters contained by the fields being escaped
+    */
+    static void _appendEscapedField(std::string& output, const std::string_view field);
+
+    /* Returns false if the row ends with an incomplete escape sequence
+    */
+    static bool _splitEscapedRow(const std::string_view row, Core::Row_t& fields);
+
+    static constexpr std::string_view scIndexFileHeader{"LabelCalculator labelling index v2"};
+    static constexpr char scEscapeCharacter{'\\'};
+    static constexpr size_t scHashDigitsCount{16u};
+
+    const Core::Path_t mIndexFile;
+
+    // rows calculated by the previous run and the index of each one by input row hash
+    Core::TableRows mPreviousOutputRows;
+    std::unordered_map<std::uint64_t, size_t> mPreviousOutputRowIndexes;
+
+    // rows recorded by the current run (already joined as index file rows), in labelling table order
+    std::vector<std::pair<std::uint64_t, std::string>> mCurrentOutputRows;
+
+    size_t mReusedRowsCount;
+};
+
+using LabellingIndexPtr = std::shared_ptr<LabellingIndex>;
+
+#endif // LABELLINGINDEX_H
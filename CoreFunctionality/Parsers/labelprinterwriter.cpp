@@ -0,0 +1,238 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "labelprinterwriter.h"
+
+namespace
+{
+    // the labelling table columns, in this order
+    const std::vector<std::string_view> c_PrinterTemplateVariableNames{"item", "cable", "source_description", "source_label", "destination_description", "destination_label"};
+
+    // 2 x 1 inch wrap label (203 dpi), UTF-8 encoding, field data with hexadecimal escapes (\)
+    constexpr std::string_view c_ZplTemplate{"^XA\n"
+                                             "^CI28\n"
+                                             "^FO20,15^A0N,34,34^FH\\^FD{source_label}^FS\n"
+                                             "^FO20,52^A0N,20,20^FH\\^FD{source_description}^FS\n"
+                                             "^FO20,80^A0N,34,34^FH\\^FD{destination_label}^FS\n"
+                                             "^FO20,117^A0N,20,20^FH\\^FD{destination_description}^FS\n"
+                                             "^FO20,145^A0N,20,20^FH\\^FD#{item}[ / {cable}]^FS\n"
+                                             "^XZ\n"};
+
+    // same layout, the label buffer being cleared before and printed once after the fields
+    constexpr std::string_view c_EplTemplate{"\nN\n"
+                                             "A20,15,0,4,1,1,N,\"{source_label}\"\n"
+                                             "A20,52,0,2,1,1,N,\"{source_description}\"\n"
+                                             "A20,80,0,4,1,1,N,\"{destination_label}\"\n"
+                                             "A20,117,0,2,1,1,N,\"{destination_description}\"\n"
+                                             "A20,145,0,2,1,1,N,\"#{item}[ / {cable}]\"\n"
+                                             "P1\n"};
+
+    constexpr size_t c_PrinterTemplateVariablesCount{6u};
+    constexpr size_t c_ChunkNumberDigitsCount{4u};
+}
+
+LabelPrinterWriter::LabelPrinterWriter(const PrinterLanguage printerLanguage, const size_t threadsCount)
+    : mPrinterLanguage{printerLanguage}
+    , mTemplate{_getTemplate(printerLanguage)}
+    , mThreadsCount{threadsCount > 0u ? threadsCount : std::max(1u, std::thread::hardware_concurrency())}
+{
+}
+
+/* The chunks are rendered in waves of one chunk per thread and written in order after each wave, so the memory use doesn't depend on the number of labels
+*/
+bool LabelPrinterWriter::write(const Core::OutputStreamPtr pOutputStream, const Core::TableRows& rows) const
+{
+    bool success{pOutputStream && pOutputStream->good()};
+
+    const size_t c_ChunksCount{_getChunksCount(rows)};
+    std::vector<std::string> renderedChunks(std::min(mThreadsCount, c_ChunksCount));
+
+    for (size_t firstChunkIndex{0u}; success && firstChunkIndex < c_ChunksCount; firstChunkIndex += renderedChunks.size())
+    {
+        const size_t c_WaveChunksCount{std::min(renderedChunks.size(), c_ChunksCount - firstChunkIndex)};
+
+        (void)_runInParallel(firstChunkIndex, c_WaveChunksCount, [this, &rows, &renderedChunks, firstChunkIndex](const size_t chunkIndex) {
+            _renderChunk(rows, chunkIndex, renderedChunks[chunkIndex - firstChunkIndex]);
+            return true;
+        });
+
+        for (size_t waveChunkIndex{0u}; waveChunkIndex < c_WaveChunksCount; ++waveChunkIndex)
+        {
+            pOutputStream->write(renderedChunks[waveChunkIndex].data(), static_cast<std::streamsize>(renderedChunks[waveChunkIndex].size()));
+        }
+
+        success = !pOutputStream->fail();
+    }
+
+    return success;
+}
+
+bool LabelPrinterWriter::writeToSpool(const Core::Path_t& spoolDir, const std::string_view jobName, const Core::TableRows& rows) const
+{
+    std::error_code errorCode;
+    bool success{std::filesystem::is_directory(spoolDir, errorCode)};
+
+    if (success)
+    {
+        const std::string_view c_FileExtension{getFileExtension(mPrinterLanguage)};
+
+        success = _runInParallel(0u, _getChunksCount(rows), [this, &rows, &spoolDir, jobName, c_FileExtension](const size_t chunkIndex) {
+            std::string chunkNumber{std::to_string(chunkIndex + 1)};
+            chunkNumber.insert(0u, c_ChunkNumberDigitsCount - std::min(c_ChunkNumberDigitsCount, chunkNumber.size()), '0');
+
+            const Core::Path_t c_ChunkFile{spoolDir / (std::string{jobName} + "_" + chunkNumber + std::string{c_FileExtension})};
+            const Core::Path_t c_TemporaryFile{Core::getTemporaryFile(c_ChunkFile)};
+            std::string renderedChunk;
+
+            _renderChunk(rows, chunkIndex, renderedChunk);
+
+            bool isChunkWritten{false};
+
+            if (std::ofstream chunkStream{c_TemporaryFile, std::ios::binary}; chunkStream.is_open())
+            {
+                chunkStream.write(renderedChunk.data(), static_cast<std::streamsize>(renderedChunk.size()));
+                chunkStream.close();
+                isChunkWritten = !chunkStream.fail() && Core::replaceFile(c_TemporaryFile, c_ChunkFile);
+            }
+
+            if (!isChunkWritten)
+            {
+                std::error_code removalErrorCode;
+                (void)std::filesystem::remove(c_TemporaryFile, removalErrorCode);
+            }
+
+            return isChunkWritten;
+        });
+    }
+
+    return success;
+}
+
+std::string_view LabelPrinterWriter::getFileExtension(const PrinterLanguage printerLanguage)
+{
+    return PrinterLanguage::EPL == printerLanguage ? ".epl" : ".zpl";
+}
+
+bool LabelPrinterWriter::_runInParallel(const size_t firstChunkIndex, const size_t chunksCount, const std::function<bool(size_t)>& task) const
+{
+    std::atomic<size_t> nextChunkIndex{firstChunkIndex};
+    std::atomic<bool> success{true};
+
+    auto runTasks{[&nextChunkIndex, &success, &task, c_EndChunkIndex{firstChunkIndex + chunksCount}]() {
+        for (size_t chunkIndex{nextChunkIndex++}; chunkIndex < c_EndChunkIndex; chunkIndex = nextChunkIndex++)
+        {
+            if (!task(chunkIndex))
+            {
+                success = false;
+            }
+        }
+    }};
+
+    // the calling thread takes its share of the chunks too
+    std::vector<std::thread> threads;
+    const size_t c_ThreadsCount{std::min(mThreadsCount, chunksCount)};
+
+    for (size_t threadIndex{1u}; threadIndex < c_ThreadsCount; ++threadIndex)
+    {
+        threads.emplace_back(runTasks);
+    }
+
+    runTasks();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return success;
+}
+
+void LabelPrinterWriter::_renderChunk(const Core::TableRows& rows, const size_t chunkIndex, std::string& output) const
+{
+    const size_t c_FirstRowIndex{chunkIndex * scLabelsPerChunk};
+    const size_t c_EndRowIndex{std::min(rows.getRowsCount(), c_FirstRowIndex + scLabelsPerChunk)};
+
+    std::vector<std::string_view> rowFields;
+    std::array<std::string, c_PrinterTemplateVariablesCount> escapedFields;
+    std::array<std::string_view, c_PrinterTemplateVariablesCount> values;
+
+    output.clear();
+    output.reserve((c_EndRowIndex - c_FirstRowIndex) * scEstimatedLabelSize);
+
+    for (size_t rowIndex{c_FirstRowIndex}; rowIndex < c_EndRowIndex; ++rowIndex)
+    {
+        rows.getRow(rowIndex, rowFields);
+
+        // missing fields stay empty
+        for (size_t fieldIndex{0u}; fieldIndex < c_PrinterTemplateVariablesCount; ++fieldIndex)
+        {
+            escapedFields[fieldIndex].clear();
+
+            if (fieldIndex < rowFields.size())
+            {
+                _appendEscapedField(escapedFields[fieldIndex], rowFields[fieldIndex]);
+            }
+
+            values[fieldIndex] = escapedFields[fieldIndex];
+        }
+
+        mTemplate.render(output, values);
+    }
+}
+
+/* The templates are built-in so they are expected to compile
+*/
+const Core::FormatTemplate& LabelPrinterWriter::_getTemplate(const PrinterLanguage printerLanguage)
+{
+    static const auto c_CompileTemplate{[](const std::string_view pattern) {
+        Core::FormatTemplate formatTemplate;
+        const bool c_IsValidTemplate{formatTemplate.compile(pattern, c_PrinterTemplateVariableNames)};
+        ASSERT(c_IsValidTemplate, "Invalid built-in printer template");
+
+        return formatTemplate;
+    }};
+
+    static const Core::FormatTemplate c_ZplFormatTemplate{c_CompileTemplate(c_ZplTemplate)};
+    static const Core::FormatTemplate c_EplFormatTemplate{c_CompileTemplate(c_EplTemplate)};
+
+    return PrinterLanguage::EPL == printerLanguage ? c_EplFormatTemplate : c_ZplFormatTemplate;
+}
+
+size_t LabelPrinterWriter::_getChunksCount(const Core::TableRows& rows)
+{
+    return (rows.getRowsCount() + scLabelsPerChunk - 1) / scLabelsPerChunk;
+}
+
+/* The control characters are discarded as they might be interpreted by the printer
+*/
+void LabelPrinterWriter::_appendEscapedField(std::string& output, const std::string_view field) const
+{
+    constexpr std::string_view c_HexDigits{"0123456789ABCDEF"};
+
+    for (const char c_Character : field)
+    {
+        const unsigned char c_Code{static_cast<unsigned char>(c_Character)};
+
+        if (c_Code < 0x20u)
+        {
+            continue;
+        }
+
+        if (PrinterLanguage::ZPL == mPrinterLanguage && ('\\' == c_Character || '^' == c_Character || '~' == c_Character))
+        {
+            output += '\\';
+            output += c_HexDigits[c_Code >> 4];
+            output += c_HexDigits[c_Code & 0x0Fu];
+        }
+        else if (PrinterLanguage::EPL == mPrinterLanguage && ('\\' == c_Character || '"' == c_Character))
+        {
+            output += '\\';
+            output += c_Character;
+        }
+        else
+        {
+            output += c_Character;
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef LABELPRINTERWRITER_H
+#define LABELPRINTERWRITER_H
+
+#include <vector>
+#include <functional>
+
+#include "formattemplate.h"
+#include "tablerows.h"
+
+namespace Core = Utilities::Core;
+
+/* This class turns the labelling table rows into label printer commands (ZPL for Zebra printers, EPL for the older Eltron/Zebra ones), one wrap label per connection
+   Each label contains the labels and descriptions of both connection ends followed by the connection number and cable part number
+   The printer templates are compiled once per process. The rows are rendered in chunks of a spool-friendly size, the chunks being rendered (and, for a spool directory, written) in parallel
+*/
+class LabelPrinterWriter
+{
+public:
+    enum class PrinterLanguage
+    {
+        ZPL,
+        EPL
+    };
+
+    /* The number of threads is capped to the number of chunks (0 means: use the hardware concurrency)
+    */
+    LabelPrinterWriter(const PrinterLanguage printerLanguage, const size_t threadsCount = 0u);
+
+    LabelPrinterWriter(const LabelPrinterWriter&) = delete;
+    LabelPrinterWriter& operator=(const LabelPrinterWriter&) = delete;
+
+    /* Writes all labels to the stream (in the order of the rows). The rows should be labelling table rows without header
+    */
+    bool write(const Core::OutputStreamPtr pOutputStream, const Core::TableRows& rows) const;
+
+    /* Writes each chunk into its own file within the spool directory, named by the job name and the chunk number (e.g. rack01_labellingtable_0001.zpl)
+       A chunk file only appears under its final name once completely written so the spooler never picks up partial jobs
+    */
+    bool writeToSpool(const Core::Path_t& spoolDir, const std::string_view jobName, const Core::TableRows& rows) const;
+
+    static std::string_view getFileExtension(const PrinterLanguage printerLanguage);
+
+private:
+    /* Runs the task on all chunks from the given range, each chunk being handled by exactly one thread. Returns false if any task failed
+    */
+    bool _runInParallel(const size_t firstChunkIndex, const size_t chunksCount, const std::function<bool(size_t)>& task) const;
+
+    void _renderChunk(const Core::TableRows& rows, const size_t chunkIndex, std::string& output) const;
+
+    static const Core::FormatTemplate& _getTemplate(const PrinterLanguage printerLanguage);
+    static size_t _getChunksCount(const Core::TableRows& rows);
+
+    /* The field data is escaped according to the printer language (ZPL: hexadecimal escapes, EPL: backslash escapes)
+    */
+    void _appendEscapedField(std::string& output, const std::string_view field) const;
+
+    // labels per chunk: large jobs are split so the printer can start while the next chunks are spooled
+    static constexpr size_t scLabelsPerChunk{500u};
+
+    // rendered bytes per label, only used for reserving the chunk capacity
+    static constexpr size_t scEstimatedLabelSize{320u};
+
+    const PrinterLanguage mPrinterLanguage;
+    const Core::FormatTemplate& mTemplate;
+    const size_t mThreadsCount;
+};
+
+#endif // LABELPRINTERWRITER_H
@@ -0,0 +1,140 @@
+#include <charconv>
+
+#include "applicationdata.h"
+#include "parserutils.h"
+#include "outputstamp.h"
+
+OutputStamp::OutputStamp(const ParserCreator::ParserTypes parserType, const Core::Path_t& inputFile, const Core::Path_t& outputFile)
+    : mParserType{parserType}
+    , mInputFile{inputFile}
+    , mOutputFile{outputFile}
+    , mInputHash{0u}
+    , mIsInputHashed{false}
+    , mPreviousInputHash{0u}
+    , mPreviousOutputHash{0u}
+    , mIsPreviousStampAvailable{false}
+{
+}
+
+/* Stamp file format: a single row containing the format name, the input hash and the output hash (hexadecimal numbers)
+   The input hash also covers the operation and the settings the output depends on, so changing any of them invalidates the stamp
+*/
+bool OutputStamp::load()
+{
+    std::uint64_t inputHash{_getInputHashSeed()};
+
+    mIsInputHashed = Core::getFileHash64(mInputFile, inputHash, inputHash);
+    mInputHash = inputHash;
+
+    _loadPreviousStamp();
+
+    return mIsInputHashed;
+}
+
+bool OutputStamp::load(const std::string_view inputContent)
+{
+    mInputHash = Core::getHash64(inputContent, _getInputHashSeed());
+    mIsInputHashed = true;
+
+    _loadPreviousStamp();
+
+    return mIsInputHashed;
+}
+
+/* The output file is hashed too as it might have been edited or replaced in the meantime (e.g. the connection input file written by option 1 gets filled in by the user)
+*/
+bool OutputStamp::isOutputUpToDate() const
+{
+    bool isUpToDate{false};
+
+    if (mIsInputHashed && mIsPreviousStampAvailable && mPreviousInputHash == mInputHash)
+    {
+        std::uint64_t outputHash{0u};
+        isUpToDate = Core::getFileHash64(mOutputFile, outputHash) && mPreviousOutputHash == outputHash;
+    }
+
+    return isUpToDate;
+}
+
+bool OutputStamp::save() const
+{
+    std::uint64_t outputHash{0u};
+    const bool c_Success{mIsInputHashed && Core::getFileHash64(mOutputFile, outputHash) && _saveStamp(outputHash)};
+
+    return c_Success;
+}
+
+bool OutputStamp::save(const std::string_view outputContent) const
+{
+    const bool c_Success{mIsInputHashed && _saveStamp(Core::getHash64(outputContent))};
+
+    return c_Success;
+}
+
+Core::Path_t OutputStamp::getStampFile(const Core::Path_t& outputFile)
+{
+    return outputFile.parent_path() / ("." + outputFile.filename().string() + ".stamp");
+}
+
+std::uint64_t OutputStamp::_getInputHashSeed() const
+{
+    const std::uint64_t c_HeaderHash{Core::getHash64(scStampFileHeader, Utilities::Parsers::getConfigurationHash())};
+
+    return Core::getHash64(std::to_string(static_cast<int>(mParserType)), c_HeaderHash);
+}
+
+void OutputStamp::_loadPreviousStamp()
+{
+    mIsPreviousStampAvailable = false;
+
+    if (std::ifstream stampStream{getStampFile(mOutputFile)}; mIsInputHashed && stampStream.is_open())
+    {
+        std::string stampRow;
+        getline(stampStream, stampRow);
+
+        const std::string_view c_StampRow{stampRow};
+        const size_t c_InputHashPosition{scStampFileHeader.size() + 1};
+        const size_t c_OutputHashPosition{c_InputHashPosition + scHashDigitsCount + 1};
+
+        if (c_StampRow.size() == c_OutputHashPosition + scHashDigitsCount && 0 == c_StampRow.compare(0, scStampFileHeader.size(), scStampFileHeader) &&
+            Data::c_CSVSeparator == c_StampRow[c_InputHashPosition - 1] && Data::c_CSVSeparator == c_StampRow[c_OutputHashPosition - 1])
+        {
+            const char* const c_pInputHashBegin{c_StampRow.data() + c_InputHashPosition};
+            const char* const c_pOutputHashBegin{c_StampRow.data() + c_OutputHashPosition};
+
+            mIsPreviousStampAvailable = std::errc{} == std::from_chars(c_pInputHashBegin, c_pInputHashBegin + scHashDigitsCount, mPreviousInputHash, 16).ec &&
+                                        std::errc{} == std::from_chars(c_pOutputHashBegin, c_pOutputHashBegin + scHashDigitsCount, mPreviousOutputHash, 16).ec;
+        }
+    }
+}
+
+/* The stamp is written to a temporary file first so an interrupted run doesn't leave a truncated stamp behind (and concurrent runs don't write to the same file)
+*/
+bool OutputStamp::_saveStamp(const std::uint64_t outputHash) const
+{
+    const Core::Path_t c_StampFile{getStampFile(mOutputFile)};
+    const Core::Path_t c_TemporaryStampFile{Core::getTemporaryFile(c_StampFile)};
+
+    std::ofstream stampStream{c_TemporaryStampFile};
+
+    stampStream << std::hex << std::setfill('0');
+    stampStream << scStampFileHeader << Data::c_CSVSeparator << std::setw(scHashDigitsCount) << mInputHash << Data::c_CSVSeparator << std::setw(scHashDigitsCount) << outputHash << "\n";
+
+    stampStream.close();
+    bool success{!stampStream.fail()}; // also set if the file could not be opened
+
+    std::error_code errorCode;
+
+    if (success)
+    {
+        std::filesystem::rename(c_TemporaryStampFile, c_StampFile, errorCode);
+        success = !errorCode;
+    }
+
+    if (!success)
+    {
+        (void)std::filesystem::remove(c_TemporaryStampFile, errorCode);
+    }
+
+    return success;
+}
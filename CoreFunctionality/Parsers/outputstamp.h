@@ -0,0 +1,63 @@
+#ifndef OUTPUTSTAMP_H
+#define OUTPUTSTAMP_H
+
+#include "parsercreator.h"
+
+/* This class records which input (and settings) an output file has been written from, by storing the hashes of the input and output file contents in a small sidecar file
+   If neither the input file, the settings nor the output file changed since the previous run, the output is up to date and the run can be skipped entirely (no parsing, writing or backup)
+*/
+class OutputStamp
+{
+public:
+    OutputStamp(const ParserCreator::ParserTypes parserType, const Core::Path_t& inputFile, const Core::Path_t& outputFile);
+
+    OutputStamp(const OutputStamp&) = delete;
+    OutputStamp& operator=(const OutputStamp&) = delete;
+
+    /* Hashes the input file content (should be done before parsing it) and reads the stamp saved by the previous run
+       Returns false if the input file cannot be read, in which case the stamp cannot be saved either
+    */
+    bool load();
+
+    /* Same as above for an input file content that has already been read (e.g. by the batch mode), so the input file is not read again
+    */
+    bool load(const std::string_view inputContent);
+
+    /* Returns true if the stamp of the previous run matches both the (loaded) input and the current output file content
+    */
+    bool isOutputUpToDate() const;
+
+    /* Replaces the stamp file with the hashes of the loaded input and of the output file (should only be done once the output file has been successfully written)
+    */
+    bool save() const;
+
+    /* Same as above for an output file content that is still available in memory (the output file is not read again)
+    */
+    bool save(const std::string_view outputContent) const;
+
+    /* The stamp file is hidden and placed in the same directory as the output file (e.g. .labellingtable.csv.stamp)
+    */
+    static Core::Path_t getStampFile(const Core::Path_t& outputFile);
+
+private:
+    std::uint64_t _getInputHashSeed() const;
+    void _loadPreviousStamp();
+    bool _saveStamp(const std::uint64_t outputHash) const;
+
+    static constexpr std::string_view scStampFileHeader{"LabelCalculator output stamp v1"};
+    static constexpr size_t scHashDigitsCount{16u};
+
+    const ParserCreator::ParserTypes mParserType;
+    const Core::Path_t mInputFile;
+    const Core::Path_t mOutputFile;
+
+    std::uint64_t mInputHash;
+    bool mIsInputHashed;
+
+    // hashes read from the stamp file of the previous run (if any)
+    std::uint64_t mPreviousInputHash;
+    std::uint64_t mPreviousOutputHash;
+    bool mIsPreviousStampAvailable;
+};
+
+#endif // OUTPUTSTAMP_H
@@ -1,6 +1,11 @@
-#include <algorithm>
-
+#include "csvoutputsink.h"
+#include "jsonlinesoutputsink.h"
+#include "binaryoutputsink.h"
+#include "xlsxoutputsink.h"
+#include "compression.h"
+#include "labelprinterwriter.h"
 #include "isubparser.h"
+#include "aggregatederrorreport.h"
 #include "parser.h"
 
 Parser::Parser(const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream, const std::string_view header)
@@ -10,16 +15,23 @@ Parser::Parser(const Core::InputStreamPtr pInputStream, const Core::OutputStream
     , mParserOutput{header}
     , mpErrorHandler{nullptr}
     , mIsResetRequired{false}
+    , mOutputFormat{OutputFormat::CSV}
+    , mIsLabelSpoolingFailed{false}
+    , mIsValidationOnly{false}
+    , mMaxErrorsCount{0u}
+    , mIsParsingStopped{false}
+    , mIsErrorReportAggregated{false}
+    , mIsPartialOutputAllowed{false}
 {
-    if (mpInputStream  && mpInputStream->is_open()  &&
-        mpOutputStream && mpOutputStream->is_open() &&
-        mpErrorStream  && mpErrorStream->is_open())
+    if (mpInputStream  && mpInputStream->good()  &&
+        mpOutputStream && mpOutputStream->good() &&
+        mpErrorStream  && mpErrorStream->good())
     {
         mpErrorHandler = std::make_shared<ErrorHandler>(mpErrorStream);
     }
     else
     {
-        ASSERT(false, "At least one of the file streams is invalid or not open");
+        ASSERT(false, "At least one of the streams is invalid or not open");
     }
 }
 
@@ -43,7 +55,8 @@ bool Parser::parse()
 
     const bool c_ParsingErrorsOccurred{_parseInput()};
 
-    if(!c_ParsingErrorsOccurred)
+    // with partial output the rows containing errors are marked by the derived parser when building the output
+    if((!c_ParsingErrorsOccurred || (mIsPartialOutputAllowed && _isPartialOutputSupported())) && !mIsValidationOnly)
     {
         _buildOutput();
         _writeOutput();
@@ -52,25 +65,174 @@ bool Parser::parse()
     return c_ParsingErrorsOccurred;
 }
 
-void Parser::subParserFinished(ISubParser* const pISubParser)
+void Parser::setOutputFormat(const OutputFormat outputFormat)
+{
+    mOutputFormat = outputFormat;
+}
+
+Parser::OutputFormat Parser::getOutputFormat(const Core::Path_t& outputFile)
+{
+    const Core::Path_t c_UncompressedOutputFile{Core::CompressionFormat::NONE != Core::getCompressionFormat(outputFile) ? outputFile.stem() : outputFile.filename()};
+
+    std::string extension{c_UncompressedOutputFile.extension().string()};
+    Core::convertStringCase(extension, false);
+
+    OutputFormat outputFormat{OutputFormat::CSV};
+
+    if (".xlsx" == extension)
+    {
+        outputFormat = OutputFormat::XLSX;
+    }
+    else if (".jsonl" == extension)
+    {
+        outputFormat = OutputFormat::JSONL;
+    }
+    else if (".bin" == extension)
+    {
+        outputFormat = OutputFormat::BINARY;
+    }
+    else if (".zpl" == extension)
+    {
+        outputFormat = OutputFormat::ZPL;
+    }
+    else if (".epl" == extension)
+    {
+        outputFormat = OutputFormat::EPL;
+    }
+
+    return outputFormat;
+}
+
+std::string_view Parser::getFileExtension(const OutputFormat outputFormat)
 {
-    if (pISubParser && _isValidSubParser(pISubParser))
+    std::string_view extension;
+
+    switch(outputFormat)
     {
-        _retrieveRequiredDataFromSubParser(pISubParser);
+    case OutputFormat::CSV:
+        extension = ".csv";
+        break;
+    case OutputFormat::XLSX:
+        extension = ".xlsx";
+        break;
+    case OutputFormat::JSONL:
+        extension = ".jsonl";
+        break;
+    case OutputFormat::BINARY:
+        extension = ".bin";
+        break;
+    case OutputFormat::ZPL:
+        extension = ".zpl";
+        break;
+    case OutputFormat::EPL:
+        extension = ".epl";
+        break;
+    }
+
+    return extension;
+}
 
-        // file row numbering starts at 1 and the first row is reserved for the header so payload rows start at 2 (row number already checked, sub-parser is valid)
-        const size_t c_RowIndex{pISubParser->getFileRowNumber() - 2};
+Core::OutputSinkPtr Parser::createOutputSink(const OutputFormat outputFormat, const Core::OutputStreamPtr pOutputStream)
+{
+    Core::OutputSinkPtr pOutputSink;
 
-        // no matter the retrieved data this flag needs to be updated to signal that the row is free for further parsing
-        mParserInput[c_RowIndex].mIsSubParserActive = false;
+    switch(outputFormat)
+    {
+    case OutputFormat::XLSX:
+        pOutputSink = std::make_unique<Core::XlsxOutputSink>(pOutputStream);
+        break;
+    case OutputFormat::JSONL:
+        pOutputSink = std::make_unique<Core::JsonLinesOutputSink>(pOutputStream);
+        break;
+    case OutputFormat::BINARY:
+        pOutputSink = std::make_unique<Core::BinaryOutputSink>(pOutputStream);
+        break;
+    default:
+        pOutputSink = std::make_unique<Core::CsvOutputSink>(pOutputStream);
+        break;
     }
+
+    return pOutputSink;
+}
+
+/* The job name is the output filename without extensions (e.g. rack01_labellingtable for rack01_labellingtable.csv.gz)
+*/
+void Parser::setLabelSpool(const Core::Path_t& spoolDir, const Core::Path_t& outputFile)
+{
+    const Core::Path_t c_UncompressedOutputFile{Core::CompressionFormat::NONE != Core::getCompressionFormat(outputFile) ? outputFile.stem() : outputFile.filename()};
+
+    mLabelSpoolDir = spoolDir;
+    mLabelSpoolJobName = c_UncompressedOutputFile.stem().string();
+}
+
+bool Parser::isLabelSpoolingFailed() const
+{
+    return mIsLabelSpoolingFailed;
+}
+
+void Parser::setValidationOnly(const bool validationOnly)
+{
+    mIsValidationOnly = validationOnly;
+}
+
+void Parser::setMaxErrorsCount(const size_t maxErrorsCount)
+{
+    mMaxErrorsCount = maxErrorsCount;
+}
+
+void Parser::setErrorReportAggregated(const bool errorReportAggregated)
+{
+    mIsErrorReportAggregated = errorReportAggregated;
+}
+
+void Parser::setPartialOutputAllowed(const bool partialOutputAllowed)
+{
+    mIsPartialOutputAllowed = partialOutputAllowed;
+}
+
+void Parser::setInputFile(const Core::Path_t& inputFile)
+{
+    mInputFile = inputFile;
+}
+
+size_t Parser::getInputRowsCount() const
+{
+    return mParserInput.size();
+}
+
+std::map<Core::Error_t, size_t> Parser::getParsingErrorsCount() const
+{
+    std::map<Core::Error_t, size_t> parsingErrorsCount;
+
+    for (const auto& c_pError : mParsingErrors)
+    {
+        if (c_pError)
+        {
+            ++parsingErrorsCount[c_pError->getErrorCode()];
+        }
+    }
+
+    return parsingErrorsCount;
+}
+
+const Core::Path_t& Parser::_getInputFile() const
+{
+    return mInputFile;
 }
 
 void Parser::_reset()
 {
+    _destroySubParsers(); // owned by the rows of the previous parsing session
     mParserInput.clear();
     mParserOutput.mData.clear();
     mParsingErrors.clear();
+    mIsLabelSpoolingFailed = false;
+    mIsParsingStopped = false;
+}
+
+bool Parser::_isPartialOutputSupported() const
+{
+    return false;
 }
 
 ErrorPtr Parser::_logError(const Core::Error_t errorCode, const size_t fileRowNumber, bool force)
@@ -96,22 +258,65 @@ ErrorPtr Parser::_logError(const Core::Error_t errorCode, const size_t fileRowNu
     return result;
 }
 
+ErrorPtr Parser::_logError(const Core::Error_t errorCode, const size_t fileRowNumber, const size_t fileColumnNumber, const size_t relatedFileRowNumber)
+{
+    ErrorPtr result{nullptr};
+
+    if (mpErrorHandler && fileRowNumber > 1u)
+    {
+        result = mpErrorHandler->logError(errorCode, fileRowNumber, fileColumnNumber, relatedFileRowNumber);
+    }
+
+    return result;
+}
+
 void Parser::_storeParsingError(ErrorPtr pError)
 {
-    if (pError)
+    if (pError && !_isErrorsLimitReached())
     {
         mParsingErrors.push_back(pError);
+
+        // file row numbering starts at 1 and the first row is reserved for the header (so payload rows start at 2)
+        if (const size_t c_FileRowNumber{pError->getFileRowNumber()}; c_FileRowNumber > 1u && c_FileRowNumber - 2 < mParserInput.size())
+        {
+            mParserInput[c_FileRowNumber - 2].mAreParsingErrorsContained = true;
+        }
+    }
+    else if (pError)
+    {
+        mIsParsingStopped = true;
     }
 }
 
 bool Parser::_logParsingErrorsToFile()
 {
-    for(auto& pError : mParsingErrors)
+    if (mIsErrorReportAggregated && !mParsingErrors.empty())
     {
-        if (pError)
+        AggregatedErrorReport aggregatedErrorReport{mpErrorStream};
+
+        for(const auto& pError : mParsingErrors)
         {
-            pError->execute();
+            aggregatedErrorReport.addError(pError);
         }
+
+        aggregatedErrorReport.write();
+    }
+    else
+    {
+        for(auto& pError : mParsingErrors)
+        {
+            if (pError)
+            {
+                pError->execute();
+            }
+        }
+    }
+
+    // the note is only added if errors have actually been suppressed (not if the last error of the input just reached the limit)
+    if (mIsParsingStopped && mpErrorStream && mpErrorStream->good())
+    {
+        *mpErrorStream << "Note: the maximum number of errors (" << mMaxErrorsCount << ") has been reached so parsing was stopped.\n";
+        *mpErrorStream << "Any further errors from the input file have been suppressed.\n\n";
     }
 
     const bool c_ParsingErrorsOccurred{mParsingErrors.size() > 0};
@@ -123,7 +328,7 @@ bool Parser::_isInputStreamConsumed() const
 {
     bool inputConsumed{true};
 
-    if (mpInputStream && mpInputStream->is_open() && !mpInputStream->eof())
+    if (mpInputStream && mpInputStream->good())
     {
         inputConsumed = false;
     }
@@ -135,14 +340,14 @@ bool Parser::_readLineAndAppendToInput()
 {
     bool success{false};
 
-    if (mpInputStream && mpInputStream->is_open() && !mpInputStream->eof())
+    if (mpInputStream && mpInputStream->good())
     {
         std::string input;
         getline(*mpInputStream, input);
 
-        if (Core::areParseableCharactersContained(input))
+        if (const size_t c_ParseableContentEnd{Core::getParseableCharactersEnd(input)}; c_ParseableContentEnd > 0u)
         {
-            mParserInput.emplace_back(input);
+            mParserInput.emplace_back(input, c_ParseableContentEnd);
             success = true;
         }
     }
@@ -150,6 +355,33 @@ bool Parser::_readLineAndAppendToInput()
     return success;
 }
 
+bool Parser::_readPayloadRow()
+{
+    bool isRowRead{false};
+
+    // empty rows are skipped
+    while (!isRowRead && !_isInputStreamConsumed())
+    {
+        isRowRead = _readLineAndAppendToInput();
+    }
+
+    return isRowRead;
+}
+
+bool Parser::_isPayloadRowRemaining()
+{
+    bool isRowRemaining{false};
+
+    while (!isRowRemaining && !_isInputStreamConsumed())
+    {
+        std::string input;
+        getline(*mpInputStream, input);
+        isRowRemaining = Core::getParseableCharactersEnd(input) > 0u;
+    }
+
+    return isRowRemaining;
+}
+
 bool Parser::_readFirstCell(const size_t rowIndex, std::string& firstCell)
 {
     bool success{false};
@@ -194,16 +426,22 @@ void Parser::_moveToNextInputColumn(const size_t rowIndex)
     }
 }
 
-std::string Parser::_getUnparsedCellsContent(const size_t rowIndex) const
+bool Parser::_isParseableContentRemaining(const size_t rowIndex) const
 {
-    std::string result;
+    return _isValidCurrentPosition(rowIndex) && mParserInput[rowIndex].mCurrentPosition.value() < mParserInput[rowIndex].mParseableContentEnd;
+}
 
-    if (_isValidCurrentPosition(rowIndex))
+std::string_view Parser::_getParseableRowContent(const size_t rowIndex) const
+{
+    std::string_view parseableRowContent;
+
+    if (rowIndex < mParserInput.size())
     {
-        result.append(mParserInput[rowIndex].mRowData.substr(mParserInput[rowIndex].mCurrentPosition.value()));
+        parseableRowContent = mParserInput[rowIndex].mRowData;
+        parseableRowContent = parseableRowContent.substr(0, mParserInput[rowIndex].mParseableContentEnd);
     }
 
-    return result;
+    return parseableRowContent;
 }
 
 bool Parser::_isValidCurrentPosition(const size_t rowIndex) const
@@ -219,11 +457,11 @@ size_t Parser::_getInputRowsCount() const
     return mParserInput.size();
 }
 
-void Parser::_appendRowToOutput(const std::string& rowContent, const size_t timesToAppend)
+void Parser::_appendRowToOutput(const Core::Row_t& row, const size_t timesToAppend)
 {
     for (size_t appendNumber{0}; appendNumber < timesToAppend; ++appendNumber)
     {
-        mParserOutput.mData.push_back(rowContent);
+        mParserOutput.mData.appendRow(row);
     }
 }
 
@@ -237,47 +475,30 @@ void Parser::_registerSubParser(ISubParser* const pISubParser)
             if (const size_t c_RowIndex{c_FileRowNumber - 2}; c_RowIndex < mParserInput.size())
             {
                 mParserInput[c_RowIndex].mRegisteredSubParsers.push_back(pISubParser);
-                pISubParser->setSubParserObserver(this);
                 pISubParser->setErrorHandler(mpErrorHandler);
             }
         }
     }
 }
 
-bool Parser::_activateSubParser(const size_t rowIndex, const size_t subParserIndex)
+void Parser::_doSubParsing(const size_t rowIndex, const size_t subParserIndex, std::vector<ErrorPtr>& parsingErrors)
 {
-    bool success{false};
-
-    if (rowIndex < mParserInput.size() && subParserIndex < mParserInput[rowIndex].mRegisteredSubParsers.size())
+    if (ISubParser* const pISubParser{_getSubParser(rowIndex, subParserIndex)}; pISubParser)
     {
-        if (ISubParser* const pISubParser{mParserInput[rowIndex].mRegisteredSubParsers[subParserIndex]};
-            pISubParser && !mParserInput[rowIndex].mIsSubParserActive)
-        {
-            std::string_view dataToPass{""};
-
-            // the sub-parser should not get access to any data parsed before it came into action
-            if (mParserInput[rowIndex].mCurrentPosition.has_value())
-            {
-                dataToPass = mParserInput[rowIndex].mRowData;
-                dataToPass.remove_prefix(mParserInput[rowIndex].mCurrentPosition.value());
-            }
-
-            pISubParser->init();
-            pISubParser->setRawInputData(dataToPass);
-            pISubParser->setFileColumnNumber(mParserInput[rowIndex].mFileColumnNumber);
+        std::string_view dataToPass{""};
 
-            success = true;
+        // the sub-parser should not get access to any data parsed before it came into action
+        if (_isValidCurrentPosition(rowIndex))
+        {
+            dataToPass = mParserInput[rowIndex].mRowData;
+            dataToPass.remove_prefix(mParserInput[rowIndex].mCurrentPosition.value());
         }
-    }
 
-    return success;
-}
+        pISubParser->init();
 
-void Parser::_doSubParsing(const size_t rowIndex, const size_t subParserIndex, std::vector<ErrorPtr>& parsingErrors)
-{
-    if (const bool c_SubParserActivated{_activateSubParser(rowIndex, subParserIndex)}; c_SubParserActivated)
-    {
-        mParserInput[rowIndex].mRegisteredSubParsers[subParserIndex]->parseInputData(parsingErrors);
+        SubParsingResult_t subParsingResult{pISubParser->parseInputData(dataToPass, mParserInput[rowIndex].mFileColumnNumber)};
+        _applySubParsingResult(rowIndex, subParsingResult);
+        parsingErrors = std::move(subParsingResult.mParsingErrors);
     }
 }
 
@@ -298,6 +519,21 @@ bool Parser::_parsingErrorsExist() const
     return !mParsingErrors.empty();
 }
 
+bool Parser::_areParsingErrorsContained(const size_t rowIndex) const
+{
+    return rowIndex < mParserInput.size() && mParserInput[rowIndex].mAreParsingErrorsContained;
+}
+
+bool Parser::_isErrorsLimitReached() const
+{
+    return mMaxErrorsCount > 0u && mParsingErrors.size() >= mMaxErrorsCount;
+}
+
+void Parser::_setParsingStopped()
+{
+    mIsParsingStopped = true;
+}
+
 void Parser::_readInput()
 {
     _readHeader();
@@ -306,7 +542,7 @@ void Parser::_readInput()
 
 void Parser::_readHeader()
 {
-    if (mpInputStream && mpInputStream->is_open())
+    if (mpInputStream && mpInputStream->good())
     {
         mpInputStream->seekg(0);
         std::string header;
@@ -316,46 +552,75 @@ void Parser::_readHeader()
 
 void Parser::_writeOutput()
 {
-    if (mpOutputStream && mpOutputStream->is_open())
+    if (mpOutputStream && mpOutputStream->good() && (OutputFormat::ZPL == mOutputFormat || OutputFormat::EPL == mOutputFormat))
+    {
+        _writeLabelPrinterOutput();
+    }
+    else if (mpOutputStream && mpOutputStream->good())
     {
-        *mpOutputStream << mParserOutput.mHeader << "\n";
+        _writeSinkOutput();
+    }
 
-        for (const auto& payloadRow : mParserOutput.mData)
-        {
-            *mpOutputStream << payloadRow << "\n";
-        }
+    // the labels of an output that could not be written are not spooled either
+    if (!mLabelSpoolDir.empty() && mpOutputStream && !mpOutputStream->fail())
+    {
+        _spoolLabels();
     }
 }
 
-/* Each data item retrieved from sub-parser is checked for validity individually and independently from the other received items
-   It is the responsibility of the sub-parser to provide correct parameters in relation to each other
-   (e.g. a correct column number update in relation to the new current position)
-*/
-void Parser::_retrieveRequiredDataFromSubParser(const ISubParser* const pISubParser)
+void Parser::_writeSinkOutput()
 {
-    Core::Index_t subParserRowIndex;
+    const Core::OutputSinkPtr c_pOutputSink{createOutputSink(mOutputFormat, mpOutputStream)};
+    std::vector<std::string_view> fields;
+
+    Core::splitDataFields(mParserOutput.mHeader, fields);
 
-    if (pISubParser && _isValidSubParser(pISubParser))
+    bool success{c_pOutputSink->writeHeader(fields)};
+
+    for (size_t rowIndex{0u}; rowIndex < mParserOutput.mData.getRowsCount(); ++rowIndex)
     {
-        // file row numbering starts at 1 and the first row is reserved for the header so payload rows start at 2 (row number already checked, sub-parser is valid)
-        subParserRowIndex = pISubParser->getFileRowNumber() - 2;
+        mParserOutput.mData.getRow(rowIndex, fields);
+        success = success && c_pOutputSink->writeRow(fields);
+    }
 
-        if (!_isValidCurrentPosition(subParserRowIndex.value()))
-        {
-            subParserRowIndex.reset();
-        }
+    // an incomplete output (e.g. a spreadsheet without shared strings table) is reported like any other output stream error
+    if (!c_pOutputSink->finish() || !success)
+    {
+        mpOutputStream->setstate(std::ios_base::failbit);
     }
+}
 
-    if (subParserRowIndex.has_value())
+void Parser::_writeLabelPrinterOutput()
+{
+    const LabelPrinterWriter c_LabelPrinterWriter{OutputFormat::EPL == mOutputFormat ? LabelPrinterWriter::PrinterLanguage::EPL : LabelPrinterWriter::PrinterLanguage::ZPL};
+
+    if (!c_LabelPrinterWriter.write(mpOutputStream, mParserOutput.mData))
     {
-        const size_t c_RowIndex{subParserRowIndex.value()};
+        mpOutputStream->setstate(std::ios_base::failbit);
+    }
+}
+
+void Parser::_spoolLabels()
+{
+    const LabelPrinterWriter c_LabelPrinterWriter{OutputFormat::EPL == mOutputFormat ? LabelPrinterWriter::PrinterLanguage::EPL : LabelPrinterWriter::PrinterLanguage::ZPL};
 
-        if (const Core::Index_t c_SubParserCurrentPosition{pISubParser->getCurrentPosition()}; c_SubParserCurrentPosition.has_value())
+    mIsLabelSpoolingFailed = !c_LabelPrinterWriter.writeToSpool(mLabelSpoolDir, mLabelSpoolJobName, mParserOutput.mData);
+}
+
+/* Each data item returned by the sub-parser is checked for validity individually and independently from the other returned items
+   It is the responsibility of the sub-parser to provide correct parameters in relation to each other
+   (e.g. a correct column number update in relation to the new current position)
+*/
+void Parser::_applySubParsingResult(const size_t rowIndex, const SubParsingResult_t& subParsingResult)
+{
+    if (_isValidCurrentPosition(rowIndex))
+    {
+        if (subParsingResult.mCurrentPosition.has_value())
         {
-            if (const size_t c_NewCurrentPosition{mParserInput[c_RowIndex].mCurrentPosition.value() + c_SubParserCurrentPosition.value()};
-                c_NewCurrentPosition <= mParserInput[c_RowIndex].mRowData.size())
+            if (const size_t c_NewCurrentPosition{mParserInput[rowIndex].mCurrentPosition.value() + subParsingResult.mCurrentPosition.value()};
+                c_NewCurrentPosition <= mParserInput[rowIndex].mRowData.size())
             {
-                mParserInput[c_RowIndex].mCurrentPosition = c_NewCurrentPosition;
+                mParserInput[rowIndex].mCurrentPosition = c_NewCurrentPosition;
             }
             else
             {
@@ -365,14 +630,13 @@ void Parser::_retrieveRequiredDataFromSubParser(const ISubParser* const pISubPar
         else
         {
             // if string had been consumed by sub-parser, then current position should be invalidated
-            mParserInput[c_RowIndex].mCurrentPosition.reset();
+            mParserInput[rowIndex].mCurrentPosition.reset();
         }
 
         // parsing goes from beginning to the end of the string so the resulting column number should never be lower than the initial one
-        if (const size_t c_FileColumnNumber{pISubParser->getFileColumnNumber()};
-            c_FileColumnNumber >= mParserInput[c_RowIndex].mFileColumnNumber)
+        if (subParsingResult.mFileColumnNumber >= mParserInput[rowIndex].mFileColumnNumber)
         {
-            mParserInput[c_RowIndex].mFileColumnNumber = c_FileColumnNumber;
+            mParserInput[rowIndex].mFileColumnNumber = subParsingResult.mFileColumnNumber;
         }
         else
         {
@@ -381,25 +645,6 @@ void Parser::_retrieveRequiredDataFromSubParser(const ISubParser* const pISubPar
     }
 }
 
-bool Parser::_isValidSubParser(const ISubParser* const pISubParser) const
-{
-    bool isRegistered{false};
-
-    if (pISubParser)
-    {
-        // file row numbering starts at 1 and the first row is reserved for the header (so payload rows start at 2)
-        if (const size_t c_FileRowNumber{pISubParser->getFileRowNumber()}; c_FileRowNumber > 1u)
-        {
-            if (const size_t c_RowIndex{c_FileRowNumber - 2}; c_RowIndex < mParserInput.size())
-            {
-                isRegistered = (mParserInput[c_RowIndex].mRegisteredSubParsers.cend() != std::find(mParserInput[c_RowIndex].mRegisteredSubParsers.cbegin(), mParserInput[c_RowIndex].mRegisteredSubParsers.cend(), pISubParser));
-            }
-        }
-    }
-
-    return isRegistered;
-}
-
 void Parser::_destroySubParsers()
 {
     for (auto& row : mParserInput)
@@ -415,11 +660,12 @@ void Parser::_destroySubParsers()
     }
 }
 
-Parser::ParsedRowInfo::ParsedRowInfo(const std::string_view rowData)
+Parser::ParsedRowInfo::ParsedRowInfo(const std::string_view rowData, const size_t parseableContentEnd)
     : mRowData{rowData}
+    , mParseableContentEnd{parseableContentEnd}
     , mCurrentPosition{std::nullopt}
     , mFileColumnNumber{1u}
-    , mIsSubParserActive{false}
+    , mAreParsingErrorsContained{false}
 {
 }
 
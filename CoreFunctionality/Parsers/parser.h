@@ -1,29 +1,96 @@
 #ifndef PARSER_H
 #define PARSER_H
 
+#include <map>
 #include <vector>
 
 #include "errorhandler.h"
-#include "isubparserobserver.h"
+#include "outputsink.h"
+#include "tablerows.h"
 
 #ifdef _WIN32
 #include "auxdata.h"
 #endif
 
 class ISubParser;
+struct SubParsingResult_t;
 
 /* This is a generic parser class for .csv files.
    The content of an input .csv file is read, parsed and the resulting output written to an output .csv file.
    If errors occur they are being logged to an error file. In this case the output file stays empty.
 */
-class Parser : public ISubParserObserver
+class Parser
 {
 public:
+    enum class OutputFormat
+    {
+        CSV,
+        XLSX,                                   // spreadsheet (single worksheet), e.g. for printing the labelling table
+        JSONL,                                  // JSON Lines: one object per row, keyed by the column names
+        BINARY,                                 // length-prefixed binary records
+        ZPL,                                    // label printer commands (one wrap label per connection), only for the labelling table
+        EPL
+    };
+
     Parser(const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream, const std::string_view header);
     virtual ~Parser();
 
     bool parse();
-    virtual void subParserFinished(ISubParser* const pISubParser) override;
+
+    /* The output is written as csv unless requested otherwise
+    */
+    void setOutputFormat(const OutputFormat outputFormat);
+
+    /* The format is selected by the output file extension (ignoring the compression extension, e.g. .jsonl.gz): .xlsx (spreadsheet), .jsonl (JSON Lines), .bin (binary records),
+       .zpl/.epl (label printer commands) or any other (csv)
+    */
+    static OutputFormat getOutputFormat(const Core::Path_t& outputFile);
+
+    /* File extension of the output format (without compression extension), e.g. .jsonl
+    */
+    static std::string_view getFileExtension(const OutputFormat outputFormat);
+
+    /* Sink writing the table rows in the output format (csv for the label printer formats as these are not tables)
+    */
+    static Core::OutputSinkPtr createOutputSink(const OutputFormat outputFormat, const Core::OutputStreamPtr pOutputStream);
+
+    /* Once the output is written the labels are also written to the spool directory as label printer command files named after the output file (e.g. rack01_labellingtable_0001.zpl)
+       The printer language is EPL for the EPL output format, otherwise ZPL. Nothing is spooled if parsing errors occurred, unless a partial output is written
+    */
+    void setLabelSpool(const Core::Path_t& spoolDir, const Core::Path_t& outputFile);
+
+    /* True if the labels should have been spooled but (some of) the spool files could not be written
+    */
+    bool isLabelSpoolingFailed() const;
+
+    /* Validation only: the input is read and checked (parsing errors being logged as usual) but no output is built or written, nor are any labels spooled
+    */
+    void setValidationOnly(const bool validationOnly);
+
+    /* Parsing stops once this number of errors is reached (0: no limit), any further errors being suppressed. If errors actually got suppressed (or input left unparsed) the error file then ends with a note mentioning the limit
+    */
+    void setMaxErrorsCount(const size_t maxErrorsCount);
+
+    /* The parsing errors are logged as aggregated report (grouped by error code and column, see AggregatedErrorReport) instead of one by one
+    */
+    void setErrorReportAggregated(const bool errorReportAggregated);
+
+    /* If parsing errors occur the output is still built and written from the valid rows, each row containing errors being marked within the output (instead of being converted)
+       Only applies to the parsers supporting it (see _isPartialOutputSupported()), the labels also being spooled in this case
+    */
+    void setPartialOutputAllowed(const bool partialOutputAllowed);
+
+    /* File from which the input is read, used for pointing the user to it (e.g. by the invalid labels). If not set (e.g. input received in memory) the input data is referred instead
+    */
+    void setInputFile(const Core::Path_t& inputFile);
+
+    /* Number of payload rows read by the last parsing session
+    */
+    size_t getInputRowsCount() const;
+
+    /* Number of parsing errors of the last parsing session for each error code that occurred
+    */
+    std::map<Core::Error_t, size_t> getParsingErrorsCount() const;
 
 protected:
     /* This function reads all rows from input file starting with the second one (a.k.a. payload) and prepares them for parsing. */
@@ -35,12 +102,21 @@ protected:
     /* This function builds the rows to be written into the output file. */
     virtual void _buildOutput() = 0;
 
+    /* Input file as set by the user of the parser (empty if not set) */
+    const Core::Path_t& _getInputFile() const;
+
     /* This function resets the internal parser state after each parsing session. */
     virtual void _reset();
 
+    /* Parsers that are able to build the output when parsing errors occurred (by marking the rows containing errors) should return true */
+    virtual bool _isPartialOutputSupported() const;
+
     /* Used for requesting error logging from error handler (force: used for non-localized error, e.g. empty file) */
     ErrorPtr _logError(const Core::Error_t errorCode, const size_t fileRowNumber, bool force = false);
 
+    /* Used for the errors located at a given column and referring to another row (e.g. the row where a duplicate device port has been used first) */
+    ErrorPtr _logError(const Core::Error_t errorCode, const size_t fileRowNumber, const size_t fileColumnNumber, const size_t relatedFileRowNumber);
+
     /* Used for storing locally generated errors
        Error location is setup at error storing point
     */
@@ -55,6 +131,12 @@ protected:
     /* Reads a payload line from input stream and appends it to input data */
     bool _readLineAndAppendToInput();
 
+    /* Reads the next non-empty payload row and appends it to input. Returns false once the input stream is consumed */
+    bool _readPayloadRow();
+
+    /* Checks if any non-empty payload row is left to be read (the rows are consumed so it should only be used once parsing stopped) */
+    bool _isPayloadRowRemaining();
+
     /* Reads the first column from given row */
     bool _readFirstCell(const size_t rowIndex, std::string& firstCell);
 
@@ -67,8 +149,11 @@ protected:
     /* Increments file column number (position updated separately) */
     void _moveToNextInputColumn(const size_t rowIndex);
 
-    /* Returns substring consisting of columns not yet parsed (from given row) */
-    std::string _getUnparsedCellsContent(const size_t rowIndex) const;
+    /* Checks if the columns not yet parsed (from given row) contain any parseable characters (constant time, no row content is copied or scanned) */
+    bool _isParseableContentRemaining(const size_t rowIndex) const;
+
+    /* Provides the row content until the last parseable character (trailing empty cells and whitespace excluded) */
+    std::string_view _getParseableRowContent(const size_t rowIndex) const;
 
     /* Checks if current position index is valid for the given row */
     bool _isValidCurrentPosition(const size_t rowIndex) const;
@@ -76,16 +161,13 @@ protected:
     /* Provides the number of input rows (payload) */
     size_t _getInputRowsCount() const;
 
-    /* Appends the row content to output once or multiple times (no operation if timesToAppend is 0) */
-    void _appendRowToOutput(const std::string& rowContent, const size_t timesToAppend = 1);
+    /* Appends the row (split into its fields) to output once or multiple times (no operation if timesToAppend is 0) */
+    void _appendRowToOutput(const Core::Row_t& row, const size_t timesToAppend = 1);
 
     /* Provides access to error handling mechanism to sub-parser */
     void _registerSubParser(ISubParser* const pISubParser);
 
-    /* Activates the subparser so the it can start doing its part */
-    bool _activateSubParser(const size_t rowIndex, const size_t subParserIndex);
-
-    /* Launches sub-parsing for given sub-parser */
+    /* Launches sub-parsing for given sub-parser (the row state is updated with the sub-parsing result) */
     void _doSubParsing(const size_t rowIndex, const size_t subParserIndex, std::vector<ErrorPtr>& parsingErrors);
 
     /* Used by derived classes to access the requested subparser for specific jobs */
@@ -94,6 +176,15 @@ protected:
     /* Checks if any parsing errors occured (either from parser or from sub-parser) */
     bool _parsingErrorsExist() const;
 
+    /* Checks if any parsing errors occured on the given row (used for marking the row when building a partial output) */
+    bool _areParsingErrorsContained(const size_t rowIndex) const;
+
+    /* Checks if the maximum number of errors has been reached, in which case the parsing should be stopped (the errors stored afterwards are discarded) */
+    bool _isErrorsLimitReached() const;
+
+    /* Used when parsing stopped (errors limit reached) before consuming the whole input, the error file then mentioning that further errors have been suppressed */
+    void _setParsingStopped();
+
 private:
     /* This function reads all rows (header and payload) from input file. */
     void _readInput();
@@ -104,11 +195,16 @@ private:
     /* This function writes the resulting output to file. */
     void _writeOutput();
 
-    /* Retrieves relevant data resulted from subparser work: current position, file column number, etc */
-    void _retrieveRequiredDataFromSubParser(const ISubParser* const pISubParser);
+    /* The header (split into its fields) and the rows are passed one by one to the sink of the output format */
+    void _writeSinkOutput();
+
+    /* The header is not written, each row becoming a label */
+    void _writeLabelPrinterOutput();
 
-    /* Checks if the subparser is registered within parser and has valid row number (otherwise it cannot be used) */
-    bool _isValidSubParser(const ISubParser* const pISubParser) const;
+    void _spoolLabels();
+
+    /* Updates the row state (current position, file column number) with the result returned by the sub-parser */
+    void _applySubParsingResult(const size_t rowIndex, const SubParsingResult_t& subParsingResult);
 
     /* Deallocates all registered subparsers once Parser gets destroyed (once registered their ownership is assumed by Parser) */
     void _destroySubParsers();
@@ -117,13 +213,14 @@ private:
     struct ParsedRowInfo
     {
         ParsedRowInfo() = delete;
-        ParsedRowInfo(const std::string_view rowData);
+        ParsedRowInfo(const std::string_view rowData, const size_t parseableContentEnd);
 
         std::string mRowData; // input row (payload) data
+        size_t mParseableContentEnd; // index following the last parseable character of the row (computed once when reading the row)
         Core::Index_t mCurrentPosition; // current character index in the input string
         size_t mFileColumnNumber; // csv column number
         std::vector<ISubParser*> mRegisteredSubParsers; // subparsers used on the row
-        bool mIsSubParserActive; // checks if a subparser is active on the row (only one subparser can be active on each row)
+        bool mAreParsingErrorsContained; // at least one parsing error has been stored for the row
     };
 
     using ParserInput = std::vector<ParsedRowInfo>;
@@ -134,11 +231,11 @@ private:
         ParserOutput() = delete;
         ParserOutput(const std::string_view header);
 
-        std::vector<std::string> mData; // stores final data (.csv rows) to be written to output file
+        Core::TableRows mData; // stores final data (rows split into fields) to be written to output file
         const std::string mHeader; // header (.csv row) to be written to output file
     };
 
-    /* file streams used by parser, each one should correspond to a file that had been previously correctly opened */
+    /* streams used by parser (files or memory buffers), each one should be valid (e.g. corresponding to a file that had been previously correctly opened) */
     const Core::InputStreamPtr mpInputStream;
     const Core::OutputStreamPtr mpOutputStream;
     const Core::ErrorStreamPtr mpErrorStream;
@@ -157,6 +254,31 @@ private:
 
     /* determines if the parser state needs to be reset before executing a parsing session */
     bool mIsResetRequired;
+
+    OutputFormat mOutputFormat;
+
+    /* file from which the input stream is read (only used for pointing the user to the input) */
+    Core::Path_t mInputFile;
+
+    /* label printer spool directory and job name (no spooling if the directory is empty) */
+    Core::Path_t mLabelSpoolDir;
+    std::string mLabelSpoolJobName;
+    bool mIsLabelSpoolingFailed;
+
+    /* the output is neither built nor written (input check only) */
+    bool mIsValidationOnly;
+
+    /* parsing stops once this number of errors is reached (0: no limit) */
+    size_t mMaxErrorsCount;
+
+    /* errors have been discarded or input has been left unparsed because the maximum number of errors has been reached */
+    bool mIsParsingStopped;
+
+    /* the errors are logged grouped by problem instead of one by one */
+    bool mIsErrorReportAggregated;
+
+    /* the output is built from the valid rows even if parsing errors occurred */
+    bool mIsPartialOutputAllowed;
 };
 
 using ParserPtr = std::unique_ptr<Parser>;
@@ -7,7 +7,9 @@ ParserCreator::ParserCreator()
 {
 }
 
-ParserPtr ParserCreator::createParser(const ParserCreator::ParserTypes parserType, const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream)
+ParserPtr ParserCreator::createParser(const ParserCreator::ParserTypes parserType, const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream,
+                                      const LabellingIndexPtr pLabellingIndex, const ConnectionReportsPtr pConnectionReports,
+                                      const ConnectionConflictDetectorPtr pConnectionConflictDetector)
 {
     ParserPtr pCreatedParser{nullptr};
 
@@ -19,7 +21,7 @@ ParserPtr ParserCreator::createParser(const ParserCreator::ParserTypes parserTyp
         }
         else if (ParserTypes::CONNECTION_INPUT == parserType)
         {
-            pCreatedParser = std::make_unique<ConnectionInputParser>(pInputStream, pOutputStream, pErrorStream);
+            pCreatedParser = std::make_unique<ConnectionInputParser>(pInputStream, pOutputStream, pErrorStream, pLabellingIndex, pConnectionReports, pConnectionConflictDetector);
         }
         else
         {
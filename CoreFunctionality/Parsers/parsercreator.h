@@ -2,6 +2,9 @@
 #define PARSERCREATOR_H
 
 #include "parser.h"
+#include "labellingindex.h"
+#include "connectionreports.h"
+#include "connectionconflictdetector.h"
 
 class ParserCreator
 {
@@ -18,7 +21,12 @@ public:
     ParserCreator(const ParserCreator& parserCreator) = delete;
     ParserCreator& operator=(const ParserCreator&) = delete;
 
-    ParserPtr createParser(const ParserTypes parserType, const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream);
+    /* The labelling index, the reports and the conflict detector are optional and only used by the connection input parser
+       (only the changed connection input rows are labelled, reports produced from the labelled connections, duplicate device ports and labels reported as errors)
+    */
+    ParserPtr createParser(const ParserTypes parserType, const Core::InputStreamPtr pInputStream, const Core::OutputStreamPtr pOutputStream, const Core::ErrorStreamPtr pErrorStream,
+                           const LabellingIndexPtr pLabellingIndex = nullptr, const ConnectionReportsPtr pConnectionReports = nullptr,
+                           const ConnectionConflictDetectorPtr pConnectionConflictDetector = nullptr);
 
     bool isParserAlreadyCreated() const;
 
@@ -1,6 +1,10 @@
 #include <algorithm>
 
+#include "appsettings.h"
 #include "coreutils.h"
+#include "labelformats.h"
+#include "deviceportdata.h"
+#include "devicecatalog.h"
 #include "parserutils.h"
 
 namespace Core = Utilities::Core;
@@ -18,6 +22,10 @@ Data::DeviceTypeID Utilities::Parsers::getDeviceTypeID(const std::string_view de
     {
         deviceTypeID = it->second;
     }
+    else
+    {
+        deviceTypeID = DeviceCatalog::getInstance()->getDeviceTypeID(deviceTypeLowerCase);
+    }
 
     return deviceTypeID;
 }
@@ -34,6 +42,54 @@ std::string Utilities::Parsers::getDeviceTypeAsString(Data::DeviceTypeID deviceT
     {
         deviceType = it->first;
     }
+    else if (const DeviceCatalog::DeviceTypeInfo_t* const c_pDeviceTypeInfo{DeviceCatalog::getInstance()->getDeviceTypeInfo(deviceTypeID)}; c_pDeviceTypeInfo)
+    {
+        deviceType = c_pDeviceTypeInfo->mKeyword;
+    }
 
     return deviceType;
 }
+
+std::vector<std::string> Utilities::Parsers::getConnectionInputPlaceholders(Data::DeviceTypeID deviceTypeID)
+{
+    std::vector<std::string> placeholders;
+    const Data::DevicePortSchema_t* pSchema{nullptr};
+
+    if (deviceTypeID >= Data::DeviceTypeID::PDU && deviceTypeID < Data::DeviceTypeID::FIRST_CATALOG_DEVICE)
+    {
+        pSchema = &Data::getDevicePortSchema(deviceTypeID);
+    }
+    else if (const DeviceCatalog::DeviceTypeInfo_t* const c_pDeviceTypeInfo{DeviceCatalog::getInstance()->getDeviceTypeInfo(deviceTypeID)}; c_pDeviceTypeInfo)
+    {
+        pSchema = &c_pDeviceTypeInfo->mSchema;
+    }
+
+    if (pSchema)
+    {
+        // unused parameters (up to the maximum parameters count) are filled in with '-'
+        for (size_t parameterIndex{0u}; parameterIndex < Data::c_MaxPortInputParametersCount; ++parameterIndex)
+        {
+            placeholders.emplace_back(parameterIndex < pSchema->mParametersCount ? Data::c_PortParameterPlaceholders[static_cast<size_t>(pSchema->mParameters[parameterIndex])]
+                                                                                 : "-");
+        }
+    }
+    else
+    {
+        ASSERT(false, "No placeholders available for device type");
+    }
+
+    return placeholders;
+}
+
+std::uint64_t Utilities::Parsers::getConfigurationHash()
+{
+    std::uint64_t configurationHash{Core::getHash64(Data::c_LabellingTableHeader)};
+
+    configurationHash = Core::getHash64(std::to_string(LabelFormats::getInstance()->getContentHash()), configurationHash);
+    configurationHash = Core::getHash64(std::to_string(DeviceCatalog::getInstance()->getContentHash()), configurationHash);
+
+    // some labels contain the path of the connection input file
+    configurationHash = Core::getHash64(AppSettings::getInstance()->getConnectionInputFile().string(), configurationHash);
+
+    return configurationHash;
+}
@@ -1,12 +1,18 @@
 #ifndef PARSERUTILS_H
 #define PARSERUTILS_H
 
+#include <cstdint>
+#include <vector>
+
 #include "applicationdata.h"
 
 namespace Utilities::Parsers
 {
     static const std::string c_InvalidCablePNErrorText{"Error! The cable part number is missing or contains invalid characters."};
 
+    // written instead of the descriptions and labels of a connection input row containing parsing errors (partial output), followed by the file row number
+    static const std::string c_InvalidConnectionInputRowErrorText{"PARSING ERROR: SEE THE ERROR FILE FOR CONNECTION INPUT ROW "};
+
     // offset used for calculating the row number based on payload index (header row is ignored and row numbering starts at 1)
     static constexpr short c_RowNumberOffset{2};
 
@@ -17,12 +23,22 @@ namespace Utilities::Parsers
 
     /* This function converts the input string containing the device type into a numeric device type ID that is then used
        for further processing (Device object creation, etc)
+       The built-in device types are checked first, then the ones defined in the device catalog file
     */
     Data::DeviceTypeID getDeviceTypeID(const std::string_view deviceType);
 
     /* This function is used for getting the device type string for writing back into connection input file
     */
     std::string getDeviceTypeAsString(Data::DeviceTypeID deviceTypeID);
+
+    /* This function returns the device port parameter placeholders to be written into the connection input template file
+    */
+    std::vector<std::string> getConnectionInputPlaceholders(Data::DeviceTypeID deviceTypeID);
+
+    /* This function returns the hash of the settings the parsers output depends on (label formats, device catalog, connection input file path)
+       Outputs calculated with a different configuration hash should not be reused
+    */
+    std::uint64_t getConfigurationHash();
 }
 
 #endif // PARSERUTILS_H
@@ -3,7 +3,7 @@
 
 void Utilities::Other::createEmptyConnectionDefinitionsFile(const Core::OutputStreamPtr pOutputStream)
 {
-    if(pOutputStream && pOutputStream->is_open())
+    if(pOutputStream && pOutputStream->good())
     {
         *pOutputStream << Data::c_ConnectionDefinitionsHeader << "\n";
 
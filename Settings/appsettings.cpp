@@ -10,6 +10,7 @@
 
 AppSettings::AppSettings()
     : mIsInitialized{false}
+    , mIsAppExamplesDirRetrieved{false}
 {
     _init();
 }
@@ -49,8 +50,22 @@ Core::Path_t AppSettings::getOutputBackupDir() const
     return mOutputBackupDir;
 }
 
+Core::Path_t AppSettings::getWorkspaceDir() const
+{
+    return mWorkspaceDir;
+}
+
+/* Resolving the application directory and searching the documentation directory is only required for copying the examples, so it's not done at startup
+*/
 Core::Path_t AppSettings::getAppExamplesDir() const
 {
+    if (!mIsAppExamplesDirRetrieved)
+    {
+        _retrieveAppDir();
+        _retrieveAppExamplesDir();
+        mIsAppExamplesDirRetrieved = true;
+    }
+
     return mAppExamplesDir;
 }
 
@@ -79,6 +94,21 @@ Core::Path_t AppSettings::getParsingErrorsFile() const
     return mParsingErrorsFile;
 }
 
+Core::Path_t AppSettings::getLabelFormatsFile() const
+{
+    return mLabelFormatsFile;
+}
+
+Core::Path_t AppSettings::getDeviceCatalogFile() const
+{
+    return mDeviceCatalogFile;
+}
+
+Core::Path_t AppSettings::getBackupSettingsFile() const
+{
+    return mBackupSettingsFile;
+}
+
 void AppSettings::_init()
 {
     if (!mIsInitialized)
@@ -87,9 +117,6 @@ void AppSettings::_init()
 
         if (mUsername.size() > 0u)
         {
-            _retrieveAppDir();
-            _retrieveAppExamplesDir();
-
             mAppDataDir = scCentralHomeDir;
             mAppDataDir /= mUsername;
             mAppDataDir /= scUserDocumentsDirName;
@@ -102,6 +129,8 @@ void AppSettings::_init()
             mAppDataExamplesDir = mAppDataDir;
             mAppDataExamplesDir /= scAppDataExamplesDirName;
 
+            _retrieveWorkspaceDir();
+
             mConnectionDefinitionsFile = mAppDataDir;
             mConnectionDefinitionsFile /= scConnectionDefinitionsFilename;
             mConnectionInputFile = mAppDataDir;
@@ -110,6 +139,12 @@ void AppSettings::_init()
             mLabellingOutputFile /= scLabellingTableFilename;
             mParsingErrorsFile /= mAppDataDir;
             mParsingErrorsFile /= scParsingErrorsFilename;
+            mLabelFormatsFile = mAppDataDir;
+            mLabelFormatsFile /= scLabelFormatsFilename;
+            mDeviceCatalogFile = mAppDataDir;
+            mDeviceCatalogFile /= scDeviceCatalogFilename;
+            mBackupSettingsFile = mAppDataDir;
+            mBackupSettingsFile /= scBackupSettingsFilename;
 
             mIsInitialized = true;
         }
@@ -150,7 +185,22 @@ void AppSettings::_retrieveUsername()
 #endif
 }
 
-void AppSettings::_retrieveAppDir()
+void AppSettings::_retrieveWorkspaceDir()
+{
+    const char* const c_pWorkspaceDir{getenv(scWorkspaceDirEnvVariable.data())};
+
+    if (c_pWorkspaceDir != nullptr && *c_pWorkspaceDir != '\0')
+    {
+        mWorkspaceDir = c_pWorkspaceDir;
+    }
+    else
+    {
+        mWorkspaceDir = mAppDataDir;
+        mWorkspaceDir /= scWorkspaceDirName;
+    }
+}
+
+void AppSettings::_retrieveAppDir() const
 {
     mAppDir.clear();
 #if defined (__APPLE__) && defined (__MACH__)
@@ -161,7 +211,8 @@ void AppSettings::_retrieveAppDir()
         mAppDir = Core::Path_t{path}.parent_path();
     }
 #elif defined (__unix__)
-    const Core::Path_t c_AppExecFilePath{std::filesystem::canonical("/proc/self/exe")};
+    std::error_code errorCode;
+    const Core::Path_t c_AppExecFilePath{std::filesystem::canonical("/proc/self/exe", errorCode)};
     if (!c_AppExecFilePath.empty())
     {
         mAppDir = c_AppExecFilePath.parent_path();
@@ -182,7 +233,7 @@ void AppSettings::_retrieveAppDir()
     }
 }
 
-void AppSettings::_retrieveAppExamplesDir()
+void AppSettings::_retrieveAppExamplesDir() const
 {
     mAppExamplesDir.clear();
 
@@ -191,7 +242,10 @@ void AppSettings::_retrieveAppExamplesDir()
         Core::Path_t documentationDir{mAppDir};
         documentationDir /= scAppDocumentationDirName;
 
-        for (const auto& dirEntry : std::filesystem::directory_iterator{documentationDir})
+        std::error_code errorCode;
+
+        // no examples available if the documentation directory is missing
+        for (const auto& dirEntry : std::filesystem::directory_iterator{documentationDir, errorCode})
         {
             const Core::Path_t c_CurrentPath{dirEntry.path()};
             bool matchingCurrentPathFound{false};
@@ -17,12 +17,16 @@ public:
     Core::Path_t getAppDataDir() const;
     Core::Path_t getInputBackupDir() const;
     Core::Path_t getOutputBackupDir() const;
+    Core::Path_t getWorkspaceDir() const;
     Core::Path_t getAppExamplesDir() const;
     Core::Path_t getAppDataExamplesDir() const;
     Core::Path_t getConnectionDefinitionsFile() const;
     Core::Path_t getConnectionInputFile() const;
     Core::Path_t getLabellingOutputFile() const;
     Core::Path_t getParsingErrorsFile() const;
+    Core::Path_t getLabelFormatsFile() const;
+    Core::Path_t getDeviceCatalogFile() const;
+    Core::Path_t getBackupSettingsFile() const;
 
 private:
     /* Private constructor (singleton)
@@ -30,7 +34,7 @@ private:
     AppSettings();
 
     /* This function is responsible for building the application settings object
-       It creates the paths of all essential files and dirs
+       It creates the paths of all essential files and dirs (the application directory is only retrieved on request as it's not required for processing data)
     */
     void _init();
 
@@ -38,13 +42,17 @@ private:
     */
     void _retrieveUsername();
 
+    /* The workspace directory can be provided by environment variable (e.g. for placing the run directories on tmpfs), otherwise it resides within the application data directory
+    */
+    void _retrieveWorkspaceDir();
+
     /* Cross-platform function that retrieves the application directory from OS system settings and converts it into a canonical path
     */
-    void _retrieveAppDir();
+    void _retrieveAppDir() const;
 
     /* This function retrieves the examples directory located within build folder (source examples directory) - if any
     */
-    void _retrieveAppExamplesDir();
+    void _retrieveAppExamplesDir() const;
 
     static std::shared_ptr<AppSettings> s_pAppSettings;
 
@@ -59,12 +67,17 @@ private:
     static constexpr std::string_view scAppDataDirName{"LabelCalculatorData"};
     static constexpr std::string_view scInputBackupDirName{"LabellingInputBackup"};
     static constexpr std::string_view scOutputBackupDirName{"LabellingOutputBackup"};
+    static constexpr std::string_view scWorkspaceDirName{".workspace"};
+    static constexpr std::string_view scWorkspaceDirEnvVariable{"LABELCALCULATOR_WORKSPACE"};
     static constexpr std::string_view scAppDataExamplesDirName{"ExampleFiles"};
 
     static constexpr std::string_view scConnectionDefinitionsFilename{"connectiondefinitions.csv"};
     static constexpr std::string_view scConnectionInputFilename{"connectioninput.csv"};
     static constexpr std::string_view scLabellingTableFilename{"labellingtable.csv"};
     static constexpr std::string_view scParsingErrorsFilename{"error.txt"};
+    static constexpr std::string_view scLabelFormatsFilename{"labelformats.csv"};
+    static constexpr std::string_view scDeviceCatalogFilename{"devicecatalog.csv"};
+    static constexpr std::string_view scBackupSettingsFilename{"backupsettings.csv"};
 
     static constexpr std::string_view scAppDocumentationDirName{"Documentation"};
 
@@ -73,19 +86,26 @@ private:
 
     bool mIsInitialized;
 
-    Core::Path_t mAppDir;             // build folder, directory where the application executable resides
     Core::Path_t mAppDataDir;         // data folder, directory where the input/output files processed by application reside
     Core::Path_t mInputBackupDir;     // backup for input files
     Core::Path_t mOutputBackupDir;    // backup for output files
-    Core::Path_t mAppExamplesDir;     // examples dir from build folder
+    Core::Path_t mWorkspaceDir;       // contains the private directory of each running operation (the output files are written there before being published)
     Core::Path_t mAppDataExamplesDir; // examples dir copied from build folder to app data directory
 
     Core::Path_t mConnectionDefinitionsFile;
     Core::Path_t mConnectionInputFile;
     Core::Path_t mLabellingOutputFile;
     Core::Path_t mParsingErrorsFile;
+    Core::Path_t mLabelFormatsFile;   // optional, used for customizing the device port descriptions and labels
+    Core::Path_t mDeviceCatalogFile;  // optional, used for defining device types in addition to the built-in ones
+    Core::Path_t mBackupSettingsFile; // optional, used for configuring the backup retention and compression
 
     std::string mUsername;
+
+    // only retrieved when the examples are requested
+    mutable Core::Path_t mAppDir;           // build folder, directory where the application executable resides
+    mutable Core::Path_t mAppExamplesDir;   // examples dir from build folder
+    mutable bool mIsAppExamplesDirRetrieved;
 };
 
 #endif // APPSETTINGS_H
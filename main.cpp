@@ -1,7 +1,12 @@
+#include <vector>
+#include <string_view>
+
 #include "application.h"
 
-int main()
+int main(int argc, char* argv[])
 {
-    const int c_Result{Application::getInstance()->run()};
+    // the first argument (executable name) is skipped; if no other arguments are provided the application runs interactively
+    const std::vector<std::string_view> c_Arguments(argc > 1 ? argv + 1 : argv + argc, argv + argc);
+    const int c_Result{Application::getInstance()->run(c_Arguments)};
     return c_Result;
 }